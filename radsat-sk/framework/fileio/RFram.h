@@ -1,38 +1,45 @@
-/**
- * @file RFram.h
- * @date May 18 2021
- * @author Tyrel Kostyk
- */
-
-#ifndef RFRAM_H_
-#define RFRAM_H_
-
-#include <stdint.h>
-
-/***************************************************************************************************
-                                            DEFINITIONS
-***************************************************************************************************/
-
-/** FRAM address of the write cursor (2 bytes allocated). */
-#define FRAM_WRITE_CURSOR_ADDR	(0x00)
-
-/** FRAM address of the read cursor (2 bytes allocated). */
-#define FRAM_READ_CURSOR_ADDR	(0x02)
-
-/** FRAM start address of the data. */
-#define FRAM_DATA_START_ADDR	(0x04)
-
-/** Size of each data block in FRAM (in bytes). */
-#define FRAM_DATA_FRAME_SIZE	(TRANCEIVER_TX_MAX_FRAME_SIZE + 1)
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-int framInit(void);
-int framRead(uint8_t* data, uint32_t address, uint32_t size);
-int framWrite(uint8_t* data, uint32_t address, uint32_t size);
-
-
-#endif /* RFRAM_H_ */
+/**
+ * @file RFram.h
+ * @date May 18 2021
+ * @author Tyrel Kostyk
+ */
+
+#ifndef RFRAM_H_
+#define RFRAM_H_
+
+#include <stdint.h>
+
+/***************************************************************************************************
+                                            DEFINITIONS
+***************************************************************************************************/
+
+/** FRAM address of the journal holding the data cursors (128 bytes allocated). */
+#define FRAM_JOURNAL_ADDR		(0x00)
+
+/** FRAM start address of the data. */
+#define FRAM_DATA_START_ADDR	(0x80)
+
+/** Size of each data block in FRAM (in bytes); the frame size, the frame, its epoch and its sequence number. */
+#define FRAM_DATA_FRAME_SIZE	(TRANCEIVER_TX_MAX_FRAME_SIZE + 1 + 4 + 4)
+
+
+/** FRAM usage statistics; measure how much the FRAM is accessed (and worn). */
+typedef struct _fram_stats_t {
+	uint32_t reads;				///< Number of read transactions
+	uint32_t writes;			///< Number of (verified) write transactions
+	uint32_t bytesRead;			///< Bytes read, excluding those read back to verify writes
+	uint32_t bytesWritten;		///< Bytes written
+} fram_stats_t;
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+int framInit(void);
+int framRead(uint8_t* data, uint32_t address, uint32_t size);
+int framWrite(uint8_t* data, uint32_t address, uint32_t size);
+void framStats(fram_stats_t* stats, uint8_t reset);
+
+
+#endif /* RFRAM_H_ */
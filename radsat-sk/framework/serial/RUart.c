@@ -4,6 +4,9 @@
  * @author Addi Amaya (caa746) & Jacob Waskowic (jaw352)
  */
 
+/* replaced by a simulated CubeSense when testing without the camera (see RCubeSenseSim.c) */
+#ifndef CUBESENSE_SIMULATION
+
 #include <RUart.h>
 #include <hal/errors.h>
 #include <RCommon.h>
@@ -110,3 +113,5 @@ int uartReceive(UARTbus bus, uint8_t* data, uint16_t size) {
 	int error = UART_read(bus, data, size);
 	return error;
 }
+
+#endif /* CUBESENSE_SIMULATION */
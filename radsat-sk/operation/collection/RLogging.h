@@ -1,12 +1,12 @@
-/**
- * @file RLogging.h
- * @date
- * @author
- */
-
-#ifndef RLOGGING_H_
-#define RLOGGING_H_
-
-
-
-#endif /* RLOGGING_H_ */
+/**
+ * @file RLogging.h
+ * @date
+ * @author
+ */
+
+#ifndef RLOGGING_H_
+#define RLOGGING_H_
+
+
+
+#endif /* RLOGGING_H_ */
@@ -0,0 +1,572 @@
+/**
+ * @file RImageCompression.c
+ * @date October 17, 2026
+ * @author
+ *
+ * Compression of downloaded image frames, before they are prepared for downlink. Frames are added
+ * to a packet one at a time as they are downloaded, and the packet is sent once it is full; no
+ * more than a packet is ever held in memory.
+ *
+ * Each pixel is predicted from the one before it, and the difference is coded with an adaptive
+ * Rice code (its parameter follows the average size of the recent differences). Long stretches of
+ * pixels that match their prediction (i.e. the dark sky) are instead coded as runs, as in
+ * JPEG-LS. When a largest error is allowed, differences are first quantized to steps of twice that
+ * error (plus one): every pixel is then within that error of the captured one, and the packets are
+ * much smaller. A frame that does not compress is held as it is. Each packet starts afresh, so
+ * that it can be decoded on its own (see @sa imageDecode), whatever became of the others.
+ */
+
+#include <RImageCompression.h>
+#include <RCommon.h>
+#include <hal/errors.h>
+#include <string.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** The size (in bits) of a frame held as it is: its flag, then its pixels. */
+#define RAW_FRAME_BITS			(1 + 8 * IMAGE_COMPRESSION_FRAME_SIZE)
+
+/** The largest Rice parameter; values are 8 bits at most. */
+#define RICE_MAX_PARAMETER		(7)
+
+/** The length of the unary part of a Rice code at which the value is instead written out in full. */
+#define RICE_ESCAPE				(12)
+
+/** The number of pixels coded after which the totals (of the Rice parameter) are halved. */
+#define RICE_RESET_COUNT		(32)
+
+/** The starting totals of the Rice parameter (a parameter of 2). */
+#define RICE_START_TOTAL		(4)
+#define RICE_START_COUNT		(1)
+
+/** The size (in bits) of each block of a run, by run index (as in JPEG-LS, up to a whole frame). */
+static const uint8_t runBlockBits[] = { 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7 };
+
+/** The largest run index. */
+#define RUN_MAX_INDEX			((uint8_t)(sizeof(runBlockBits) - 1))
+
+
+/** Compressed bits being written (see @sa imageEncoderAddFrame). */
+typedef struct _bit_writer_t {
+	uint8_t* data;			///< The compressed data (IMAGE_COMPRESSION_MAX_SIZE bytes)
+	uint16_t size;			///< The number of whole bytes written (beyond the room of data, only counted)
+	uint8_t bitCount;		///< The number of bits written but not yet stored in data
+	uint32_t bits;			///< The bits written but not yet stored in data (lowest bits)
+} bit_writer_t;
+
+
+/** Compressed bits being read back (see @sa imageDecode). */
+typedef struct _bit_reader_t {
+	const uint8_t* data;	///< The compressed data
+	uint8_t size;			///< The size of the compressed data (in bytes)
+	uint8_t position;		///< The number of bytes read from data
+	uint8_t bitCount;		///< The number of bits read from data but not yet used
+	uint8_t overrun;		///< Whether more bits were asked for than data holds
+	uint32_t bits;			///< The bits read from data but not yet used (lowest bits)
+} bit_reader_t;
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static int encodeFrame(bit_writer_t* writer, image_compression_context_t* context, uint8_t maxError,
+					   const uint8_t* pixels, uint16_t stopSize);
+static void encodeRawFrame(bit_writer_t* writer, image_compression_context_t* context, const uint8_t* pixels);
+static void encodeRun(bit_writer_t* writer, image_compression_context_t* context, uint8_t run, uint8_t endOfFrame);
+static void encodeValue(bit_writer_t* writer, image_compression_context_t* context, uint8_t value);
+static void writeBits(bit_writer_t* writer, uint32_t value, uint8_t count);
+
+static int decodeFrame(bit_reader_t* reader, image_compression_context_t* context, uint8_t maxError, uint8_t* pixels);
+static uint8_t decodeValue(bit_reader_t* reader, image_compression_context_t* context);
+static uint8_t readBits(bit_reader_t* reader, uint8_t count);
+
+static void contextReset(image_compression_context_t* context);
+static uint8_t riceParameter(const image_compression_context_t* context);
+static void riceUpdate(image_compression_context_t* context, uint8_t value);
+static uint8_t residualEncode(image_compression_context_t* context, uint8_t pixel, uint8_t maxError);
+static void residualDecode(image_compression_context_t* context, uint8_t value, uint8_t maxError);
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+/**
+ * Begin a new (empty) packet of compressed frames.
+ *
+ * @param encoder The packet. Modified by function.
+ * @param firstFrame The index of the first frame to be added to the packet.
+ * @param maxError The largest error allowed of any pixel (limited to IMAGE_COMPRESSION_MAX_ERROR); 0 for lossless compression.
+ */
+void imageEncoderStart(image_encoder_t* encoder, uint16_t firstFrame, uint8_t maxError) {
+
+	// ensure the input pointer is not NULL
+	if (encoder == 0)
+		return;
+
+	if (maxError > IMAGE_COMPRESSION_MAX_ERROR)
+		maxError = IMAGE_COMPRESSION_MAX_ERROR;
+
+	encoder->firstFrame = firstFrame;
+	encoder->frames = 0;
+	encoder->maxError = maxError;
+	encoder->size = 0;
+	encoder->bitCount = 0;
+	encoder->bits = 0;
+	contextReset(&encoder->context);
+}
+
+
+/**
+ * Compress the next frame into the packet.
+ *
+ * @param encoder The packet (see @sa imageEncoderStart). Modified by function.
+ * @param pixels The pixels of the frame (IMAGE_COMPRESSION_FRAME_SIZE bytes).
+ * @return 0 on success; E_GENERIC if the packet has no room for the frame (it is left as it was).
+ */
+int imageEncoderAddFrame(image_encoder_t* encoder, const uint8_t* pixels) {
+
+	// ensure the input pointers are not NULL
+	if (encoder == 0 || pixels == 0)
+		return E_INPUT_POINTER_NULL;
+
+	if (encoder->frames >= IMAGE_COMPRESSION_MAX_FRAMES)
+		return E_GENERIC;
+
+	bit_writer_t writer = { encoder->data, encoder->size, encoder->bitCount, encoder->bits };
+	image_compression_context_t context = encoder->context;
+	uint16_t usedBits = 8 * encoder->size + encoder->bitCount;
+
+	// compressing the frame is given up on once it outgrows the packet, or the frame as it is
+	uint16_t stopSize = (usedBits + RAW_FRAME_BITS) / 8 + 1;
+	if (stopSize > IMAGE_COMPRESSION_MAX_SIZE + 1)
+		stopSize = IMAGE_COMPRESSION_MAX_SIZE + 1;
+
+	uint8_t compressed = 0;
+	if (encodeFrame(&writer, &context, encoder->maxError, pixels, stopSize) == SUCCESS) {
+		uint16_t codedBits = 8 * writer.size + writer.bitCount - usedBits;
+		compressed = (codedBits <= RAW_FRAME_BITS && writer.size + (writer.bitCount > 0) <= IMAGE_COMPRESSION_MAX_SIZE);
+	}
+
+	// a frame that does not compress (i.e. noise) is held as it is instead, room permitting
+	if (!compressed) {
+		if (usedBits + RAW_FRAME_BITS > 8 * IMAGE_COMPRESSION_MAX_SIZE)
+			return E_GENERIC;
+
+		writer.size = encoder->size;
+		writer.bitCount = encoder->bitCount;
+		writer.bits = encoder->bits;
+		context = encoder->context;
+		encodeRawFrame(&writer, &context, pixels);
+	}
+
+	encoder->size = (uint8_t)writer.size;
+	encoder->bitCount = writer.bitCount;
+	encoder->bits = writer.bits;
+	encoder->context = context;
+	encoder->frames++;
+	return SUCCESS;
+}
+
+
+/**
+ * Complete the packet, ready to be sent. No frames may be added to it afterwards.
+ *
+ * @param encoder The packet (see @sa imageEncoderStart). Modified by function.
+ * @return The size of its compressed data (in bytes).
+ */
+uint8_t imageEncoderFinish(image_encoder_t* encoder) {
+
+	// ensure the input pointer is not NULL
+	if (encoder == 0)
+		return 0;
+
+	// pad the last byte with zeroes
+	if (encoder->bitCount > 0) {
+		encoder->data[encoder->size++] = (uint8_t)(encoder->bits << (8 - encoder->bitCount));
+		encoder->bitCount = 0;
+	}
+
+	return encoder->size;
+}
+
+
+/**
+ * Decompress a packet of compressed frames (Ground Station).
+ *
+ * @param data The compressed data of the packet.
+ * @param size The size of the compressed data (in bytes).
+ * @param frames The number of frames held by the packet.
+ * @param maxError The largest error allowed of any pixel, as the packet was compressed with.
+ * @param pixels The decompressed frames (frames * IMAGE_COMPRESSION_FRAME_SIZE bytes). Modified by function.
+ * @return 0 on success; E_GENERIC if the data is not a valid packet of the given frames.
+ */
+int imageDecode(const uint8_t* data, uint8_t size, uint8_t frames, uint8_t maxError, uint8_t* pixels) {
+
+	// ensure the input pointers are not NULL
+	if (data == 0 || pixels == 0)
+		return E_INPUT_POINTER_NULL;
+
+	if (maxError > IMAGE_COMPRESSION_MAX_ERROR)
+		return E_PARAM_OUTOFBOUNDS;
+
+	bit_reader_t reader = { data, size, 0, 0, 0, 0 };
+	image_compression_context_t context;
+	contextReset(&context);
+
+	for (uint8_t i = 0; i < frames; i++) {
+		int error = decodeFrame(&reader, &context, maxError, &pixels[i * IMAGE_COMPRESSION_FRAME_SIZE]);
+		if (error != SUCCESS)
+			return error;
+	}
+
+	// every byte of the packet must have been used, and no more
+	if (reader.overrun || reader.position != size)
+		return E_GENERIC;
+
+	return SUCCESS;
+}
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Compress a frame, writing it after the bits already written.
+ *
+ * @param stopSize The number of whole bytes written at which to give up.
+ * @return 0 on success; E_GENERIC if given up on (the writer and context are then of no use).
+ */
+static int encodeFrame(bit_writer_t* writer, image_compression_context_t* context, uint8_t maxError,
+					   const uint8_t* pixels, uint16_t stopSize) {
+
+	// work on local copies, which the compiler can keep in registers
+	bit_writer_t w = *writer;
+	image_compression_context_t c = *context;
+	uint8_t i = 0;
+
+	// a compressed frame
+	writeBits(&w, 0, 1);
+
+	while (i < IMAGE_COMPRESSION_FRAME_SIZE) {
+
+		if (w.size >= stopSize)
+			return E_GENERIC;
+
+		// pixels matching their prediction once more are likely the start of a run
+		if (c.previousZero && riceParameter(&c) == 0) {
+			uint8_t run = 0;
+			while (i + run < IMAGE_COMPRESSION_FRAME_SIZE &&
+				   pixels[i + run] + maxError >= c.previous && pixels[i + run] <= c.previous + maxError)
+				run++;
+
+			i += run;
+			encodeRun(&w, &c, run, i == IMAGE_COMPRESSION_FRAME_SIZE);
+			if (i == IMAGE_COMPRESSION_FRAME_SIZE)
+				break;
+
+			// the pixel ending the run is known not to match its prediction
+			encodeValue(&w, &c, residualEncode(&c, pixels[i], maxError) - 1);
+			c.previousZero = 0;
+			i++;
+			continue;
+		}
+
+		uint8_t value = residualEncode(&c, pixels[i], maxError);
+		encodeValue(&w, &c, value);
+		c.previousZero = (value == 0);
+		i++;
+	}
+
+	*writer = w;
+	*context = c;
+	return SUCCESS;
+}
+
+
+/**
+ * Write a frame as it is, after the bits already written.
+ */
+static void encodeRawFrame(bit_writer_t* writer, image_compression_context_t* context, const uint8_t* pixels) {
+
+	// a frame held as it is
+	writeBits(writer, 1, 1);
+
+	for (uint8_t i = 0; i < IMAGE_COMPRESSION_FRAME_SIZE; i++)
+		writeBits(writer, pixels[i], 8);
+
+	context->previous = pixels[IMAGE_COMPRESSION_FRAME_SIZE - 1];
+	context->previousZero = 0;
+}
+
+
+/**
+ * Write a run of pixels matching their prediction: a 1 for every whole block of it, then a 0 and
+ * the rest of its length. A run reaching the end of the frame ends with a 1 for its last (partial)
+ * block instead.
+ */
+static void encodeRun(bit_writer_t* writer, image_compression_context_t* context, uint8_t run, uint8_t endOfFrame) {
+
+	while (run >= (1 << runBlockBits[context->runIndex])) {
+		writeBits(writer, 1, 1);
+		run -= (1 << runBlockBits[context->runIndex]);
+		if (context->runIndex < RUN_MAX_INDEX)
+			context->runIndex++;
+	}
+
+	if (endOfFrame) {
+		if (run > 0)
+			writeBits(writer, 1, 1);
+		return;
+	}
+
+	// a 0, then the rest of the run (fewer than a block)
+	writeBits(writer, run, 1 + runBlockBits[context->runIndex]);
+	if (context->runIndex > 0)
+		context->runIndex--;
+}
+
+
+/**
+ * Write a value with the Rice code of the current parameter: the value's upper bits in unary (a
+ * 1 for each, then a 0), then its lower bits. Values with too many upper bits are written out in
+ * full after the unary part instead.
+ */
+static void encodeValue(bit_writer_t* writer, image_compression_context_t* context, uint8_t value) {
+	uint8_t parameter = riceParameter(context);
+	uint8_t upper = value >> parameter;
+
+	if (upper < RICE_ESCAPE) {
+		uint32_t unary = ((1UL << upper) - 1) << (parameter + 1);
+		writeBits(writer, unary | (value & ((1U << parameter) - 1)), upper + 1 + parameter);
+	}
+	else {
+		writeBits(writer, (((1UL << RICE_ESCAPE) - 1) << 8) | value, RICE_ESCAPE + 8);
+	}
+
+	riceUpdate(context, value);
+}
+
+
+/**
+ * Write bits (highest bit first). Bytes beyond the room of the packet are only counted, so that
+ * the frame being written can be found not to fit.
+ *
+ * @param value The bits to write (lowest bits).
+ * @param count The number of bits to write (up to 24).
+ */
+static void writeBits(bit_writer_t* writer, uint32_t value, uint8_t count) {
+	writer->bits = (writer->bits << count) | value;
+	writer->bitCount += count;
+
+	while (writer->bitCount >= 8) {
+		writer->bitCount -= 8;
+
+		if (writer->size < IMAGE_COMPRESSION_MAX_SIZE)
+			writer->data[writer->size] = (uint8_t)(writer->bits >> writer->bitCount);
+
+		writer->size++;
+	}
+}
+
+
+/**
+ * Decompress the next frame of a packet (see @sa encodeFrame).
+ *
+ * @return 0 on success; E_GENERIC if the data is not a valid frame.
+ */
+static int decodeFrame(bit_reader_t* reader, image_compression_context_t* context, uint8_t maxError, uint8_t* pixels) {
+	uint8_t i = 0;
+
+	// a frame held as it is
+	if (readBits(reader, 1)) {
+		for (i = 0; i < IMAGE_COMPRESSION_FRAME_SIZE; i++)
+			pixels[i] = readBits(reader, 8);
+
+		context->previous = pixels[IMAGE_COMPRESSION_FRAME_SIZE - 1];
+		context->previousZero = 0;
+		return reader->overrun ? E_GENERIC : SUCCESS;
+	}
+
+	while (i < IMAGE_COMPRESSION_FRAME_SIZE && !reader->overrun) {
+
+		if (context->previousZero && riceParameter(context) == 0) {
+			uint8_t interrupted = 0;
+
+			while (i < IMAGE_COMPRESSION_FRAME_SIZE && !reader->overrun) {
+				uint8_t block = (uint8_t)(1 << runBlockBits[context->runIndex]);
+
+				if (readBits(reader, 1)) {
+					// a whole block, or the rest of the frame
+					uint8_t length = (block <= IMAGE_COMPRESSION_FRAME_SIZE - i) ? block : (IMAGE_COMPRESSION_FRAME_SIZE - i);
+					if (length == block && context->runIndex < RUN_MAX_INDEX)
+						context->runIndex++;
+
+					memset(&pixels[i], context->previous, length);
+					i += length;
+					continue;
+				}
+
+				uint8_t length = readBits(reader, runBlockBits[context->runIndex]);
+				if (length >= IMAGE_COMPRESSION_FRAME_SIZE - i)
+					return E_GENERIC;
+
+				memset(&pixels[i], context->previous, length);
+				i += length;
+				if (context->runIndex > 0)
+					context->runIndex--;
+
+				interrupted = 1;
+				break;
+			}
+
+			if (!interrupted)
+				break;
+
+			// the pixel ending the run
+			uint16_t value = decodeValue(reader, context) + 1;
+			if (value > 0xFF)
+				return E_GENERIC;
+
+			residualDecode(context, (uint8_t)value, maxError);
+			pixels[i++] = context->previous;
+			context->previousZero = 0;
+			continue;
+		}
+
+		uint8_t value = decodeValue(reader, context);
+		residualDecode(context, value, maxError);
+		pixels[i++] = context->previous;
+		context->previousZero = (value == 0);
+	}
+
+	return reader->overrun ? E_GENERIC : SUCCESS;
+}
+
+
+/**
+ * Read a value of the Rice code of the current parameter (see @sa encodeValue).
+ */
+static uint8_t decodeValue(bit_reader_t* reader, image_compression_context_t* context) {
+	uint8_t parameter = riceParameter(context);
+	uint8_t upper = 0;
+
+	while (upper < RICE_ESCAPE && readBits(reader, 1))
+		upper++;
+
+	uint8_t value = (upper < RICE_ESCAPE) ? (uint8_t)((upper << parameter) | readBits(reader, parameter)) : readBits(reader, 8);
+
+	riceUpdate(context, value);
+	return value;
+}
+
+
+/**
+ * Read bits from the packet (highest bit first). Reading beyond its end gives zeroes, and flags
+ * the reader as overrun.
+ *
+ * @param count The number of bits to read (up to 8).
+ * @return The bits read (lowest bits).
+ */
+static uint8_t readBits(bit_reader_t* reader, uint8_t count) {
+	while (reader->bitCount < count) {
+		if (reader->position < reader->size)
+			reader->bits = (reader->bits << 8) | reader->data[reader->position++];
+		else {
+			reader->bits <<= 8;
+			reader->overrun = 1;
+		}
+		reader->bitCount += 8;
+	}
+
+	reader->bitCount -= count;
+	return (uint8_t)((reader->bits >> reader->bitCount) & ((1U << count) - 1));
+}
+
+
+/**
+ * Start the prediction and coding of pixels afresh (at the start of a packet).
+ */
+static void contextReset(image_compression_context_t* context) {
+	context->previous = 0;
+	context->previousZero = 0;
+	context->runIndex = 0;
+	context->count = RICE_START_COUNT;
+	context->total = RICE_START_TOTAL;
+}
+
+
+/**
+ * Provide the Rice parameter for the next value: the fewest lower bits holding the average value.
+ */
+static uint8_t riceParameter(const image_compression_context_t* context) {
+	uint8_t parameter = 0;
+
+	while (((uint16_t)context->count << parameter) < context->total && parameter < RICE_MAX_PARAMETER)
+		parameter++;
+
+	return parameter;
+}
+
+
+/**
+ * Add a coded value to the totals of the Rice parameter (halved every so often, to follow recent values).
+ */
+static void riceUpdate(image_compression_context_t* context, uint8_t value) {
+	context->total += value;
+	context->count++;
+
+	if (context->count >= RICE_RESET_COUNT) {
+		context->total >>= 1;
+		context->count >>= 1;
+	}
+}
+
+
+/**
+ * Provide the coded value of a pixel's difference from its prediction, moving the prediction on
+ * to the pixel (as it is decoded).
+ *
+ * Without a largest error, differences wrap around (i.e. from 255 to 0 is a difference of 1).
+ * Otherwise, the difference is quantized to steps of (2 * maxError + 1). Coded values are then
+ * 0, -1, 1, -2, ... as 0, 1, 2, 3, ...
+ */
+static uint8_t residualEncode(image_compression_context_t* context, uint8_t pixel, uint8_t maxError) {
+	int16_t difference;
+
+	if (maxError == 0) {
+		difference = (int8_t)(uint8_t)(pixel - context->previous);
+		context->previous = pixel;
+	}
+	else {
+		int16_t step = 2 * maxError + 1;
+		difference = (int16_t)pixel - context->previous;
+		difference = (difference >= 0) ? ((difference + maxError) / step) : -((maxError - difference) / step);
+
+		int16_t decoded = context->previous + difference * step;
+		context->previous = (decoded < 0) ? 0 : ((decoded > 0xFF) ? 0xFF : (uint8_t)decoded);
+	}
+
+	return (difference >= 0) ? (uint8_t)(2 * difference) : (uint8_t)(-2 * difference - 1);
+}
+
+
+/**
+ * Move the prediction on to the pixel of a coded value (see @sa residualEncode).
+ */
+static void residualDecode(image_compression_context_t* context, uint8_t value, uint8_t maxError) {
+	int16_t difference = (value & 1) ? -(int16_t)((value + 1) >> 1) : (int16_t)(value >> 1);
+
+	if (maxError == 0) {
+		context->previous = (uint8_t)(context->previous + difference);
+	}
+	else {
+		int16_t decoded = context->previous + difference * (2 * maxError + 1);
+		context->previous = (decoded < 0) ? 0 : ((decoded > 0xFF) ? 0xFF : (uint8_t)decoded);
+	}
+}
@@ -0,0 +1,64 @@
+/**
+ * @file RImageCompression.h
+ * @date October 17, 2026
+ * @author
+ */
+
+#ifndef RIMAGECOMPRESSION_H_
+#define RIMAGECOMPRESSION_H_
+
+#include <stdint.h>
+
+
+/***************************************************************************************************
+                                            DEFINITIONS
+***************************************************************************************************/
+
+/** The pixels held by each image frame (one byte each; see FRAME_BYTES in RCamera.h). */
+#define IMAGE_COMPRESSION_FRAME_SIZE	(128)
+
+/** The max size (in bytes) of compressed data held by a single packet (see image_packet.data in RFileTransfer.options). */
+#define IMAGE_COMPRESSION_MAX_SIZE		(188)
+
+/** The most frames held by a single packet (see image_packet.frames in RFileTransfer.options). */
+#define IMAGE_COMPRESSION_MAX_FRAMES	(255)
+
+/** The largest error allowed of any pixel of lossy compressed frames. */
+#define IMAGE_COMPRESSION_MAX_ERROR		(32)
+
+
+/** The state of the prediction and coding of pixels; reset at the start of every packet. */
+typedef struct _image_compression_context_t {
+	uint8_t previous;		///< The previous pixel (as decoded); the prediction of the next one
+	uint8_t previousZero;	///< Whether the previous pixel matched its prediction
+	uint8_t runIndex;		///< The index of the current length of runs (see runBlockBits)
+	uint8_t count;			///< The number of pixels coded since the totals were last halved
+	uint16_t total;			///< The total of the coded values since the totals were last halved
+} image_compression_context_t;
+
+
+/** A packet of compressed image frames, being built a frame at a time (see @sa imageEncoderAddFrame). */
+typedef struct _image_encoder_t {
+	uint16_t firstFrame;	///< The index of the first frame held by the packet
+	uint8_t frames;			///< The number of frames held by the packet
+	uint8_t maxError;		///< The largest error allowed of any pixel; 0 for lossless compression
+	uint8_t size;			///< The number of whole bytes written to data
+	uint8_t bitCount;		///< The number of bits written but not yet stored in data
+	uint32_t bits;			///< The bits written but not yet stored in data (lowest bits)
+	image_compression_context_t context;
+	uint8_t data[IMAGE_COMPRESSION_MAX_SIZE];
+} image_encoder_t;
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+void imageEncoderStart(image_encoder_t* encoder, uint16_t firstFrame, uint8_t maxError);
+int imageEncoderAddFrame(image_encoder_t* encoder, const uint8_t* pixels);
+uint8_t imageEncoderFinish(image_encoder_t* encoder);
+
+int imageDecode(const uint8_t* data, uint8_t size, uint8_t frames, uint8_t maxError, uint8_t* pixels);
+
+
+#endif /* RIMAGECOMPRESSION_H_ */
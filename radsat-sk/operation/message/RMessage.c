@@ -1,103 +1,333 @@
-/**
- * @file RMessage.h
- * @date February 20, 2022
- * @author Tyrel Kostyk (tck290)
- * Last edited 27 July 2022 by Brian Pitzel
- */
-
-#include <RMessage.h>
-#include <RCommon.h>
-#include <RXorCipher.h>
-#include <hal/Timing/Time.h>
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-/**
- * Wrap a raw RADSAT-SK message, preparing it for downlink.
- *
- * This function will serialize the message with NanoPB Protobuf encoding, populate and prepend
- * a message header, and generate a CRC of the message.
- *
- * @param rawMessage The raw RADSAT-SK message, including all desired data to be downlinked.
- * @param wrappedMessage The final wrapped message. Filled by function.
- * @return The total size of the message, including the header. 0 on failure.
- */
-uint8_t messageWrap(radsat_message* rawMessage, uint8_t* wrappedMessage) {
-
-	// ensure the input pointers are not NULL
-	if (rawMessage == 0 || wrappedMessage == 0)
-		return 0;
-
-	// serialize the raw message with NanoPB Protobuf encoding
-	uint8_t encodedSize = protoEncode(rawMessage, &wrappedMessage[RADSAT_SK_HEADER_SIZE]);
-	if (encodedSize == 0)
-		return 0;
-
-	// populate the message header
-	radsat_sk_header_t *header = (radsat_sk_header_t *)wrappedMessage;
-	header->preamble = RADSAT_SK_MESSAGE_PREAMBLE;
-	header->size = (uint8_t) encodedSize;
-	int error = Time_getUnixEpoch((unsigned int *)&(header->timestamp));
-	if (error != SUCCESS) {
-		errorReportComponent(componentHalTime, error);
-		return 0;
-	}
-
-	// calculate the CRC of entire message (except for preamble and crc itself)
-	header->crc = crcFast(&wrappedMessage[RADSAT_SK_HEADER_CRC_OFFSET],
-						  (int)(header->size + RADSAT_SK_HEADER_SIZE - RADSAT_SK_HEADER_CRC_OFFSET));
-
-	return header->size + RADSAT_SK_HEADER_SIZE;
-}
-
-
-/**
- * Unwrap a message, extracting its contents after being uplinked.
- *
- * This message decrypts the message using a simple XOR Cipher, extracts and validates the data
- * found in the message header (including the CRC), and then deserializes the message with NanoPB
- * Protobuf encoding.
- *
- * @param wrappedMessage The message to unwrap.
- * @param size The size of the full message buffer.
- * @param rawMessage The final extracted message. Filled by function.
- * @return The size of the message, not including the header. 0 on failure.
- */
-uint8_t messageUnwrap(uint8_t* wrappedMessage, uint8_t size, radsat_message* rawMessage) {
-
-	// ensure the input pointers are not NULL
-	if (wrappedMessage == 0 || rawMessage == 0)
-		return 0;
-
-	// decrypt entire message
-	int error = xorDecrypt(wrappedMessage, size);
-	if (error)
-		return 0;
-
-	// access the message header; obtain size, confirm preamble and CRC
-	radsat_sk_header_t *header = (radsat_sk_header_t *)wrappedMessage;
-
-	// confirm preamble
-	if (header->preamble != RADSAT_SK_MESSAGE_PREAMBLE)
-		return 0;
-
-	// locally calculate the CRC of the entire message (except for preamble and crc itself)
-	crc_t localCrc = crcFast(&wrappedMessage[RADSAT_SK_HEADER_CRC_OFFSET],
-							 (int)(size - RADSAT_SK_HEADER_CRC_OFFSET));
-
-	// confirm locally-calculated CRC with the one sent with the message header
-	if (header->crc != localCrc)
-		return 0;
-
-	// deserialize the encoded message with NanoPB Protobuf decoding
-	error = protoDecode(&wrappedMessage[RADSAT_SK_HEADER_SIZE], header->size, rawMessage);
-	if (error)
-		return 0;
-
-	// return the size of the message itself
-	return header->size;
-}
-
+/**
+ * @file RMessage.h
+ * @date February 20, 2022
+ * @author Tyrel Kostyk (tck290)
+ * Last edited 27 July 2022 by Brian Pitzel
+ */
+
+#include <RMessage.h>
+#include <RCommon.h>
+#include <RXorCipher.h>
+#include <pb_direct.h>
+#include <string.h>
+#include <hal/Timing/Time.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** The number of bytes decrypted and then checked (CRC) at a time when unwrapping a message. */
+#define UNWRAP_BLOCK_SIZE	((uint16_t)32)
+
+/** How long the time is kept up from the tick count before it is read from the RTC again (ms). */
+#define TIME_RESYNC_MS		((portTickType)(60*1000))
+
+/** The time last read from the RTC, kept up from the tick count in between (see @sa messageTime). */
+typedef struct _message_time_t {
+	uint8_t valid;			///> Whether the time has been read
+	uint32_t epoch;			///> The time read (seconds since Unix Epoch)
+	portTickType tick;		///> The tick count when the time was read
+} message_time_t;
+
+/** The time last read from the RTC. */
+static message_time_t cachedTime = { 0 };
+
+/** Whether downlinked messages are given compact headers (see @sa messageCompactHeaders). */
+static uint8_t compactHeaders = 0;
+
+/** The time that the timestamps of compact headers are relative to (seconds since Unix Epoch). */
+static uint32_t compactBaseTime = 0;
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static int messageTime(uint32_t* time);
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+/**
+ * Wrap a raw RADSAT-SK message, preparing it for downlink.
+ *
+ * This function will serialize the message with NanoPB Protobuf encoding, populate and prepend
+ * a message header, and generate a CRC of the message.
+ *
+ * @param rawMessage The raw RADSAT-SK message, including all desired data to be downlinked.
+ * @param wrappedMessage The final wrapped message. Filled by function.
+ * @return The total size of the message, including the header. 0 on failure.
+ */
+uint8_t messageWrap(radsat_message* rawMessage, uint8_t* wrappedMessage) {
+
+	// ensure the input pointers are not NULL
+	if (rawMessage == 0 || wrappedMessage == 0)
+		return 0;
+
+	// serialize the raw message with NanoPB Protobuf encoding
+	uint8_t encodedSize = protoEncode(rawMessage, &wrappedMessage[RADSAT_SK_HEADER_SIZE]);
+	if (encodedSize == 0)
+		return 0;
+
+	return messageWrapEncoded(wrappedMessage, encodedSize);
+}
+
+
+/**
+ * Wrap a single service message in place, preparing it for downlink.
+ *
+ * Unlike messageWrap, no radsat_message needs to be populated: the message is encoded straight from
+ * its own struct into the buffer (after the room left for the header), and the header is then
+ * filled in around it.
+ *
+ * @param serviceTag The tag of the service the message belongs to (e.g. radsat_message_FileTransferMessage_tag).
+ * @param messageTag The tag of the message within its service.
+ * @param message The raw message struct, including all desired data to be downlinked.
+ * @param wrappedMessage The final wrapped message; must hold RADSAT_SK_MAX_MESSAGE_SIZE bytes. Filled by function.
+ * @return The total size of the message, including the header. 0 on failure.
+ */
+uint8_t messageWrapInPlace(uint16_t serviceTag, uint16_t messageTag, const void* message, uint8_t* wrappedMessage) {
+
+	// ensure the input pointers are not NULL
+	if (message == 0 || wrappedMessage == 0)
+		return 0;
+
+	// serialize the message with NanoPB Protobuf encoding, directly behind the header
+	uint8_t encodedSize = protoEncodeMessage(serviceTag, messageTag, message,
+											 &wrappedMessage[RADSAT_SK_HEADER_SIZE], (uint8_t)PROTO_MAX_ENCODED_SIZE);
+	if (encodedSize == 0)
+		return 0;
+
+	return messageWrapEncoded(wrappedMessage, encodedSize);
+}
+
+
+/**
+ * Wrap already encoded message(s), preparing them for downlink.
+ *
+ * The encoded data must already be in place, immediately after the room left for the header. Used
+ * to wrap several encoded messages packed together under a single header.
+ *
+ * @param wrappedMessage The buffer holding the encoded data after the header. Header set by function.
+ * @param encodedSize The size of the encoded data (NOT including the header).
+ * @return The total size of the message, including the header. 0 on failure.
+ */
+uint8_t messageWrapEncoded(uint8_t* wrappedMessage, uint8_t encodedSize) {
+
+	// ensure the input pointer is not NULL
+	if (wrappedMessage == 0 || encodedSize == 0)
+		return 0;
+
+	// populate the message header
+	radsat_sk_header_t *header = (radsat_sk_header_t *)wrappedMessage;
+	header->preamble = RADSAT_SK_MESSAGE_PREAMBLE;
+	header->size = (uint8_t) encodedSize;
+	uint32_t timestamp = 0;
+	int error = messageTime(&timestamp);
+	if (error != SUCCESS) {
+		errorReportComponent(componentHalTime, error);
+		return 0;
+	}
+	header->timestamp = timestamp;
+
+	// calculate the CRC of entire message (except for preamble and crc itself)
+	header->crc = crcFast(&wrappedMessage[RADSAT_SK_HEADER_CRC_OFFSET],
+						  (int)(header->size + RADSAT_SK_HEADER_SIZE - RADSAT_SK_HEADER_CRC_OFFSET));
+
+	return header->size + RADSAT_SK_HEADER_SIZE;
+}
+
+
+/**
+ * Unwrap a message, extracting its contents after being uplinked.
+ *
+ * This message decrypts the message using a simple XOR Cipher, extracts and validates the data
+ * found in the message header (including the CRC), and then deserializes the message with NanoPB
+ * Protobuf encoding.
+ *
+ * The header is decrypted and checked first, so that junk frames are rejected without touching the
+ * rest of the buffer; the remainder is then decrypted and checked in a single pass, a block at a time.
+ *
+ * @param wrappedMessage The message to unwrap.
+ * @param size The size of the full message buffer.
+ * @param rawMessage The final extracted message. Filled by function.
+ * @return The size of the message, not including the header. 0 on failure.
+ */
+uint8_t messageUnwrap(uint8_t* wrappedMessage, uint8_t size, radsat_message* rawMessage) {
+
+	// ensure the input pointers are not NULL
+	if (wrappedMessage == 0 || rawMessage == 0)
+		return 0;
+
+	// ensure there is room for a header
+	if (size < RADSAT_SK_HEADER_SIZE)
+		return 0;
+
+	// grab the key; fail if key is invalid
+	xor_cipher_t cipher;
+	int error = xorBegin(&cipher);
+	if (error)
+		return 0;
+
+	// decrypt the message header alone
+	xorUpdate(&cipher, wrappedMessage, RADSAT_SK_HEADER_SIZE);
+
+	// access the message header; obtain size, confirm preamble and CRC
+	radsat_sk_header_t *header = (radsat_sk_header_t *)wrappedMessage;
+
+	// confirm preamble
+	if (header->preamble != RADSAT_SK_MESSAGE_PREAMBLE)
+		return 0;
+
+	// confirm that the message fills the buffer exactly (anything else fails the CRC)
+	if (header->size == 0 || header->size != size - RADSAT_SK_HEADER_SIZE)
+		return 0;
+
+	// calculate the CRC of the rest of the header (except for preamble and crc itself)
+	crc_t localCrc = crcUpdate(crcBegin(), &wrappedMessage[RADSAT_SK_HEADER_CRC_OFFSET],
+							   (int)(RADSAT_SK_HEADER_SIZE - RADSAT_SK_HEADER_CRC_OFFSET));
+
+	// decrypt the encoded message and include it in the CRC, while each block is still at hand
+	for (uint16_t offset = RADSAT_SK_HEADER_SIZE; offset < size; offset += UNWRAP_BLOCK_SIZE) {
+		uint16_t blockSize = (size - offset < UNWRAP_BLOCK_SIZE) ? (size - offset) : UNWRAP_BLOCK_SIZE;
+		xorUpdate(&cipher, &wrappedMessage[offset], blockSize);
+		localCrc = crcUpdate(localCrc, &wrappedMessage[offset], (int)blockSize);
+	}
+
+	// confirm locally-calculated CRC with the one sent with the message header
+	if (header->crc != crcEnd(localCrc))
+		return 0;
+
+	// deserialize the encoded message with NanoPB Protobuf decoding
+	error = protoDecode(&wrappedMessage[RADSAT_SK_HEADER_SIZE], header->size, rawMessage);
+	if (error)
+		return 0;
+
+	// return the size of the message itself
+	return header->size;
+}
+
+
+/**
+ * Set whether downlinked messages are given compact headers (see @sa messageCompact).
+ *
+ * Compact headers are asked for by the Ground Station when beginning a pass, and last until the end of it.
+ *
+ * @param enabled 1 (true) to give downlinked messages compact headers; 0 (false) for full headers.
+ * @param baseTime The time that the timestamps of compact headers are relative to (seconds since Unix Epoch).
+ */
+void messageCompactHeaders(uint8_t enabled, uint32_t baseTime) {
+	compactHeaders = enabled;
+	compactBaseTime = baseTime;
+}
+
+
+/**
+ * Replace the full header of a wrapped message with a compact header, if the Ground Station asked for them.
+ *
+ * The compact header keeps the size and CRC, drops the preamble down to a single byte, and gives the
+ * timestamp as a varint relative to the Ground Station's base time: 5 to 9 bytes rather than 9. The
+ * message is moved up behind it, within the same buffer.
+ *
+ * @param wrappedMessage The wrapped message (see @sa messageWrapEncoded). Compacted by function.
+ * @param size The total size of the wrapped message, including the header.
+ * @return The total size of the message, including the (compact) header. 0 on failure.
+ */
+uint8_t messageCompact(uint8_t* wrappedMessage, uint8_t size) {
+
+	// ensure the input pointer is not NULL
+	if (wrappedMessage == 0)
+		return 0;
+
+	// full headers are kept unless asked otherwise
+	if (!compactHeaders)
+		return size;
+
+	// ensure this is a wrapped message
+	radsat_sk_header_t* header = (radsat_sk_header_t*)wrappedMessage;
+	if (size <= RADSAT_SK_HEADER_SIZE || header->preamble != RADSAT_SK_MESSAGE_PREAMBLE || header->size != size - RADSAT_SK_HEADER_SIZE)
+		return 0;
+
+	uint8_t messageSize = header->size;
+
+	// the timestamp, as a zig-zag varint of its difference from the base time
+	int32_t difference = (int32_t)(header->timestamp - compactBaseTime);
+	uint32_t zigzag = ((uint32_t)difference << 1) ^ (uint32_t)(difference >> 31);
+	uint8_t timestamp[RADSAT_SK_COMPACT_HEADER_MAX_SIZE - sizeof(radsat_sk_compact_header_t)];
+	uint8_t timestampSize = (uint8_t)(pb_direct_put_varint(timestamp, zigzag) - timestamp);
+	uint8_t headerSize = (uint8_t)(sizeof(radsat_sk_compact_header_t) + timestampSize);
+
+	// move the message up behind the compact header (never larger than the full header)
+	memmove(&wrappedMessage[headerSize], &wrappedMessage[RADSAT_SK_HEADER_SIZE], messageSize);
+	memcpy(&wrappedMessage[sizeof(radsat_sk_compact_header_t)], timestamp, timestampSize);
+
+	radsat_sk_compact_header_t* compact = (radsat_sk_compact_header_t*)wrappedMessage;
+	compact->type = RADSAT_SK_COMPACT_HEADER_TYPE;
+	compact->size = messageSize;
+
+	// calculate the CRC of entire message (except for type and crc itself)
+	compact->crc = crcFast(&wrappedMessage[RADSAT_SK_COMPACT_HEADER_CRC_OFFSET],
+						   (int)(headerSize + messageSize - RADSAT_SK_COMPACT_HEADER_CRC_OFFSET));
+
+	return headerSize + messageSize;
+}
+
+
+/**
+ * Have the next message read the time from the RTC again (i.e. after the time has been updated).
+ */
+void messageTimeResync(void) {
+	taskENTER_CRITICAL();
+	cachedTime.valid = 0;
+	taskEXIT_CRITICAL();
+}
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Provide the current time, for message headers.
+ *
+ * The RTC is only read once in a while (see TIME_RESYNC_MS); the time is kept up from the tick count
+ * in between, so that wrapping messages back to back does not call into the RTC driver every time.
+ *
+ * @param time The current time (seconds since Unix Epoch). Set by function.
+ * @return 0 on success, otherwise see hal/errors.h.
+ */
+static int messageTime(uint32_t* time) {
+
+	portTickType now = xTaskGetTickCount();
+
+	taskENTER_CRITICAL();
+	message_time_t cached = cachedTime;
+	taskEXIT_CRITICAL();
+
+	// read the RTC again when due
+	if (!cached.valid || (now - cached.tick) >= (TIME_RESYNC_MS / portTICK_RATE_MS)) {
+		unsigned int epoch = 0;
+		int error = Time_getUnixEpoch(&epoch);
+		if (error != SUCCESS)
+			return error;
+
+		cached.valid = 1;
+		cached.epoch = epoch;
+		cached.tick = now;
+
+		taskENTER_CRITICAL();
+		cachedTime = cached;
+		taskEXIT_CRITICAL();
+	}
+
+	// whole seconds since the RTC was read; never ahead of the RTC itself
+	*time = cached.epoch + (uint32_t)(((now - cached.tick) * portTICK_RATE_MS) / 1000);
+
+	return SUCCESS;
+}
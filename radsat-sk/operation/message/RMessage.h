@@ -1,48 +1,74 @@
-/**
- * @file RMessage.h
- * @date February 20, 2022
- * @author Tyrel Kostyk (tck290)
- */
-
-#ifndef RMESSAGE_H_
-#define RMESSAGE_H_
-
-#include <stdint.h>
-#include <crc.h>
-#include <RProtobuf.h>
-
-
-/***************************************************************************************************
-                                             DEFINITIONS
-***************************************************************************************************/
-
-/** Header that will precede all RADSAT-SK messages. */
-typedef struct __attribute__((packed)) _radsat_sk_header_t {
-	uint16_t preamble;		///> A hardcoded tag that identifies the start of a RADSAT-SK message
-	crc_t crc;				///> Cyclical Redundancy Check of all of the following bytes
-	uint8_t size;			///> The size of the message in bytes (NOT including the header)
-	uint32_t timestamp;		///> The time (in seconds since Unix Epoch) that the message was formatted
-} radsat_sk_header_t;
-
-/** The hardcoded preamble that will begin every RADSAT-SK message. The starting year of the RADSAT-SK Project*/
-#define RADSAT_SK_MESSAGE_PREAMBLE	(0x2018)
-
-/** The size of the RADSAT-SK message header. */
-#define RADSAT_SK_HEADER_SIZE	(sizeof(radsat_sk_header_t))
-
-/** The offset of the CRC start location within the RADSAT-SK Message Header. */
-#define RADSAT_SK_HEADER_CRC_OFFSET	(sizeof(((radsat_sk_header_t*)0)->preamble)+sizeof(((radsat_sk_header_t*)0)->crc))
-
-/** The maximum size of a RADSAT-SK message (including the message header and all other overhead). */
-#define RADSAT_SK_MAX_MESSAGE_SIZE	((uint16_t)((PROTO_MAX_ENCODED_SIZE)+(RADSAT_SK_HEADER_SIZE)))
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-uint8_t messageWrap(radsat_message* rawMessage, uint8_t* wrappedMessage);
-uint8_t messageUnwrap(uint8_t* wrappedMessage, uint8_t size, radsat_message* rawMessage);
-
-
-#endif /* RMESSAGE_H_ */
+/**
+ * @file RMessage.h
+ * @date February 20, 2022
+ * @author Tyrel Kostyk (tck290)
+ */
+
+#ifndef RMESSAGE_H_
+#define RMESSAGE_H_
+
+#include <stdint.h>
+#include <crc.h>
+#include <RProtobuf.h>
+
+
+/***************************************************************************************************
+                                             DEFINITIONS
+***************************************************************************************************/
+
+/** Header that will precede all RADSAT-SK messages. */
+typedef struct __attribute__((packed)) _radsat_sk_header_t {
+	uint16_t preamble;		///> A hardcoded tag that identifies the start of a RADSAT-SK message
+	crc_t crc;				///> Cyclical Redundancy Check of all of the following bytes
+	uint8_t size;			///> The size of the message in bytes (NOT including the header)
+	uint32_t timestamp;		///> The time (in seconds since Unix Epoch) that the message was formatted
+} radsat_sk_header_t;
+
+/** The hardcoded preamble that will begin every RADSAT-SK message. The starting year of the RADSAT-SK Project*/
+#define RADSAT_SK_MESSAGE_PREAMBLE	(0x2018)
+
+/** The size of the RADSAT-SK message header. */
+#define RADSAT_SK_HEADER_SIZE	(sizeof(radsat_sk_header_t))
+
+/** The offset of the CRC start location within the RADSAT-SK Message Header. */
+#define RADSAT_SK_HEADER_CRC_OFFSET	(sizeof(((radsat_sk_header_t*)0)->preamble)+sizeof(((radsat_sk_header_t*)0)->crc))
+
+/** The maximum size of a RADSAT-SK message (including the message header and all other overhead). */
+#define RADSAT_SK_MAX_MESSAGE_SIZE	((uint16_t)((PROTO_MAX_ENCODED_SIZE)+(RADSAT_SK_HEADER_SIZE)))
+
+/**
+ * Compact header, used in place of the full header on downlinked messages for the rest of a pass once
+ * the Ground Station asks for it (see @sa messageCompactHeaders). It is followed by the timestamp, as
+ * a zig-zag varint of its difference (in seconds) from the base time given by the Ground Station.
+ */
+typedef struct __attribute__((packed)) _radsat_sk_compact_header_t {
+	uint8_t type;			///> RADSAT_SK_COMPACT_HEADER_TYPE; tells it apart from the first byte of a full header
+	crc_t crc;				///> Cyclical Redundancy Check of all of the following bytes (including the timestamp)
+	uint8_t size;			///> The size of the message in bytes (NOT including the header)
+} radsat_sk_compact_header_t;
+
+/** The first byte of a compact header: the first byte of the preamble, with its low bit (the compact flag) set. */
+#define RADSAT_SK_COMPACT_HEADER_TYPE	((uint8_t)((RADSAT_SK_MESSAGE_PREAMBLE & 0xFF) | 0x01))
+
+/** The offset of the CRC start location within the compact header. */
+#define RADSAT_SK_COMPACT_HEADER_CRC_OFFSET	(sizeof(((radsat_sk_compact_header_t*)0)->type)+sizeof(((radsat_sk_compact_header_t*)0)->crc))
+
+/** The maximum size of the compact header, including its timestamp (a varint of up to 5 bytes). */
+#define RADSAT_SK_COMPACT_HEADER_MAX_SIZE	(sizeof(radsat_sk_compact_header_t) + 5)
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+uint8_t messageWrap(radsat_message* rawMessage, uint8_t* wrappedMessage);
+uint8_t messageWrapInPlace(uint16_t serviceTag, uint16_t messageTag, const void* message, uint8_t* wrappedMessage);
+uint8_t messageWrapEncoded(uint8_t* wrappedMessage, uint8_t encodedSize);
+uint8_t messageUnwrap(uint8_t* wrappedMessage, uint8_t size, radsat_message* rawMessage);
+
+void messageCompactHeaders(uint8_t enabled, uint32_t baseTime);
+uint8_t messageCompact(uint8_t* wrappedMessage, uint8_t size);
+void messageTimeResync(void);
+
+
+#endif /* RMESSAGE_H_ */
@@ -0,0 +1,339 @@
+/**
+ * @file RReedSolomon.c
+ * @date October 17, 2026
+ * @author
+ *
+ * Forward error correction of downlinked frames. When asked for by the Ground Station, every frame
+ * is sent with Reed-Solomon parity bytes appended (a shortened code over GF(256), with the
+ * primitive polynomial 0x11D and the roots a^0 ... a^(n-1) of its generator). A frame damaged on
+ * its way down is repaired by the Ground Station, instead of costing a NACK and a resend; a frame
+ * with more damaged bytes than can be repaired is simply rejected by its CRC, as before.
+ */
+
+#include <RReedSolomon.h>
+#include <RCommon.h>
+#include <hal/errors.h>
+#include <string.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** The primitive polynomial of the field (x^8 + x^4 + x^3 + x^2 + 1). */
+#define GF_POLYNOMIAL	(0x11D)
+
+/** Logarithm of 0; it has none, and is never looked up. */
+#define GF_LOG_ZERO		(0xFF)
+
+/** Powers of the primitive element (twice over, so that the sum of two logarithms needs no modulo). */
+static uint8_t gfExp[2 * 255];
+
+/** Logarithms of the field elements. */
+static uint8_t gfLog[256];
+
+/** Whether the tables of the field have been built. */
+static uint8_t gfReady = 0;
+
+/** The number of parity bytes appended to each downlinked frame, as asked for by the Ground Station. */
+static uint8_t paritySize = 0;
+
+/** The logarithms of the coefficients of the generator polynomial (below x^paritySize) for the current parity size. */
+static uint8_t generatorLog[RS_MAX_PARITY_SIZE];
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static void gfInit(void);
+static uint8_t gfMultiply(uint8_t a, uint8_t b);
+static uint8_t gfDivide(uint8_t a, uint8_t b);
+static uint8_t gfEvaluate(const uint8_t* polynomial, uint8_t degree, uint8_t x);
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+/**
+ * Set the number of parity bytes appended to each downlinked frame.
+ *
+ * Asked for by the Ground Station when beginning a pass, and lasts until the end of it. Up to half
+ * as many damaged bytes of each frame can then be repaired.
+ *
+ * @param size The number of parity bytes (limited to RS_MAX_PARITY_SIZE); 0 for none.
+ */
+void rsConfigure(uint32_t size) {
+
+	if (size > RS_MAX_PARITY_SIZE)
+		size = RS_MAX_PARITY_SIZE;
+
+	gfInit();
+
+	// the generator polynomial: (x - a^0)(x - a^1) ... (x - a^(size-1)), lowest coefficient first
+	uint8_t generator[RS_MAX_PARITY_SIZE + 1] = { 1 };
+	for (uint8_t i = 0; i < size; i++) {
+		for (uint8_t j = i + 1; j > 0; j--)
+			generator[j] = generator[j - 1] ^ gfMultiply(generator[j], gfExp[i]);
+		generator[0] = gfMultiply(generator[0], gfExp[i]);
+	}
+
+	for (uint8_t i = 0; i < size; i++)
+		generatorLog[i] = (generator[i] != 0) ? gfLog[generator[i]] : GF_LOG_ZERO;
+
+	paritySize = (uint8_t)size;
+}
+
+
+/**
+ * Provide the number of parity bytes appended to each downlinked frame.
+ *
+ * @return The number of parity bytes; 0 if frames are sent without any.
+ */
+uint8_t rsParitySize(void) {
+	return paritySize;
+}
+
+
+/**
+ * Append the parity bytes to a frame (see @sa rsConfigure).
+ *
+ * @param frame The frame; must have room for the parity bytes after it. Modified by function.
+ * @param size The size of the frame (in bytes).
+ * @return The size of the frame, including the parity bytes; 0 on failure.
+ */
+uint8_t rsEncode(uint8_t* frame, uint8_t size) {
+
+	// ensure the input pointer is not NULL
+	if (frame == 0)
+		return 0;
+
+	if (paritySize == 0)
+		return size;
+
+	if ((uint16_t)size + paritySize > 255)
+		return 0;
+
+	// the remainder of the frame divided by the generator polynomial (highest coefficient first)
+	uint8_t* parity = &frame[size];
+	memset(parity, 0, paritySize);
+
+	for (uint8_t i = 0; i < size; i++) {
+		uint8_t feedback = frame[i] ^ parity[0];
+
+		// shift the remainder up, adding the feedback times the generator polynomial
+		if (feedback == 0) {
+			memmove(&parity[0], &parity[1], paritySize - 1);
+			parity[paritySize - 1] = 0;
+			continue;
+		}
+
+		uint8_t feedbackLog = gfLog[feedback];
+		for (uint8_t j = 0; j < paritySize; j++) {
+			uint8_t next = (j + 1 < paritySize) ? parity[j + 1] : 0;
+			uint8_t coefficientLog = generatorLog[paritySize - 1 - j];
+			parity[j] = (coefficientLog != GF_LOG_ZERO) ? (next ^ gfExp[feedbackLog + coefficientLog]) : next;
+		}
+	}
+
+	return (uint8_t)(size + paritySize);
+}
+
+
+/**
+ * Repair a received frame, in place, from its parity bytes (Ground Station).
+ *
+ * @param frame The frame, including its parity bytes. Modified by function.
+ * @param size The size of the frame, including its parity bytes (in bytes).
+ * @param parity The number of parity bytes at the end of the frame.
+ * @return The number of bytes repaired (0 if the frame was intact); a negative error if it could not be repaired.
+ */
+int rsDecode(uint8_t* frame, uint8_t size, uint8_t parity) {
+
+	// ensure the input pointer is not NULL
+	if (frame == 0)
+		return E_INPUT_POINTER_NULL;
+
+	if (parity == 0)
+		return 0;
+
+	if (parity > RS_MAX_PARITY_SIZE || size <= parity)
+		return E_PARAM_OUTOFBOUNDS;
+
+	gfInit();
+
+	// syndromes: the frame evaluated at each root of the generator polynomial
+	uint8_t syndromes[RS_MAX_PARITY_SIZE];
+	uint8_t damaged = 0;
+	for (uint8_t i = 0; i < parity; i++) {
+		uint8_t syndrome = 0;
+		for (uint8_t j = 0; j < size; j++)
+			syndrome = gfMultiply(syndrome, gfExp[i]) ^ frame[j];
+
+		syndromes[i] = syndrome;
+		damaged |= syndrome;
+	}
+
+	if (damaged == 0)
+		return 0;
+
+	// error locator polynomial (Berlekamp-Massey), lowest coefficient first
+	uint8_t locator[RS_MAX_PARITY_SIZE + 1] = { 1 };
+	uint8_t previous[RS_MAX_PARITY_SIZE + 1] = { 1 };
+	uint8_t errors = 0;
+	uint8_t shift = 1;
+	uint8_t previousDiscrepancy = 1;
+
+	for (uint8_t r = 0; r < parity; r++) {
+		uint8_t discrepancy = syndromes[r];
+		for (uint8_t i = 1; i <= errors; i++)
+			discrepancy ^= gfMultiply(locator[i], syndromes[r - i]);
+
+		if (discrepancy == 0) {
+			shift++;
+			continue;
+		}
+
+		uint8_t scale = gfDivide(discrepancy, previousDiscrepancy);
+		uint8_t updated[RS_MAX_PARITY_SIZE + 1];
+		memcpy(updated, locator, sizeof(updated));
+		for (uint8_t i = 0; i + shift <= RS_MAX_PARITY_SIZE; i++)
+			updated[i + shift] ^= gfMultiply(scale, previous[i]);
+
+		if (2 * errors <= r) {
+			memcpy(previous, locator, sizeof(previous));
+			errors = r + 1 - errors;
+			previousDiscrepancy = discrepancy;
+			shift = 1;
+		}
+		else {
+			shift++;
+		}
+
+		memcpy(locator, updated, sizeof(locator));
+	}
+
+	if (2 * errors > parity)
+		return E_GENERIC;
+
+	// error evaluator polynomial: syndromes * locator (mod x^parity)
+	uint8_t evaluator[RS_MAX_PARITY_SIZE] = { 0 };
+	for (uint8_t i = 0; i < parity; i++) {
+		for (uint8_t j = 0; j <= i && j <= errors; j++)
+			evaluator[i] ^= gfMultiply(syndromes[i - j], locator[j]);
+	}
+
+	// find the damaged bytes (Chien search), and their errors (Forney)
+	uint8_t positions[RS_MAX_PARITY_SIZE / 2];
+	uint8_t values[RS_MAX_PARITY_SIZE / 2];
+	uint8_t found = 0;
+
+	for (uint8_t i = 0; i < size; i++) {
+
+		// the byte i sits at the power (size - 1 - i) of the frame; its locator is a^(size-1-i)
+		uint8_t power = (uint8_t)(size - 1 - i);
+		uint8_t inverse = gfExp[(255 - power) % 255];
+		if (gfEvaluate(locator, errors, inverse) != 0)
+			continue;
+
+		if (found >= errors)
+			return E_GENERIC;
+
+		// derivative of the locator (only its odd terms remain in GF(2^8))
+		uint8_t derivative = 0;
+		for (uint8_t j = 1; j <= errors; j += 2)
+			derivative ^= gfMultiply(locator[j], (j > 1) ? gfExp[(gfLog[inverse] * (j - 1)) % 255] : 1);
+
+		if (derivative == 0)
+			return E_GENERIC;
+
+		uint8_t magnitude = gfMultiply(gfExp[power], gfEvaluate(evaluator, parity - 1, inverse));
+		positions[found] = i;
+		values[found] = gfDivide(magnitude, derivative);
+		found++;
+	}
+
+	// every root of the locator must lie within the frame
+	if (found != errors)
+		return E_GENERIC;
+
+	for (uint8_t i = 0; i < found; i++)
+		frame[positions[i]] ^= values[i];
+
+	return found;
+}
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Build the tables of the field (once).
+ */
+static void gfInit(void) {
+
+	if (gfReady)
+		return;
+
+	uint16_t element = 1;
+	for (uint16_t i = 0; i < 255; i++) {
+		gfExp[i] = (uint8_t)element;
+		gfExp[i + 255] = (uint8_t)element;
+		gfLog[element] = (uint8_t)i;
+
+		element <<= 1;
+		if (element & 0x100)
+			element ^= GF_POLYNOMIAL;
+	}
+	gfLog[0] = GF_LOG_ZERO;
+
+	gfReady = 1;
+}
+
+
+/**
+ * Multiply two elements of the field.
+ *
+ * @return The product.
+ */
+static uint8_t gfMultiply(uint8_t a, uint8_t b) {
+	if (a == 0 || b == 0)
+		return 0;
+
+	return gfExp[gfLog[a] + gfLog[b]];
+}
+
+
+/**
+ * Divide two elements of the field.
+ *
+ * @param a The dividend.
+ * @param b The divisor; must not be 0.
+ * @return The quotient.
+ */
+static uint8_t gfDivide(uint8_t a, uint8_t b) {
+	if (a == 0 || b == 0)
+		return 0;
+
+	return gfExp[gfLog[a] + 255 - gfLog[b]];
+}
+
+
+/**
+ * Evaluate a polynomial (lowest coefficient first) at an element of the field.
+ *
+ * @param polynomial The coefficients of the polynomial.
+ * @param degree The degree of the polynomial.
+ * @param x The element.
+ * @return The value of the polynomial.
+ */
+static uint8_t gfEvaluate(const uint8_t* polynomial, uint8_t degree, uint8_t x) {
+	uint8_t value = polynomial[degree];
+
+	for (uint8_t i = degree; i > 0; i--)
+		value = gfMultiply(value, x) ^ polynomial[i - 1];
+
+	return value;
+}
@@ -0,0 +1,35 @@
+/**
+ * @file RReedSolomon.h
+ * @date October 17, 2026
+ * @author
+ */
+
+#ifndef RREEDSOLOMON_H_
+#define RREEDSOLOMON_H_
+
+#include <stdint.h>
+
+
+/***************************************************************************************************
+                                            DEFINITIONS
+***************************************************************************************************/
+
+/**
+ * The largest number of parity bytes appended to a downlinked frame; repairs up to half as many
+ * damaged bytes. Every frame leaves room for them (see FILE_TRANSFER_FRAME_RESERVED_SIZE).
+ */
+#define RS_MAX_PARITY_SIZE	(8)
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+void rsConfigure(uint32_t paritySize);
+uint8_t rsParitySize(void);
+
+uint8_t rsEncode(uint8_t* frame, uint8_t size);
+int rsDecode(uint8_t* frame, uint8_t size, uint8_t paritySize);
+
+
+#endif /* RREEDSOLOMON_H_ */
@@ -1,20 +1,20 @@
-/**
- * @file RKey.h
- * @date February 9, 2022
- * @author Tyrel Kostyk (tck290)
- */
-
-#ifndef RKEY_H_
-#define RKEY_H_
-
-#include <stdint.h>
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-uint8_t privateKey(void);
-
-
-#endif /* RKEY_H_ */
+/**
+ * @file RKey.h
+ * @date February 9, 2022
+ * @author Tyrel Kostyk (tck290)
+ */
+
+#ifndef RKEY_H_
+#define RKEY_H_
+
+#include <stdint.h>
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+uint8_t privateKey(void);
+
+
+#endif /* RKEY_H_ */
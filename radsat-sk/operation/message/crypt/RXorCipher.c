@@ -1,42 +1,109 @@
-/**
- * @file RXorCipher.c
- * @date February 9, 2022
- * @author Tyrel Kostyk (tck290)
- */
-
-#include <RXorCipher.h>
-#include <RKey.h>
-#include <hal/errors.h>
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-/**
- * Decrypt a message using the XOR Cipher technique.
- *
- * @param buffer The message to be decrypted. Modified by function.
- * @param size The size of the message in bytes.
- * @return 0 on success, otherwise failure.
- */
-int xorDecrypt(uint8_t* buffer, uint8_t size) {
-
-	// ensure that the buffer is not NULL
-	if (buffer == 0)
-		return E_INPUT_POINTER_NULL;
-
-	// grab the key; fail if key is invalid
-	uint8_t key = privateKey();
-	if (key == 0) return -1;
-
-	// decrypt (XOR) every byte
-	int newValue = 0;
-	for (int i = 0; i < size; i++) {
-		newValue = buffer[i] ^ key;
-		buffer[i] = newValue;
-	}
-
-	return 0;
-}
-
+/**
+ * @file RXorCipher.c
+ * @date February 9, 2022
+ * @author Tyrel Kostyk (tck290)
+ */
+
+#include <RXorCipher.h>
+#include <RKey.h>
+#include <hal/errors.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** A word of the message; may alias the bytes of the buffer it is read from. */
+typedef uint32_t __attribute__((__may_alias__)) xor_word_t;
+
+/** Mask of the address bits that must be clear for a word access to be aligned. */
+#define XOR_WORD_ALIGNMENT_MASK	((uintptr_t)(sizeof(xor_word_t) - 1))
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+/**
+ * Decrypt a message using the XOR Cipher technique.
+ *
+ * @param buffer The message to be decrypted. Modified by function.
+ * @param size The size of the message in bytes.
+ * @return 0 on success, otherwise failure.
+ */
+int xorDecrypt(uint8_t* buffer, uint8_t size) {
+
+	// ensure that the buffer is not NULL
+	if (buffer == 0)
+		return E_INPUT_POINTER_NULL;
+
+	// grab the key; fail if key is invalid
+	xor_cipher_t cipher;
+	int error = xorBegin(&cipher);
+	if (error != 0)
+		return error;
+
+	// decrypt (XOR) every byte
+	xorUpdate(&cipher, buffer, size);
+
+	return 0;
+}
+
+
+/**
+ * Begin an incremental decryption, validating the private key.
+ *
+ * @param cipher The decryption state. Set by function.
+ * @return 0 on success, otherwise failure (e.g. invalid key).
+ */
+int xorBegin(xor_cipher_t* cipher) {
+
+	// ensure that the state is not NULL
+	if (cipher == 0)
+		return E_INPUT_POINTER_NULL;
+
+	// grab the key; fail if key is invalid
+	uint8_t key = privateKey();
+	if (key == 0) return -1;
+
+	// repeat the key across every byte of a word
+	cipher->keyWord = (uint32_t)key * 0x01010101UL;
+
+	return 0;
+}
+
+
+/**
+ * Decrypt the next piece of a message, in place.
+ *
+ * The pieces may be of any size and alignment; whole (aligned) words are decrypted at once, with
+ * any unaligned bytes at either end handled individually.
+ *
+ * @param cipher The decryption state (see @sa xorBegin).
+ * @param buffer The piece of the message to be decrypted. Modified by function.
+ * @param size The size of the piece in bytes.
+ */
+void xorUpdate(const xor_cipher_t* cipher, uint8_t* buffer, uint16_t size) {
+
+	uint8_t key = (uint8_t)cipher->keyWord;
+
+	// decrypt the bytes ahead of the first aligned word
+	while (size > 0 && ((uintptr_t)buffer & XOR_WORD_ALIGNMENT_MASK) != 0) {
+		*buffer++ ^= key;
+		size--;
+	}
+
+	// decrypt whole words
+	xor_word_t* word = (xor_word_t*)buffer;
+	while (size >= sizeof(xor_word_t)) {
+		*word++ ^= cipher->keyWord;
+		size -= sizeof(xor_word_t);
+	}
+
+	// decrypt the bytes after the last whole word
+	buffer = (uint8_t*)word;
+	while (size > 0) {
+		*buffer++ ^= key;
+		size--;
+	}
+}
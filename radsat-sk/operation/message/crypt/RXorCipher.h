@@ -1,21 +1,39 @@
-/**
- * @file RXorCipher.h
- * @date February 9, 2022
- * @author Tyrel Kostyk (tck290)
- */
-
-
-#ifndef RXORCIPHER_H_
-#define RXORCIPHER_H_
-
-#include <stdint.h>
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-int xorDecrypt(uint8_t* buffer, uint8_t size);
-
-
-#endif /* RXORCIPHER_H_ */
+/**
+ * @file RXorCipher.h
+ * @date February 9, 2022
+ * @author Tyrel Kostyk (tck290)
+ */
+
+
+#ifndef RXORCIPHER_H_
+#define RXORCIPHER_H_
+
+#include <stdint.h>
+
+
+/***************************************************************************************************
+                                             DEFINITIONS
+***************************************************************************************************/
+
+/**
+ * State of an incremental (streaming) decryption.
+ *
+ * The key is validated once, when the decryption begins, and kept repeated across a full word; a
+ * message can then be decrypted in pieces of any size (see @sa xorUpdate).
+ */
+typedef struct _xor_cipher_t {
+	uint32_t keyWord;		///< The private key, repeated in every byte of a word
+} xor_cipher_t;
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+int xorDecrypt(uint8_t* buffer, uint8_t size);
+
+int xorBegin(xor_cipher_t* cipher);
+void xorUpdate(const xor_cipher_t* cipher, uint8_t* buffer, uint16_t size);
+
+
+#endif /* RXORCIPHER_H_ */
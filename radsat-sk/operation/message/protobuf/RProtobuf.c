@@ -1,63 +1,218 @@
-/**
- * @file RProtobuf.c
- * @date January 25, 2021
- * @author Tyrel Kostyk (tck290)
- * Last edited 27 July 2022 by Brian Pitzel
- */
-
-#include <RProtobuf.h>
-#include <hal/errors.h>
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-/**
- * Encode (serialize) a raw protobuf message with NanoPB into a buffer.
- *
- * @param rawMessage The raw (non-serialized) radsat_message struct to encode.
- * @param outgoingBuffer The buffer that will hold the encoded message.
- * @return The size of the encoded message (max 255); 0 if encoding failed.
- */
-uint8_t protoEncode(radsat_message* rawMessage, uint8_t* outgoingBuffer) {
-
-	// ensure incoming buffers are not NULL
-	if (rawMessage == 0 || outgoingBuffer == 0)
-		return 0;
-
-	// create stream object
-	pb_ostream_t stream = pb_ostream_from_buffer(outgoingBuffer, PROTO_MAX_ENCODED_SIZE);
-
-	// encode the message into the byte array
-	if (pb_encode(&stream, radsat_message_fields, (uint8_t*)rawMessage)){
-		return stream.bytes_written;
-	}
-
-	// if the encoding failed, return 0
-	return 0;
-}
-
-
-/**
- * Decode an encoded protobuf message.
- *
- * @param incomingBuffer The buffer containing the encoded message (no header).
- * @param bufferSize The size of incomingBuffer in bytes.
- * @param decodedMessage The message that will be populated with the decoded message.
- * @return 0 if the message is decoded successfully, otherwise error occured.
- */
-int protoDecode(uint8_t* incomingBuffer, uint8_t bufferSize, radsat_message* decodedMessage) {
-
-	// ensure incoming buffers are not NULL
-	if (incomingBuffer == 0 || decodedMessage == 0)
-		return E_INPUT_POINTER_NULL;
-
-	// create stream object
-	pb_istream_t stream = pb_istream_from_buffer((uint8_t*)incomingBuffer, bufferSize);
-
-	// decode the message into the empty message struct
-	uint8_t success = pb_decode(&stream, radsat_message_fields, decodedMessage);
-
-	return !success;
-}
+/**
+ * @file RProtobuf.c
+ * @date January 25, 2021
+ * @author Tyrel Kostyk (tck290)
+ * Last edited 27 July 2022 by Brian Pitzel
+ */
+
+#include <RProtobuf.h>
+#include <pb_common.h>
+#include <hal/errors.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** A message with direct (straight-line) coders, generated alongside its NanoPB layout (see pb_direct.h). */
+typedef struct _proto_direct_coder_t {
+	const pb_msgdesc_t* fields;										///> The layout of the message
+	size_t (*encodedSize)(const void* message);						///> Provides the encoded size of a message
+	pb_byte_t* (*encode)(pb_byte_t* buffer, const void* message);	///> Encodes a message; the buffer must have room for it
+} proto_direct_coder_t;
+
+/** Entry of the direct coder table, for each of the messages listed by the generated headers. */
+#define PB_DIRECT(message)	{ &message##_msg, message##_encoded_size_direct, message##_encode_direct },
+
+/**
+ * The messages with direct coders, selected when generating the protobuf types (see generate-proto.sh).
+ * Any other message is encoded by the generic (table-driven) NanoPB encoder.
+ */
+static const proto_direct_coder_t directCoders[] = {
+	RFILETRANSFER_DIRECT_MESSAGES
+	RPROTOCOL_DIRECT_MESSAGES
+	RTELECOMMANDS_DIRECT_MESSAGES
+	RRADSAT_DIRECT_MESSAGES
+};
+
+/** The number of messages with direct coders. */
+#define DIRECT_CODER_COUNT	(sizeof(directCoders) / sizeof(directCoders[0]))
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static const pb_msgdesc_t* protoSubmessageFields(const pb_msgdesc_t* fields, uint16_t tag);
+static const proto_direct_coder_t* protoDirectCoder(const pb_msgdesc_t* fields);
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+/**
+ * Encode (serialize) a raw protobuf message with NanoPB into a buffer.
+ *
+ * @param rawMessage The raw (non-serialized) radsat_message struct to encode.
+ * @param outgoingBuffer The buffer that will hold the encoded message.
+ * @return The size of the encoded message (max 255); 0 if encoding failed.
+ */
+uint8_t protoEncode(radsat_message* rawMessage, uint8_t* outgoingBuffer) {
+
+	// ensure incoming buffers are not NULL
+	if (rawMessage == 0 || outgoingBuffer == 0)
+		return 0;
+
+	// create stream object
+	pb_ostream_t stream = pb_ostream_from_buffer(outgoingBuffer, PROTO_MAX_ENCODED_SIZE);
+
+	// encode the message into the byte array
+	if (pb_encode(&stream, radsat_message_fields, (uint8_t*)rawMessage)){
+		return stream.bytes_written;
+	}
+
+	// if the encoding failed, return 0
+	return 0;
+}
+
+
+/**
+ * Encode (serialize) a single service message with NanoPB into a buffer, straight from its own struct.
+ *
+ * The result is identical to that of protoEncode for a radsat_message holding the same message, but
+ * no radsat_message needs to be populated: the headers of the enclosing (service) submessages are
+ * written directly, and the message itself is encoded from the caller's struct. Messages given direct
+ * (straight-line) coders when generating the protobuf types skip the generic NanoPB encoder.
+ *
+ * @param serviceTag The tag of the service the message belongs to (e.g. radsat_message_FileTransferMessage_tag).
+ * @param messageTag The tag of the message within its service (e.g. file_transfer_message_ImagePacket_tag).
+ * @param message The raw (non-serialized) message struct to encode; its type must match the tags.
+ * @param outgoingBuffer The buffer that will hold the encoded message.
+ * @param bufferSize The size of outgoingBuffer in bytes.
+ * @return The size of the encoded message (max 255); 0 if encoding failed or did not fit.
+ */
+uint8_t protoEncodeMessage(uint16_t serviceTag, uint16_t messageTag, const void* message, uint8_t* outgoingBuffer, uint8_t bufferSize) {
+
+	// ensure incoming buffers are not NULL
+	if (message == 0 || outgoingBuffer == 0)
+		return 0;
+
+	// look up the layout of the service, and of the message within it
+	const pb_msgdesc_t* serviceFields = protoSubmessageFields(radsat_message_fields, serviceTag);
+	if (serviceFields == 0)
+		return 0;
+
+	const pb_msgdesc_t* messageFields = protoSubmessageFields(serviceFields, messageTag);
+	if (messageFields == 0)
+		return 0;
+
+	// fixed-layout messages are encoded by their direct coders, where generated
+	const proto_direct_coder_t* coder = protoDirectCoder(messageFields);
+
+	// the submessage headers hold the sizes of what follows them
+	size_t messageSize = 0;
+	if (coder != 0)
+		messageSize = coder->encodedSize(message);
+	else if (!pb_get_encoded_size(&messageSize, messageFields, message))
+		return 0;
+
+	pb_ostream_t sizing = PB_OSTREAM_SIZING;
+	if (!pb_encode_tag(&sizing, PB_WT_STRING, messageTag) || !pb_encode_varint(&sizing, messageSize))
+		return 0;
+	size_t serviceSize = sizing.bytes_written + messageSize;
+
+	// create stream object
+	pb_ostream_t stream = pb_ostream_from_buffer(outgoingBuffer, bufferSize);
+
+	// encode the service and message headers
+	if (!pb_encode_tag(&stream, PB_WT_STRING, serviceTag)
+	|| !pb_encode_varint(&stream, serviceSize)
+	|| !pb_encode_tag(&stream, PB_WT_STRING, messageTag)
+	|| !pb_encode_varint(&stream, messageSize)) {
+		return 0;
+	}
+
+	// followed by the message itself
+	size_t encodedSize = stream.bytes_written + messageSize;
+	if (coder != 0) {
+		if (encodedSize > bufferSize)
+			return 0;
+		coder->encode(&outgoingBuffer[stream.bytes_written], message);
+	}
+	else if (!pb_encode(&stream, messageFields, message)) {
+		return 0;
+	}
+
+	if (encodedSize <= PROTO_MAX_ENCODED_SIZE)
+		return (uint8_t)encodedSize;
+
+	// if the encoding failed, return 0
+	return 0;
+}
+
+
+/**
+ * Decode an encoded protobuf message.
+ *
+ * @param incomingBuffer The buffer containing the encoded message (no header).
+ * @param bufferSize The size of incomingBuffer in bytes.
+ * @param decodedMessage The message that will be populated with the decoded message.
+ * @return 0 if the message is decoded successfully, otherwise error occured.
+ */
+int protoDecode(uint8_t* incomingBuffer, uint8_t bufferSize, radsat_message* decodedMessage) {
+
+	// ensure incoming buffers are not NULL
+	if (incomingBuffer == 0 || decodedMessage == 0)
+		return E_INPUT_POINTER_NULL;
+
+	// create stream object
+	pb_istream_t stream = pb_istream_from_buffer((uint8_t*)incomingBuffer, bufferSize);
+
+	// decode the message into the empty message struct
+	uint8_t success = pb_decode(&stream, radsat_message_fields, decodedMessage);
+
+	return !success;
+}
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Find the layout of a submessage field.
+ *
+ * @param fields The layout of the message holding the field.
+ * @param tag The tag of the field.
+ * @return The layout of the submessage; NULL if there is no such submessage field.
+ */
+static const pb_msgdesc_t* protoSubmessageFields(const pb_msgdesc_t* fields, uint16_t tag) {
+
+	// only the layout is of interest; no message is walked
+	pb_field_iter_t iterator;
+	if (!pb_field_iter_begin_const(&iterator, fields, 0) || !pb_field_iter_find(&iterator, tag))
+		return 0;
+
+	if (PB_LTYPE(iterator.type) != PB_LTYPE_SUBMESSAGE)
+		return 0;
+
+	return iterator.submsg_desc;
+}
+
+
+/**
+ * Find the direct (straight-line) coders of a message.
+ *
+ * @param fields The layout of the message.
+ * @return The direct coders of the message; NULL if it has none.
+ */
+static const proto_direct_coder_t* protoDirectCoder(const pb_msgdesc_t* fields) {
+
+	for (uint8_t i = 0; i < DIRECT_CODER_COUNT; i++) {
+		if (directCoders[i].fields == fields)
+			return &directCoders[i];
+	}
+
+	return 0;
+}
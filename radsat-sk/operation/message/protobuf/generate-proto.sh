@@ -4,7 +4,11 @@
 # NOTE: May have to convert line-endings of script;
 # run `dos2unix ./nanopb/generator/nanopb_generator.py` on Linux/WSL
 # run `unix2dos ./nanopb/generator/nanopb_generator.py` on Windows
-./nanopb/generator/nanopb_generator.py --strip-path proto/*.proto
+# messages encoded on the hot paths get direct (straight-line) coders (see nanopb/pb_direct.h);
+# they must be fixed-layout (only singular scalars and fixed-layout submessages)
+DIRECT_CODERS="dosimeter_data battery_telemetry eps_telemetry transceiver_telemetry"
+
+./nanopb/generator/nanopb_generator.py --strip-path $(printf -- "--direct-coders %s " $DIRECT_CODERS) proto/*.proto
 
 if [ "$?" -ne 0 ]; then
     echo -e "Failed while generating source and header files. Exiting..."
@@ -0,0 +1,38 @@
+#!/bin/bash
+
+# measure the code size of the direct (straight-line) coders against the generic nanopb encoder
+# usage: ./measure-direct-size.sh, from this folder (set CC, NM and SIZE to measure with another toolchain, i.e. arm-none-eabi-)
+CC=${CC:-gcc}
+NM=${NM:-nm}
+SIZE=${SIZE:-size}
+CFLAGS="-std=gnu99 -Os -ffunction-sections -fdata-sections -Inanopb -Itypes"
+
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+for SOURCE in types/RFileTransfer.pb.c nanopb/pb_encode.c nanopb/pb_common.c; do
+    $CC $CFLAGS -c "$SOURCE" -o "$OUT/$(basename "${SOURCE%.c}").o"
+
+    if [ "$?" -ne 0 ]; then
+        echo -e "Failed while compiling $SOURCE. Exiting..."
+        exit -1
+    fi
+done
+
+# each function is in a section of its own; sum the text of the direct coders, by kind
+echo "Direct coders ($CC -Os):"
+$NM -S -t d --size-sort "$OUT/RFileTransfer.pb.o" | awk '
+    $3 ~ /^[tT]$/ && $4 ~ /_direct$/ {
+        size = $2 + 0
+        kind = ($4 ~ /_encode_direct$|_encoded_size_direct$/) ? "encode" : "decode"
+        total[kind] += size
+        printf "    %-44s %6u bytes\n", $4, size
+    }
+    END {
+        printf "    %-44s %6u bytes\n", "total (encoders)", total["encode"]
+        printf "    %-44s %6u bytes (only linked by the ground side and tests)\n", "total (decoders)", total["decode"]
+    }'
+
+# the generic encoder they stand in for on the hot paths (which stays linked, for the other messages)
+echo "Generic encoder ($CC -Os):"
+(cd "$OUT" && $SIZE pb_encode.o pb_common.o) | awk 'NR > 1 { printf "    %-44s %6u bytes (text)\n", $6, $1 }'
@@ -1348,6 +1348,191 @@ class Message:
         return msg.SerializeToString()
 
 
+# ---------------------------------------------------------------------------
+#                   Direct (straight-line) coders
+# ---------------------------------------------------------------------------
+#
+# For fixed-layout messages, i.e. messages whose fields are all static singular
+# scalars or static singular submessages that are fixed-layout themselves, the
+# generic table-driven pb_encode()/pb_decode() can be bypassed by straight-line
+# functions emitted per message (--direct-coders). The output is identical to
+# that of pb_encode(); the runtime helpers are in pb_direct.h.
+
+# Supported scalar types: pbtype -> (wire type, coding, max data size)
+direct_scalar_types = {
+    'FLOAT':    ('PB_WT_32BIT',  'fixed32', 4),
+    'FIXED32':  ('PB_WT_32BIT',  'fixed32', 4),
+    'SFIXED32': ('PB_WT_32BIT',  'fixed32', 4),
+    'FIXED64':  ('PB_WT_64BIT',  'fixed64', 8),
+    'SFIXED64': ('PB_WT_64BIT',  'fixed64', 8),
+    'UINT32':   ('PB_WT_VARINT', 'uvarint', 4),
+    'UENUM':    ('PB_WT_VARINT', 'uvarint', 4),
+    'INT32':    ('PB_WT_VARINT', 'ivarint', 4),
+    'ENUM':     ('PB_WT_VARINT', 'ivarint', 4),
+    'BOOL':     ('PB_WT_VARINT', 'bool',    4),
+}
+
+direct_wire_type_values = {
+    'PB_WT_VARINT': 0,
+    'PB_WT_64BIT':  1,
+    'PB_WT_STRING': 2,
+    'PB_WT_32BIT':  5,
+}
+
+def direct_coder_problem(msg, dependencies):
+    '''Return the reason why a message cannot have direct coders, or None if it can.'''
+    for field in msg.fields:
+        if type(field) is not Field:
+            return "field '%s' is not a plain field (oneof or extension)" % field.name
+        if field.allocation != 'STATIC' or field.rules != 'SINGULAR':
+            return "field '%s' is not static and singular" % field.name
+        if field.pbtype == 'MESSAGE':
+            submsg = dependencies.get(str(field.submsgname))
+            if submsg is None:
+                return "type of field '%s' is unknown" % field.name
+            problem = direct_coder_problem(submsg, dependencies)
+            if problem:
+                return "submessage '%s': %s" % (field.submsgname, problem)
+        elif field.pbtype not in direct_scalar_types:
+            return "type of field '%s' (%s) is not supported" % (field.name, field.pbtype)
+        elif field.data_item_size > direct_scalar_types[field.pbtype][2]:
+            return "field '%s' is larger than supported" % field.name
+    return None
+
+def direct_key_bytes(tag, wiretype):
+    '''Field key (tag and wire type) as a list of varint-encoded byte literals.'''
+    key = (tag << 3) | direct_wire_type_values[wiretype]
+    result = []
+    while key >= 0x80:
+        result.append('0x%02x' % ((key & 0x7F) | 0x80))
+        key >>= 7
+    result.append('0x%02x' % key)
+    return result
+
+def direct_field_wiretype(field):
+    if field.pbtype == 'MESSAGE':
+        return 'PB_WT_STRING'
+    return direct_scalar_types[field.pbtype][0]
+
+def direct_coder_declarations(msg):
+    '''Prototypes of the direct coders of a message.'''
+    result  = 'size_t %s_encoded_size_direct(const void *src_struct);\n' % msg.name
+    result += 'pb_byte_t *%s_encode_direct(pb_byte_t *buf, const void *src_struct);\n' % msg.name
+    result += 'bool %s_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct);\n' % msg.name
+    result += 'bool %s_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct);\n' % msg.name
+    return result
+
+def direct_coder_definitions(msg):
+    '''Definitions of the direct coders of a message.'''
+    name = str(msg.name)
+    fields = msg.fields
+    result = ''
+
+    # Encoded size: the sum of the fields that are present (non-zero)
+    result += 'size_t %s_encoded_size_direct(const void *src_struct)\n{\n' % name
+    if not fields:
+        result += '    PB_UNUSED(src_struct);\n    return 0;\n}\n\n'
+    else:
+        result += '    const %s *src = (const %s*)src_struct;\n' % (name, name)
+        result += '    size_t size = 0;\n'
+        for field in fields:
+            keysize = len(direct_key_bytes(field.tag, direct_field_wiretype(field)))
+            ref = 'src->%s' % field.name
+            if field.pbtype == 'MESSAGE':
+                result += '    { size_t n = %s_encoded_size_direct(&%s); if (n) size += %d + pb_direct_varint_size((uint32_t)n) + n; }\n' % (field.submsgname, ref, keysize)
+                continue
+            coding = direct_scalar_types[field.pbtype][1]
+            if coding == 'fixed32':
+                result += '    if (!pb_direct_is_zero32(&%s)) size += %d;\n' % (ref, keysize + 4)
+            elif coding == 'fixed64':
+                result += '    if (!pb_direct_is_zero64(&%s)) size += %d;\n' % (ref, keysize + 8)
+            elif coding == 'uvarint':
+                result += '    if (%s) size += %d + pb_direct_varint_size((uint32_t)%s);\n' % (ref, keysize, ref)
+            elif coding == 'ivarint':
+                result += '    if (%s) size += %d + pb_direct_int32_size((int32_t)%s);\n' % (ref, keysize, ref)
+            elif coding == 'bool':
+                result += '    if (%s) size += %d;\n' % (ref, keysize + 1)
+        result += '    return size;\n}\n\n'
+
+    # Encoding: unchecked; the buffer must hold the encoded size
+    result += 'pb_byte_t *%s_encode_direct(pb_byte_t *buf, const void *src_struct)\n{\n' % name
+    if not fields:
+        result += '    PB_UNUSED(src_struct);\n    return buf;\n}\n\n'
+    else:
+        result += '    const %s *src = (const %s*)src_struct;\n' % (name, name)
+        for field in fields:
+            key = ''.join('*buf++ = %s; ' % b for b in direct_key_bytes(field.tag, direct_field_wiretype(field)))
+            ref = 'src->%s' % field.name
+            if field.pbtype == 'MESSAGE':
+                result += '    { size_t n = %s_encoded_size_direct(&%s); if (n) { %sbuf = pb_direct_put_varint(buf, (uint32_t)n); buf = %s_encode_direct(buf, &%s); } }\n' % (field.submsgname, ref, key, field.submsgname, ref)
+                continue
+            coding = direct_scalar_types[field.pbtype][1]
+            if coding == 'fixed32':
+                result += '    if (!pb_direct_is_zero32(&%s)) { %sbuf = pb_direct_put_fixed32(buf, &%s); }\n' % (ref, key, ref)
+            elif coding == 'fixed64':
+                result += '    if (!pb_direct_is_zero64(&%s)) { %sbuf = pb_direct_put_fixed64(buf, &%s); }\n' % (ref, key, ref)
+            elif coding == 'uvarint':
+                result += '    if (%s) { %sbuf = pb_direct_put_varint(buf, (uint32_t)%s); }\n' % (ref, key, ref)
+            elif coding == 'ivarint':
+                result += '    if (%s) { %sbuf = pb_direct_put_int32(buf, (int32_t)%s); }\n' % (ref, key, ref)
+            elif coding == 'bool':
+                result += '    if (%s) { %s*buf++ = 1; }\n' % (ref, key)
+        result += '    return buf;\n}\n\n'
+
+    # Decoding: all fields are zero unless present, as with pb_decode()
+    result += 'bool %s_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct)\n{\n' % name
+    result += '    memset(dest_struct, 0, sizeof(%s));\n' % name
+    result += '    return %s_merge_direct(buf, size, dest_struct);\n}\n\n' % name
+
+    # Merging: fields are decoded in any order; unknown fields are skipped
+    result += 'bool %s_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct)\n{\n' % name
+    if fields:
+        result += '    %s *dest = (%s*)dest_struct;\n' % (name, name)
+    else:
+        result += '    PB_UNUSED(dest_struct);\n'
+    result += '    const pb_byte_t *end = buf + size;\n'
+    result += '    while (buf < end)\n    {\n'
+    if any(field.pbtype == 'MESSAGE' or direct_scalar_types[field.pbtype][1] not in ('fixed32', 'fixed64')
+           for field in fields):
+        result += '        uint64_t key, value;\n'
+    else:
+        result += '        uint64_t key;\n'
+    result += '        if (!pb_direct_read_varint(&buf, end, &key))\n            return false;\n'
+    result += '        switch (key)\n        {\n'
+    for field in fields:
+        ref = 'dest->%s' % field.name
+        result += '            case PB_DIRECT_KEY(%d, %s):\n' % (field.tag, direct_field_wiretype(field))
+        if field.pbtype == 'MESSAGE':
+            result += '                if (!pb_direct_read_varint(&buf, end, &value) || value > (uint64_t)(end - buf)\n'
+            result += '                    || !%s_merge_direct(buf, (size_t)value, &%s))\n' % (field.submsgname, ref)
+            result += '                    return false;\n'
+            result += '                buf += (size_t)value;\n'
+            result += '                break;\n'
+            continue
+        coding = direct_scalar_types[field.pbtype][1]
+        if coding == 'fixed32':
+            result += '                if (!pb_direct_read_fixed32(&buf, end, &%s))\n                    return false;\n' % ref
+        elif coding == 'fixed64':
+            result += '                if (!pb_direct_read_fixed64(&buf, end, &%s))\n                    return false;\n' % ref
+        elif coding == 'bool':
+            result += '                if (!pb_direct_read_varint(&buf, end, &value))\n                    return false;\n'
+            result += '                %s = (value != 0);\n' % ref
+        elif coding == 'uvarint':
+            result += '                if (!pb_direct_read_varint(&buf, end, &value) || (uint64_t)(%s)value != value)\n                    return false;\n' % field.ctype
+            result += '                %s = (%s)value;\n' % (ref, field.ctype)
+        elif coding == 'ivarint':
+            result += '                if (!pb_direct_read_varint(&buf, end, &value) || (int64_t)(%s)(int64_t)value != (int64_t)value)\n                    return false;\n' % field.ctype
+            result += '                %s = (%s)(int64_t)value;\n' % (ref, field.ctype)
+        result += '                break;\n'
+    result += '            default:\n'
+    result += '                if (!pb_direct_skip(&buf, end, (uint32_t)(key & 7)))\n                    return false;\n'
+    result += '                break;\n'
+    result += '        }\n    }\n'
+    result += '    return true;\n}\n\n'
+
+    return result
+
+
 # ---------------------------------------------------------------------------
 #                    Processing of entire .proto files
 # ---------------------------------------------------------------------------
@@ -1522,6 +1707,32 @@ class ProtoFile:
             if field_options.type != nanopb_pb2.FT_IGNORE:
                 self.extensions.append(ExtensionField(name, extension, field_options))
 
+    def direct_messages(self, patterns):
+        '''Messages of this file selected for direct coders (see --direct-coders),
+        along with the submessages they need, in the order they are defined.'''
+        selected = set()
+        def select(msg):
+            if str(msg.name) in selected:
+                return
+            problem = direct_coder_problem(msg, self.dependencies)
+            if problem:
+                raise Exception("Message '%s' cannot have direct coders: %s" % (msg.name, problem))
+            selected.add(str(msg.name))
+            for field in msg.fields:
+                if field.pbtype == 'MESSAGE':
+                    submsg = self.dependencies[str(field.submsgname)]
+                    if submsg in self.messages:
+                        select(submsg)
+                    elif not any(fnmatchcase(str(submsg.name), p) for p in patterns):
+                        raise Exception("Message '%s' needs direct coders for '%s', which is not selected"
+                                        % (msg.name, submsg.name))
+
+        for msg in self.messages:
+            if any(fnmatchcase(str(msg.name), p) for p in patterns):
+                select(msg)
+
+        return [msg for msg in self.messages if str(msg.name) in selected]
+
     def add_dependency(self, other):
         for enum in other.enums:
             self.dependencies[str(enum.names)] = enum
@@ -1675,6 +1886,21 @@ class ProtoFile:
                     yield '/* %s depends on runtime parameters */\n' % identifier
             yield '\n'
 
+            if options.direct_coders:
+                directmsgs = self.direct_messages(options.direct_coders)
+                if directmsgs:
+                    yield '/* Direct (straight-line) coders for fixed-layout messages */\n'
+                    for msg in directmsgs:
+                        yield direct_coder_declarations(msg)
+                    yield '\n'
+
+                symbol = make_identifier(headername.split('.')[0])
+                yield '/* Messages with direct coders, as PB_DIRECT(message) entries */\n'
+                yield '#define %s_DIRECT_MESSAGES' % symbol
+                for msg in directmsgs:
+                    yield ' \\\n    PB_DIRECT(%s)' % msg.name
+                yield '\n\n'
+
             if [msg for msg in self.messages if hasattr(msg,'msgid')]:
               yield '/* Message IDs (where set with "msgid" option) */\n'
               for msg in self.messages:
@@ -1731,6 +1957,13 @@ class ProtoFile:
             yield '/* Generated by %s at %s. */\n\n' % (nanopb_version, time.asctime())
         yield options.genformat % (headername)
         yield '\n'
+        if options.direct_coders and self.direct_messages(options.direct_coders):
+            try:
+                yield options.libformat % ('pb_direct.h')
+                yield '\n'
+            except TypeError:
+                # no %s specified - the helpers must be included through pb.h
+                pass
 
         if Globals.protoc_insertion_points:
             yield '/* @@protoc_insertion_point(includes) */\n'
@@ -1743,6 +1976,13 @@ class ProtoFile:
         for msg in self.messages:
             yield msg.fields_definition(self.dependencies) + '\n\n'
 
+        if options.direct_coders:
+            directmsgs = self.direct_messages(options.direct_coders)
+            if directmsgs:
+                yield '/* Direct (straight-line) coders for fixed-layout messages */\n'
+                for msg in directmsgs:
+                    yield direct_coder_definitions(msg)
+
         for ext in self.extensions:
             yield ext.extension_def(self.dependencies) + '\n'
 
@@ -1917,6 +2157,8 @@ optparser.add_option("-v", "--verbose", dest="verbose", action="store_true", def
     help="Print more information.")
 optparser.add_option("-s", dest="settings", metavar="OPTION:VALUE", action="append", default=[],
     help="Set generator option (max_size, max_count etc.).")
+optparser.add_option("--direct-coders", dest="direct_coders", metavar="MESSAGE", action="append", default=[],
+    help="Generate straight-line encode/decode functions (see pb_direct.h) for fixed-layout messages matching the pattern.")
 optparser.add_option("--protoc-insertion-points", dest="protoc_insertion_points", action="store_true", default=False,
                      help="Include insertion point comments in output for use by custom protoc plugins")
 
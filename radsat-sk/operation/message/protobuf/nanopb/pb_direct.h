@@ -0,0 +1,196 @@
+/* pb_direct.h: Helpers for the direct (straight-line) coders that
+ * nanopb_generator.py emits for fixed-layout messages (--direct-coders).
+ * Header-only; the generated .pb.c files include it.
+ *
+ * A direct encoder writes the same bytes as pb_encode() would, without going
+ * through the field descriptors. It does not check for room in the buffer;
+ * the caller obtains the encoded size first (<message>_encoded_size_direct).
+ */
+
+#ifndef PB_DIRECT_H_INCLUDED
+#define PB_DIRECT_H_INCLUDED
+
+#include "pb.h"
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Field key (tag and wire type), as it appears on the wire */
+#define PB_DIRECT_KEY(tag, wiretype) ((((uint32_t)(tag)) << 3) | (uint32_t)(wiretype))
+
+/* Proto3 fields are only encoded if some byte of their value is non-zero
+ * (so that e.g. a float of -0.0 is encoded, as with pb_encode()). */
+static inline bool pb_direct_is_zero32(const void *value)
+{
+    uint32_t bits;
+    memcpy(&bits, value, sizeof(bits));
+    return bits == 0;
+}
+
+static inline bool pb_direct_is_zero64(const void *value)
+{
+    uint64_t bits;
+    memcpy(&bits, value, sizeof(bits));
+    return bits == 0;
+}
+
+/* Encoded size of varints */
+static inline size_t pb_direct_varint_size(uint32_t value)
+{
+    size_t size = 1;
+    while (value >= 0x80)
+    {
+        value >>= 7;
+        size++;
+    }
+    return size;
+}
+
+static inline size_t pb_direct_int32_size(int32_t value)
+{
+    /* Negative values are sign-extended to 64 bits */
+    return (value < 0) ? 10 : pb_direct_varint_size((uint32_t)value);
+}
+
+/* Unchecked writes; each returns the position after the written bytes */
+static inline pb_byte_t *pb_direct_put_varint(pb_byte_t *buf, uint32_t value)
+{
+    while (value >= 0x80)
+    {
+        *buf++ = (pb_byte_t)(value | 0x80);
+        value >>= 7;
+    }
+    *buf++ = (pb_byte_t)value;
+    return buf;
+}
+
+static inline pb_byte_t *pb_direct_put_int32(pb_byte_t *buf, int32_t value)
+{
+    uint64_t extended;
+
+    if (value >= 0)
+        return pb_direct_put_varint(buf, (uint32_t)value);
+
+    extended = (uint64_t)(int64_t)value;
+    while (extended >= 0x80)
+    {
+        *buf++ = (pb_byte_t)(extended | 0x80);
+        extended >>= 7;
+    }
+    *buf++ = (pb_byte_t)extended;
+    return buf;
+}
+
+static inline pb_byte_t *pb_direct_put_fixed32(pb_byte_t *buf, const void *value)
+{
+    uint32_t bits;
+    memcpy(&bits, value, sizeof(bits));
+    buf[0] = (pb_byte_t)(bits & 0xFF);
+    buf[1] = (pb_byte_t)((bits >> 8) & 0xFF);
+    buf[2] = (pb_byte_t)((bits >> 16) & 0xFF);
+    buf[3] = (pb_byte_t)((bits >> 24) & 0xFF);
+    return buf + 4;
+}
+
+static inline pb_byte_t *pb_direct_put_fixed64(pb_byte_t *buf, const void *value)
+{
+    uint64_t bits;
+    int i;
+    memcpy(&bits, value, sizeof(bits));
+    for (i = 0; i < 8; i++)
+        buf[i] = (pb_byte_t)((bits >> (8 * i)) & 0xFF);
+    return buf + 8;
+}
+
+/* Checked reads; each advances *buf past the read bytes, never beyond end */
+static inline bool pb_direct_read_varint(const pb_byte_t **buf, const pb_byte_t *end, uint64_t *value)
+{
+    const pb_byte_t *p = *buf;
+    uint64_t result = 0;
+    unsigned int shift = 0;
+    pb_byte_t byte;
+
+    do
+    {
+        if (p >= end || shift >= 64)
+            return false;
+        byte = *p++;
+        result |= (uint64_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+
+    *value = result;
+    *buf = p;
+    return true;
+}
+
+static inline bool pb_direct_read_fixed32(const pb_byte_t **buf, const pb_byte_t *end, void *value)
+{
+    const pb_byte_t *p = *buf;
+    uint32_t bits;
+
+    if (end - p < 4)
+        return false;
+
+    bits = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    memcpy(value, &bits, sizeof(bits));
+    *buf = p + 4;
+    return true;
+}
+
+static inline bool pb_direct_read_fixed64(const pb_byte_t **buf, const pb_byte_t *end, void *value)
+{
+    const pb_byte_t *p = *buf;
+    uint64_t bits = 0;
+    int i;
+
+    if (end - p < 8)
+        return false;
+
+    for (i = 0; i < 8; i++)
+        bits |= (uint64_t)p[i] << (8 * i);
+    memcpy(value, &bits, sizeof(bits));
+    *buf = p + 8;
+    return true;
+}
+
+/* Skip a field of the given wire type (unknown fields) */
+static inline bool pb_direct_skip(const pb_byte_t **buf, const pb_byte_t *end, uint32_t wiretype)
+{
+    uint64_t value;
+
+    switch (wiretype)
+    {
+        case PB_WT_VARINT:
+            return pb_direct_read_varint(buf, end, &value);
+
+        case PB_WT_64BIT:
+            if (end - *buf < 8)
+                return false;
+            *buf += 8;
+            return true;
+
+        case PB_WT_STRING:
+            if (!pb_direct_read_varint(buf, end, &value) || value > (uint64_t)(end - *buf))
+                return false;
+            *buf += (size_t)value;
+            return true;
+
+        case PB_WT_32BIT:
+            if (end - *buf < 4)
+                return false;
+            *buf += 4;
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
@@ -2,6 +2,7 @@
 /* Generated by nanopb-0.4.4 */
 
 #include <RFileTransfer.pb.h>
+#include <pb_direct.h>
 #if PB_PROTO_HEADER_VERSION != 40
 #error Regenerate this file with the current version of nanopb generator.
 #endif
@@ -51,6 +52,12 @@ PB_BIND(dosimeter_board_data, dosimeter_board_data, AUTO)
 PB_BIND(dosimeter_data, dosimeter_data, AUTO)
 
 
+PB_BIND(dosimeter_counts, dosimeter_counts, AUTO)
+
+
+PB_BIND(dosimeter_series, dosimeter_series, AUTO)
+
+
 PB_BIND(image_packet, image_packet, AUTO)
 
 
@@ -66,5 +73,691 @@ PB_BIND(error_record, error_record, AUTO)
 PB_BIND(error_report_summary, error_report_summary, AUTO)
 
 
+/* Direct (straight-line) coders for fixed-layout messages */
+size_t receiver_telemetry_encoded_size_direct(const void *src_struct)
+{
+    const receiver_telemetry *src = (const receiver_telemetry*)src_struct;
+    size_t size = 0;
+    if (!pb_direct_is_zero32(&src->rxDoppler)) size += 5;
+    if (!pb_direct_is_zero32(&src->rxRssi)) size += 5;
+    if (!pb_direct_is_zero32(&src->busVoltage)) size += 5;
+    if (!pb_direct_is_zero32(&src->totalCurrent)) size += 5;
+    if (!pb_direct_is_zero32(&src->txCurrent)) size += 5;
+    if (!pb_direct_is_zero32(&src->rxCurrent)) size += 5;
+    if (!pb_direct_is_zero32(&src->powerAmplifierCurrent)) size += 5;
+    if (!pb_direct_is_zero32(&src->powerAmplifierTemperature)) size += 5;
+    if (!pb_direct_is_zero32(&src->boardTemperature)) size += 5;
+    if (src->uptime) size += 1 + pb_direct_varint_size((uint32_t)src->uptime);
+    if (src->frames) size += 1 + pb_direct_varint_size((uint32_t)src->frames);
+    return size;
+}
+
+pb_byte_t *receiver_telemetry_encode_direct(pb_byte_t *buf, const void *src_struct)
+{
+    const receiver_telemetry *src = (const receiver_telemetry*)src_struct;
+    if (!pb_direct_is_zero32(&src->rxDoppler)) { *buf++ = 0x0d; buf = pb_direct_put_fixed32(buf, &src->rxDoppler); }
+    if (!pb_direct_is_zero32(&src->rxRssi)) { *buf++ = 0x15; buf = pb_direct_put_fixed32(buf, &src->rxRssi); }
+    if (!pb_direct_is_zero32(&src->busVoltage)) { *buf++ = 0x1d; buf = pb_direct_put_fixed32(buf, &src->busVoltage); }
+    if (!pb_direct_is_zero32(&src->totalCurrent)) { *buf++ = 0x25; buf = pb_direct_put_fixed32(buf, &src->totalCurrent); }
+    if (!pb_direct_is_zero32(&src->txCurrent)) { *buf++ = 0x2d; buf = pb_direct_put_fixed32(buf, &src->txCurrent); }
+    if (!pb_direct_is_zero32(&src->rxCurrent)) { *buf++ = 0x35; buf = pb_direct_put_fixed32(buf, &src->rxCurrent); }
+    if (!pb_direct_is_zero32(&src->powerAmplifierCurrent)) { *buf++ = 0x3d; buf = pb_direct_put_fixed32(buf, &src->powerAmplifierCurrent); }
+    if (!pb_direct_is_zero32(&src->powerAmplifierTemperature)) { *buf++ = 0x45; buf = pb_direct_put_fixed32(buf, &src->powerAmplifierTemperature); }
+    if (!pb_direct_is_zero32(&src->boardTemperature)) { *buf++ = 0x4d; buf = pb_direct_put_fixed32(buf, &src->boardTemperature); }
+    if (src->uptime) { *buf++ = 0x50; buf = pb_direct_put_varint(buf, (uint32_t)src->uptime); }
+    if (src->frames) { *buf++ = 0x58; buf = pb_direct_put_varint(buf, (uint32_t)src->frames); }
+    return buf;
+}
+
+bool receiver_telemetry_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    memset(dest_struct, 0, sizeof(receiver_telemetry));
+    return receiver_telemetry_merge_direct(buf, size, dest_struct);
+}
+
+bool receiver_telemetry_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    receiver_telemetry *dest = (receiver_telemetry*)dest_struct;
+    const pb_byte_t *end = buf + size;
+    while (buf < end)
+    {
+        uint64_t key, value;
+        if (!pb_direct_read_varint(&buf, end, &key))
+            return false;
+        switch (key)
+        {
+            case PB_DIRECT_KEY(1, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->rxDoppler))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(2, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->rxRssi))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(3, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->busVoltage))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(4, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->totalCurrent))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(5, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->txCurrent))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(6, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->rxCurrent))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(7, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->powerAmplifierCurrent))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(8, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->powerAmplifierTemperature))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(9, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->boardTemperature))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(10, PB_WT_VARINT):
+                if (!pb_direct_read_varint(&buf, end, &value) || (uint64_t)(uint32_t)value != value)
+                    return false;
+                dest->uptime = (uint32_t)value;
+                break;
+            case PB_DIRECT_KEY(11, PB_WT_VARINT):
+                if (!pb_direct_read_varint(&buf, end, &value) || (uint64_t)(uint32_t)value != value)
+                    return false;
+                dest->frames = (uint32_t)value;
+                break;
+            default:
+                if (!pb_direct_skip(&buf, end, (uint32_t)(key & 7)))
+                    return false;
+                break;
+        }
+    }
+    return true;
+}
+
+size_t transmitter_telemetry_encoded_size_direct(const void *src_struct)
+{
+    const transmitter_telemetry *src = (const transmitter_telemetry*)src_struct;
+    size_t size = 0;
+    if (!pb_direct_is_zero32(&src->reflectedPower)) size += 5;
+    if (!pb_direct_is_zero32(&src->forwardPower)) size += 5;
+    if (!pb_direct_is_zero32(&src->busVoltage)) size += 5;
+    if (!pb_direct_is_zero32(&src->totalCurrent)) size += 5;
+    if (!pb_direct_is_zero32(&src->txCurrent)) size += 5;
+    if (!pb_direct_is_zero32(&src->rxCurrent)) size += 5;
+    if (!pb_direct_is_zero32(&src->powerAmplifierCurrent)) size += 5;
+    if (!pb_direct_is_zero32(&src->powerAmplifierTemperature)) size += 5;
+    if (!pb_direct_is_zero32(&src->boardTemperature)) size += 5;
+    if (src->uptime) size += 1 + pb_direct_varint_size((uint32_t)src->uptime);
+    return size;
+}
+
+pb_byte_t *transmitter_telemetry_encode_direct(pb_byte_t *buf, const void *src_struct)
+{
+    const transmitter_telemetry *src = (const transmitter_telemetry*)src_struct;
+    if (!pb_direct_is_zero32(&src->reflectedPower)) { *buf++ = 0x0d; buf = pb_direct_put_fixed32(buf, &src->reflectedPower); }
+    if (!pb_direct_is_zero32(&src->forwardPower)) { *buf++ = 0x15; buf = pb_direct_put_fixed32(buf, &src->forwardPower); }
+    if (!pb_direct_is_zero32(&src->busVoltage)) { *buf++ = 0x1d; buf = pb_direct_put_fixed32(buf, &src->busVoltage); }
+    if (!pb_direct_is_zero32(&src->totalCurrent)) { *buf++ = 0x25; buf = pb_direct_put_fixed32(buf, &src->totalCurrent); }
+    if (!pb_direct_is_zero32(&src->txCurrent)) { *buf++ = 0x2d; buf = pb_direct_put_fixed32(buf, &src->txCurrent); }
+    if (!pb_direct_is_zero32(&src->rxCurrent)) { *buf++ = 0x35; buf = pb_direct_put_fixed32(buf, &src->rxCurrent); }
+    if (!pb_direct_is_zero32(&src->powerAmplifierCurrent)) { *buf++ = 0x3d; buf = pb_direct_put_fixed32(buf, &src->powerAmplifierCurrent); }
+    if (!pb_direct_is_zero32(&src->powerAmplifierTemperature)) { *buf++ = 0x45; buf = pb_direct_put_fixed32(buf, &src->powerAmplifierTemperature); }
+    if (!pb_direct_is_zero32(&src->boardTemperature)) { *buf++ = 0x4d; buf = pb_direct_put_fixed32(buf, &src->boardTemperature); }
+    if (src->uptime) { *buf++ = 0x50; buf = pb_direct_put_varint(buf, (uint32_t)src->uptime); }
+    return buf;
+}
+
+bool transmitter_telemetry_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    memset(dest_struct, 0, sizeof(transmitter_telemetry));
+    return transmitter_telemetry_merge_direct(buf, size, dest_struct);
+}
+
+bool transmitter_telemetry_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    transmitter_telemetry *dest = (transmitter_telemetry*)dest_struct;
+    const pb_byte_t *end = buf + size;
+    while (buf < end)
+    {
+        uint64_t key, value;
+        if (!pb_direct_read_varint(&buf, end, &key))
+            return false;
+        switch (key)
+        {
+            case PB_DIRECT_KEY(1, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->reflectedPower))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(2, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->forwardPower))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(3, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->busVoltage))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(4, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->totalCurrent))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(5, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->txCurrent))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(6, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->rxCurrent))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(7, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->powerAmplifierCurrent))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(8, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->powerAmplifierTemperature))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(9, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->boardTemperature))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(10, PB_WT_VARINT):
+                if (!pb_direct_read_varint(&buf, end, &value) || (uint64_t)(uint32_t)value != value)
+                    return false;
+                dest->uptime = (uint32_t)value;
+                break;
+            default:
+                if (!pb_direct_skip(&buf, end, (uint32_t)(key & 7)))
+                    return false;
+                break;
+        }
+    }
+    return true;
+}
+
+size_t transceiver_telemetry_encoded_size_direct(const void *src_struct)
+{
+    const transceiver_telemetry *src = (const transceiver_telemetry*)src_struct;
+    size_t size = 0;
+    { size_t n = receiver_telemetry_encoded_size_direct(&src->receiver); if (n) size += 1 + pb_direct_varint_size((uint32_t)n) + n; }
+    { size_t n = transmitter_telemetry_encoded_size_direct(&src->transmitter); if (n) size += 1 + pb_direct_varint_size((uint32_t)n) + n; }
+    return size;
+}
+
+pb_byte_t *transceiver_telemetry_encode_direct(pb_byte_t *buf, const void *src_struct)
+{
+    const transceiver_telemetry *src = (const transceiver_telemetry*)src_struct;
+    { size_t n = receiver_telemetry_encoded_size_direct(&src->receiver); if (n) { *buf++ = 0x0a; buf = pb_direct_put_varint(buf, (uint32_t)n); buf = receiver_telemetry_encode_direct(buf, &src->receiver); } }
+    { size_t n = transmitter_telemetry_encoded_size_direct(&src->transmitter); if (n) { *buf++ = 0x12; buf = pb_direct_put_varint(buf, (uint32_t)n); buf = transmitter_telemetry_encode_direct(buf, &src->transmitter); } }
+    return buf;
+}
+
+bool transceiver_telemetry_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    memset(dest_struct, 0, sizeof(transceiver_telemetry));
+    return transceiver_telemetry_merge_direct(buf, size, dest_struct);
+}
+
+bool transceiver_telemetry_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    transceiver_telemetry *dest = (transceiver_telemetry*)dest_struct;
+    const pb_byte_t *end = buf + size;
+    while (buf < end)
+    {
+        uint64_t key, value;
+        if (!pb_direct_read_varint(&buf, end, &key))
+            return false;
+        switch (key)
+        {
+            case PB_DIRECT_KEY(1, PB_WT_STRING):
+                if (!pb_direct_read_varint(&buf, end, &value) || value > (uint64_t)(end - buf)
+                    || !receiver_telemetry_merge_direct(buf, (size_t)value, &dest->receiver))
+                    return false;
+                buf += (size_t)value;
+                break;
+            case PB_DIRECT_KEY(2, PB_WT_STRING):
+                if (!pb_direct_read_varint(&buf, end, &value) || value > (uint64_t)(end - buf)
+                    || !transmitter_telemetry_merge_direct(buf, (size_t)value, &dest->transmitter))
+                    return false;
+                buf += (size_t)value;
+                break;
+            default:
+                if (!pb_direct_skip(&buf, end, (uint32_t)(key & 7)))
+                    return false;
+                break;
+        }
+    }
+    return true;
+}
+
+size_t sun_sensor_data_encoded_size_direct(const void *src_struct)
+{
+    const sun_sensor_data *src = (const sun_sensor_data*)src_struct;
+    size_t size = 0;
+    if (!pb_direct_is_zero32(&src->xPos)) size += 5;
+    if (!pb_direct_is_zero32(&src->xNeg)) size += 5;
+    if (!pb_direct_is_zero32(&src->yPos)) size += 5;
+    if (!pb_direct_is_zero32(&src->yNeg)) size += 5;
+    if (!pb_direct_is_zero32(&src->zPos)) size += 5;
+    if (!pb_direct_is_zero32(&src->zNeg)) size += 5;
+    return size;
+}
+
+pb_byte_t *sun_sensor_data_encode_direct(pb_byte_t *buf, const void *src_struct)
+{
+    const sun_sensor_data *src = (const sun_sensor_data*)src_struct;
+    if (!pb_direct_is_zero32(&src->xPos)) { *buf++ = 0x0d; buf = pb_direct_put_fixed32(buf, &src->xPos); }
+    if (!pb_direct_is_zero32(&src->xNeg)) { *buf++ = 0x15; buf = pb_direct_put_fixed32(buf, &src->xNeg); }
+    if (!pb_direct_is_zero32(&src->yPos)) { *buf++ = 0x1d; buf = pb_direct_put_fixed32(buf, &src->yPos); }
+    if (!pb_direct_is_zero32(&src->yNeg)) { *buf++ = 0x25; buf = pb_direct_put_fixed32(buf, &src->yNeg); }
+    if (!pb_direct_is_zero32(&src->zPos)) { *buf++ = 0x2d; buf = pb_direct_put_fixed32(buf, &src->zPos); }
+    if (!pb_direct_is_zero32(&src->zNeg)) { *buf++ = 0x35; buf = pb_direct_put_fixed32(buf, &src->zNeg); }
+    return buf;
+}
+
+bool sun_sensor_data_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    memset(dest_struct, 0, sizeof(sun_sensor_data));
+    return sun_sensor_data_merge_direct(buf, size, dest_struct);
+}
+
+bool sun_sensor_data_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    sun_sensor_data *dest = (sun_sensor_data*)dest_struct;
+    const pb_byte_t *end = buf + size;
+    while (buf < end)
+    {
+        uint64_t key;
+        if (!pb_direct_read_varint(&buf, end, &key))
+            return false;
+        switch (key)
+        {
+            case PB_DIRECT_KEY(1, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->xPos))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(2, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->xNeg))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(3, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->yPos))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(4, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->yNeg))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(5, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->zPos))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(6, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->zNeg))
+                    return false;
+                break;
+            default:
+                if (!pb_direct_skip(&buf, end, (uint32_t)(key & 7)))
+                    return false;
+                break;
+        }
+    }
+    return true;
+}
+
+size_t eps_telemetry_encoded_size_direct(const void *src_struct)
+{
+    const eps_telemetry *src = (const eps_telemetry*)src_struct;
+    size_t size = 0;
+    { size_t n = sun_sensor_data_encoded_size_direct(&src->sunSensorData); if (n) size += 1 + pb_direct_varint_size((uint32_t)n) + n; }
+    if (!pb_direct_is_zero32(&src->outputVoltageBCR)) size += 5;
+    if (!pb_direct_is_zero32(&src->outputVoltageBatteryBus)) size += 5;
+    if (!pb_direct_is_zero32(&src->outputVoltage5VBus)) size += 5;
+    if (!pb_direct_is_zero32(&src->outputVoltage3V3Bus)) size += 5;
+    if (!pb_direct_is_zero32(&src->outputCurrentBCR_mA)) size += 5;
+    if (!pb_direct_is_zero32(&src->outputCurrentBatteryBus)) size += 5;
+    if (!pb_direct_is_zero32(&src->outputCurrent5VBus)) size += 5;
+    if (!pb_direct_is_zero32(&src->outputCurrent3V3Bus)) size += 5;
+    if (!pb_direct_is_zero32(&src->PdbTemperature)) size += 5;
+    return size;
+}
+
+pb_byte_t *eps_telemetry_encode_direct(pb_byte_t *buf, const void *src_struct)
+{
+    const eps_telemetry *src = (const eps_telemetry*)src_struct;
+    { size_t n = sun_sensor_data_encoded_size_direct(&src->sunSensorData); if (n) { *buf++ = 0x0a; buf = pb_direct_put_varint(buf, (uint32_t)n); buf = sun_sensor_data_encode_direct(buf, &src->sunSensorData); } }
+    if (!pb_direct_is_zero32(&src->outputVoltageBCR)) { *buf++ = 0x15; buf = pb_direct_put_fixed32(buf, &src->outputVoltageBCR); }
+    if (!pb_direct_is_zero32(&src->outputVoltageBatteryBus)) { *buf++ = 0x1d; buf = pb_direct_put_fixed32(buf, &src->outputVoltageBatteryBus); }
+    if (!pb_direct_is_zero32(&src->outputVoltage5VBus)) { *buf++ = 0x25; buf = pb_direct_put_fixed32(buf, &src->outputVoltage5VBus); }
+    if (!pb_direct_is_zero32(&src->outputVoltage3V3Bus)) { *buf++ = 0x2d; buf = pb_direct_put_fixed32(buf, &src->outputVoltage3V3Bus); }
+    if (!pb_direct_is_zero32(&src->outputCurrentBCR_mA)) { *buf++ = 0x35; buf = pb_direct_put_fixed32(buf, &src->outputCurrentBCR_mA); }
+    if (!pb_direct_is_zero32(&src->outputCurrentBatteryBus)) { *buf++ = 0x3d; buf = pb_direct_put_fixed32(buf, &src->outputCurrentBatteryBus); }
+    if (!pb_direct_is_zero32(&src->outputCurrent5VBus)) { *buf++ = 0x45; buf = pb_direct_put_fixed32(buf, &src->outputCurrent5VBus); }
+    if (!pb_direct_is_zero32(&src->outputCurrent3V3Bus)) { *buf++ = 0x4d; buf = pb_direct_put_fixed32(buf, &src->outputCurrent3V3Bus); }
+    if (!pb_direct_is_zero32(&src->PdbTemperature)) { *buf++ = 0x55; buf = pb_direct_put_fixed32(buf, &src->PdbTemperature); }
+    return buf;
+}
+
+bool eps_telemetry_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    memset(dest_struct, 0, sizeof(eps_telemetry));
+    return eps_telemetry_merge_direct(buf, size, dest_struct);
+}
+
+bool eps_telemetry_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    eps_telemetry *dest = (eps_telemetry*)dest_struct;
+    const pb_byte_t *end = buf + size;
+    while (buf < end)
+    {
+        uint64_t key, value;
+        if (!pb_direct_read_varint(&buf, end, &key))
+            return false;
+        switch (key)
+        {
+            case PB_DIRECT_KEY(1, PB_WT_STRING):
+                if (!pb_direct_read_varint(&buf, end, &value) || value > (uint64_t)(end - buf)
+                    || !sun_sensor_data_merge_direct(buf, (size_t)value, &dest->sunSensorData))
+                    return false;
+                buf += (size_t)value;
+                break;
+            case PB_DIRECT_KEY(2, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputVoltageBCR))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(3, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputVoltageBatteryBus))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(4, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputVoltage5VBus))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(5, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputVoltage3V3Bus))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(6, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputCurrentBCR_mA))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(7, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputCurrentBatteryBus))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(8, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputCurrent5VBus))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(9, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputCurrent3V3Bus))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(10, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->PdbTemperature))
+                    return false;
+                break;
+            default:
+                if (!pb_direct_skip(&buf, end, (uint32_t)(key & 7)))
+                    return false;
+                break;
+        }
+    }
+    return true;
+}
+
+size_t battery_telemetry_encoded_size_direct(const void *src_struct)
+{
+    const battery_telemetry *src = (const battery_telemetry*)src_struct;
+    size_t size = 0;
+    if (!pb_direct_is_zero32(&src->outputVoltageBatteryBus)) size += 5;
+    if (!pb_direct_is_zero32(&src->outputVoltage5VBus)) size += 5;
+    if (!pb_direct_is_zero32(&src->outputVoltage3V3Bus)) size += 5;
+    if (!pb_direct_is_zero32(&src->outputCurrentBatteryBus)) size += 5;
+    if (!pb_direct_is_zero32(&src->outputCurrent5VBus)) size += 5;
+    if (!pb_direct_is_zero32(&src->outputCurrent3V3Bus)) size += 5;
+    if (!pb_direct_is_zero32(&src->batteryCurrentDirection)) size += 5;
+    if (!pb_direct_is_zero32(&src->motherboardTemp)) size += 5;
+    if (!pb_direct_is_zero32(&src->daughterboardTemp1)) size += 5;
+    if (!pb_direct_is_zero32(&src->daughterboardTemp2)) size += 5;
+    if (!pb_direct_is_zero32(&src->daughterboardTemp3)) size += 5;
+    return size;
+}
+
+pb_byte_t *battery_telemetry_encode_direct(pb_byte_t *buf, const void *src_struct)
+{
+    const battery_telemetry *src = (const battery_telemetry*)src_struct;
+    if (!pb_direct_is_zero32(&src->outputVoltageBatteryBus)) { *buf++ = 0x0d; buf = pb_direct_put_fixed32(buf, &src->outputVoltageBatteryBus); }
+    if (!pb_direct_is_zero32(&src->outputVoltage5VBus)) { *buf++ = 0x15; buf = pb_direct_put_fixed32(buf, &src->outputVoltage5VBus); }
+    if (!pb_direct_is_zero32(&src->outputVoltage3V3Bus)) { *buf++ = 0x1d; buf = pb_direct_put_fixed32(buf, &src->outputVoltage3V3Bus); }
+    if (!pb_direct_is_zero32(&src->outputCurrentBatteryBus)) { *buf++ = 0x25; buf = pb_direct_put_fixed32(buf, &src->outputCurrentBatteryBus); }
+    if (!pb_direct_is_zero32(&src->outputCurrent5VBus)) { *buf++ = 0x2d; buf = pb_direct_put_fixed32(buf, &src->outputCurrent5VBus); }
+    if (!pb_direct_is_zero32(&src->outputCurrent3V3Bus)) { *buf++ = 0x35; buf = pb_direct_put_fixed32(buf, &src->outputCurrent3V3Bus); }
+    if (!pb_direct_is_zero32(&src->batteryCurrentDirection)) { *buf++ = 0x3d; buf = pb_direct_put_fixed32(buf, &src->batteryCurrentDirection); }
+    if (!pb_direct_is_zero32(&src->motherboardTemp)) { *buf++ = 0x45; buf = pb_direct_put_fixed32(buf, &src->motherboardTemp); }
+    if (!pb_direct_is_zero32(&src->daughterboardTemp1)) { *buf++ = 0x4d; buf = pb_direct_put_fixed32(buf, &src->daughterboardTemp1); }
+    if (!pb_direct_is_zero32(&src->daughterboardTemp2)) { *buf++ = 0x55; buf = pb_direct_put_fixed32(buf, &src->daughterboardTemp2); }
+    if (!pb_direct_is_zero32(&src->daughterboardTemp3)) { *buf++ = 0x5d; buf = pb_direct_put_fixed32(buf, &src->daughterboardTemp3); }
+    return buf;
+}
+
+bool battery_telemetry_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    memset(dest_struct, 0, sizeof(battery_telemetry));
+    return battery_telemetry_merge_direct(buf, size, dest_struct);
+}
+
+bool battery_telemetry_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    battery_telemetry *dest = (battery_telemetry*)dest_struct;
+    const pb_byte_t *end = buf + size;
+    while (buf < end)
+    {
+        uint64_t key;
+        if (!pb_direct_read_varint(&buf, end, &key))
+            return false;
+        switch (key)
+        {
+            case PB_DIRECT_KEY(1, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputVoltageBatteryBus))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(2, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputVoltage5VBus))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(3, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputVoltage3V3Bus))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(4, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputCurrentBatteryBus))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(5, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputCurrent5VBus))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(6, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->outputCurrent3V3Bus))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(7, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->batteryCurrentDirection))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(8, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->motherboardTemp))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(9, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->daughterboardTemp1))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(10, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->daughterboardTemp2))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(11, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->daughterboardTemp3))
+                    return false;
+                break;
+            default:
+                if (!pb_direct_skip(&buf, end, (uint32_t)(key & 7)))
+                    return false;
+                break;
+        }
+    }
+    return true;
+}
+
+size_t dosimeter_board_data_encoded_size_direct(const void *src_struct)
+{
+    const dosimeter_board_data *src = (const dosimeter_board_data*)src_struct;
+    size_t size = 0;
+    if (!pb_direct_is_zero32(&src->channelZero)) size += 5;
+    if (!pb_direct_is_zero32(&src->channelOne)) size += 5;
+    if (!pb_direct_is_zero32(&src->channelTwo)) size += 5;
+    if (!pb_direct_is_zero32(&src->channelThree)) size += 5;
+    if (!pb_direct_is_zero32(&src->channelFour)) size += 5;
+    if (!pb_direct_is_zero32(&src->channelFive)) size += 5;
+    if (!pb_direct_is_zero32(&src->channelSix)) size += 5;
+    if (!pb_direct_is_zero32(&src->channelSeven)) size += 5;
+    return size;
+}
+
+pb_byte_t *dosimeter_board_data_encode_direct(pb_byte_t *buf, const void *src_struct)
+{
+    const dosimeter_board_data *src = (const dosimeter_board_data*)src_struct;
+    if (!pb_direct_is_zero32(&src->channelZero)) { *buf++ = 0x0d; buf = pb_direct_put_fixed32(buf, &src->channelZero); }
+    if (!pb_direct_is_zero32(&src->channelOne)) { *buf++ = 0x15; buf = pb_direct_put_fixed32(buf, &src->channelOne); }
+    if (!pb_direct_is_zero32(&src->channelTwo)) { *buf++ = 0x1d; buf = pb_direct_put_fixed32(buf, &src->channelTwo); }
+    if (!pb_direct_is_zero32(&src->channelThree)) { *buf++ = 0x25; buf = pb_direct_put_fixed32(buf, &src->channelThree); }
+    if (!pb_direct_is_zero32(&src->channelFour)) { *buf++ = 0x2d; buf = pb_direct_put_fixed32(buf, &src->channelFour); }
+    if (!pb_direct_is_zero32(&src->channelFive)) { *buf++ = 0x35; buf = pb_direct_put_fixed32(buf, &src->channelFive); }
+    if (!pb_direct_is_zero32(&src->channelSix)) { *buf++ = 0x3d; buf = pb_direct_put_fixed32(buf, &src->channelSix); }
+    if (!pb_direct_is_zero32(&src->channelSeven)) { *buf++ = 0x45; buf = pb_direct_put_fixed32(buf, &src->channelSeven); }
+    return buf;
+}
+
+bool dosimeter_board_data_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    memset(dest_struct, 0, sizeof(dosimeter_board_data));
+    return dosimeter_board_data_merge_direct(buf, size, dest_struct);
+}
+
+bool dosimeter_board_data_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    dosimeter_board_data *dest = (dosimeter_board_data*)dest_struct;
+    const pb_byte_t *end = buf + size;
+    while (buf < end)
+    {
+        uint64_t key;
+        if (!pb_direct_read_varint(&buf, end, &key))
+            return false;
+        switch (key)
+        {
+            case PB_DIRECT_KEY(1, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->channelZero))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(2, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->channelOne))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(3, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->channelTwo))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(4, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->channelThree))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(5, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->channelFour))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(6, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->channelFive))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(7, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->channelSix))
+                    return false;
+                break;
+            case PB_DIRECT_KEY(8, PB_WT_32BIT):
+                if (!pb_direct_read_fixed32(&buf, end, &dest->channelSeven))
+                    return false;
+                break;
+            default:
+                if (!pb_direct_skip(&buf, end, (uint32_t)(key & 7)))
+                    return false;
+                break;
+        }
+    }
+    return true;
+}
+
+size_t dosimeter_data_encoded_size_direct(const void *src_struct)
+{
+    const dosimeter_data *src = (const dosimeter_data*)src_struct;
+    size_t size = 0;
+    { size_t n = dosimeter_board_data_encoded_size_direct(&src->boardOne); if (n) size += 1 + pb_direct_varint_size((uint32_t)n) + n; }
+    { size_t n = dosimeter_board_data_encoded_size_direct(&src->boardTwo); if (n) size += 1 + pb_direct_varint_size((uint32_t)n) + n; }
+    return size;
+}
+
+pb_byte_t *dosimeter_data_encode_direct(pb_byte_t *buf, const void *src_struct)
+{
+    const dosimeter_data *src = (const dosimeter_data*)src_struct;
+    { size_t n = dosimeter_board_data_encoded_size_direct(&src->boardOne); if (n) { *buf++ = 0x0a; buf = pb_direct_put_varint(buf, (uint32_t)n); buf = dosimeter_board_data_encode_direct(buf, &src->boardOne); } }
+    { size_t n = dosimeter_board_data_encoded_size_direct(&src->boardTwo); if (n) { *buf++ = 0x12; buf = pb_direct_put_varint(buf, (uint32_t)n); buf = dosimeter_board_data_encode_direct(buf, &src->boardTwo); } }
+    return buf;
+}
+
+bool dosimeter_data_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    memset(dest_struct, 0, sizeof(dosimeter_data));
+    return dosimeter_data_merge_direct(buf, size, dest_struct);
+}
+
+bool dosimeter_data_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct)
+{
+    dosimeter_data *dest = (dosimeter_data*)dest_struct;
+    const pb_byte_t *end = buf + size;
+    while (buf < end)
+    {
+        uint64_t key, value;
+        if (!pb_direct_read_varint(&buf, end, &key))
+            return false;
+        switch (key)
+        {
+            case PB_DIRECT_KEY(1, PB_WT_STRING):
+                if (!pb_direct_read_varint(&buf, end, &value) || value > (uint64_t)(end - buf)
+                    || !dosimeter_board_data_merge_direct(buf, (size_t)value, &dest->boardOne))
+                    return false;
+                buf += (size_t)value;
+                break;
+            case PB_DIRECT_KEY(2, PB_WT_STRING):
+                if (!pb_direct_read_varint(&buf, end, &value) || value > (uint64_t)(end - buf)
+                    || !dosimeter_board_data_merge_direct(buf, (size_t)value, &dest->boardTwo))
+                    return false;
+                buf += (size_t)value;
+                break;
+            default:
+                if (!pb_direct_skip(&buf, end, (uint32_t)(key & 7)))
+                    return false;
+                break;
+        }
+    }
+    return true;
+}
+
 
 
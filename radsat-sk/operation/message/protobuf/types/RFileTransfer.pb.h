@@ -14,9 +14,15 @@ typedef enum _image_type_t {
     image_type_t_FullResolution = 0,
     image_type_t_HalfResolution = 1,
     image_type_t_QuarterResolution = 2,
-    image_type_t_Thumbnail = 3
+    image_type_t_Thumbnail = 3,
+    image_type_t_EighthResolution = 4
 } image_type_t;
 
+typedef enum _image_encoding_t {
+    image_encoding_t_Raw = 0,
+    image_encoding_t_Compressed = 1
+} image_encoding_t;
+
 /* Struct definitions */
 typedef struct _antenna_side_data {
     uint32_t deployedAntenna1;
@@ -76,6 +82,11 @@ typedef struct _dosimeter_board_data {
     float channelSeven;
 } dosimeter_board_data;
 
+typedef struct _dosimeter_counts {
+    uint16_t boardOne[8];
+    uint16_t boardTwo[8];
+} dosimeter_counts;
+
 typedef struct _error_record {
     uint32_t timeRecorded;
     uint8_t count;
@@ -86,11 +97,15 @@ typedef struct _error_report_summary {
     uint8_t componentErrorCount[19];
 } error_report_summary;
 
-typedef PB_BYTES_ARRAY_T(200) image_packet_data_t;
+typedef PB_BYTES_ARRAY_T(188) image_packet_data_t;
 typedef struct _image_packet {
     uint32_t id;
     image_type_t type;
     image_packet_data_t data;
+    uint16_t frame;
+    image_encoding_t encoding;
+    uint8_t frames;
+    uint8_t maxError;
 } image_packet;
 
 typedef struct _module_error_report {
@@ -158,6 +173,13 @@ typedef struct _dosimeter_data {
     dosimeter_board_data boardTwo;
 } dosimeter_data;
 
+typedef PB_BYTES_ARRAY_T(136) dosimeter_series_records_t;
+typedef struct _dosimeter_series {
+    dosimeter_counts keyframe;
+    uint32_t time;
+    dosimeter_series_records_t records;
+} dosimeter_series;
+
 typedef struct _eps_telemetry {
     sun_sensor_data sunSensorData;
     float outputVoltageBCR;
@@ -190,14 +212,20 @@ typedef struct _file_transfer_message {
         module_error_report ModuleErrorReport;
         component_error_report ComponentErrorReport;
         error_report_summary ErrorReportSummary;
+        dosimeter_counts DosimeterCounts;
+        dosimeter_series DosimeterSeries;
     };
 } file_transfer_message;
 
 
 /* Helper constants for enums */
 #define _image_type_t_MIN image_type_t_FullResolution
-#define _image_type_t_MAX image_type_t_Thumbnail
-#define _image_type_t_ARRAYSIZE ((image_type_t)(image_type_t_Thumbnail+1))
+#define _image_type_t_MAX image_type_t_EighthResolution
+#define _image_type_t_ARRAYSIZE ((image_type_t)(image_type_t_EighthResolution+1))
+
+#define _image_encoding_t_MIN image_encoding_t_Raw
+#define _image_encoding_t_MAX image_encoding_t_Compressed
+#define _image_encoding_t_ARRAYSIZE ((image_encoding_t)(image_encoding_t_Compressed+1))
 
 
 #ifdef __cplusplus
@@ -220,7 +248,9 @@ extern "C" {
 #define antenna_telemetry_init_default           {antenna_side_data_init_default, antenna_side_data_init_default}
 #define dosimeter_board_data_init_default        {0, 0, 0, 0, 0, 0, 0, 0}
 #define dosimeter_data_init_default              {dosimeter_board_data_init_default, dosimeter_board_data_init_default}
-#define image_packet_init_default                {0, _image_type_t_MIN, {0, {0}}}
+#define dosimeter_counts_init_default            {{0, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 0}}
+#define dosimeter_series_init_default            {dosimeter_counts_init_default, 0, {0, {0}}}
+#define image_packet_init_default                {0, _image_type_t_MIN, {0, {0}}, 0, _image_encoding_t_MIN, 0, 0}
 #define module_error_report_init_default         {0, 0}
 #define component_error_report_init_default      {0, 0}
 #define error_record_init_default                {0, 0}
@@ -240,7 +270,9 @@ extern "C" {
 #define antenna_telemetry_init_zero              {antenna_side_data_init_zero, antenna_side_data_init_zero}
 #define dosimeter_board_data_init_zero           {0, 0, 0, 0, 0, 0, 0, 0}
 #define dosimeter_data_init_zero                 {dosimeter_board_data_init_zero, dosimeter_board_data_init_zero}
-#define image_packet_init_zero                   {0, _image_type_t_MIN, {0, {0}}}
+#define dosimeter_counts_init_zero               {{0, 0, 0, 0, 0, 0, 0, 0}, {0, 0, 0, 0, 0, 0, 0, 0}}
+#define dosimeter_series_init_zero               {dosimeter_counts_init_zero, 0, {0, {0}}}
+#define image_packet_init_zero                   {0, _image_type_t_MIN, {0, {0}}, 0, _image_encoding_t_MIN, 0, 0}
 #define module_error_report_init_zero            {0, 0}
 #define component_error_report_init_zero         {0, 0}
 #define error_record_init_zero                   {0, 0}
@@ -287,6 +319,8 @@ extern "C" {
 #define dosimeter_board_data_channelFive_tag     6
 #define dosimeter_board_data_channelSix_tag      7
 #define dosimeter_board_data_channelSeven_tag    8
+#define dosimeter_counts_boardOne_tag            1
+#define dosimeter_counts_boardTwo_tag            2
 #define error_record_timeRecorded_tag            1
 #define error_record_count_tag                   2
 #define error_report_summary_moduleErrorCount_tag 1
@@ -294,6 +328,10 @@ extern "C" {
 #define image_packet_id_tag                      1
 #define image_packet_type_tag                    2
 #define image_packet_data_tag                    3
+#define image_packet_frame_tag                   4
+#define image_packet_encoding_tag                5
+#define image_packet_frames_tag                  6
+#define image_packet_maxError_tag                7
 #define module_error_report_module_tag           1
 #define module_error_report_error_tag            2
 #define obc_telemetry_mode_tag                   1
@@ -335,6 +373,9 @@ extern "C" {
 #define camera_telemetry_cameraTwoTelemetry_tag  4
 #define dosimeter_data_boardOne_tag              1
 #define dosimeter_data_boardTwo_tag              2
+#define dosimeter_series_keyframe_tag            1
+#define dosimeter_series_time_tag                2
+#define dosimeter_series_records_tag             3
 #define eps_telemetry_sunSensorData_tag          1
 #define eps_telemetry_outputVoltageBCR_tag       2
 #define eps_telemetry_outputVoltageBatteryBus_tag 3
@@ -358,6 +399,8 @@ extern "C" {
 #define file_transfer_message_ModuleErrorReport_tag 9
 #define file_transfer_message_ComponentErrorReport_tag 10
 #define file_transfer_message_ErrorReportSummary_tag 11
+#define file_transfer_message_DosimeterCounts_tag 12
+#define file_transfer_message_DosimeterSeries_tag 13
 
 /* Struct field encoding specification for nanopb */
 #define file_transfer_message_FIELDLIST(X, a) \
@@ -371,7 +414,9 @@ X(a, STATIC,   ONEOF,    MESSAGE,  (message,DosimeterData,DosimeterData),   7) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (message,ImagePacket,ImagePacket),   8) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (message,ModuleErrorReport,ModuleErrorReport),   9) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (message,ComponentErrorReport,ComponentErrorReport),  10) \
-X(a, STATIC,   ONEOF,    MESSAGE,  (message,ErrorReportSummary,ErrorReportSummary),  11)
+X(a, STATIC,   ONEOF,    MESSAGE,  (message,ErrorReportSummary,ErrorReportSummary),  11) \
+X(a, STATIC,   ONEOF,    MESSAGE,  (message,DosimeterCounts,DosimeterCounts),  12) \
+X(a, STATIC,   ONEOF,    MESSAGE,  (message,DosimeterSeries,DosimeterSeries),  13)
 #define file_transfer_message_CALLBACK NULL
 #define file_transfer_message_DEFAULT NULL
 #define file_transfer_message_message_ObcTelemetry_MSGTYPE obc_telemetry
@@ -385,6 +430,8 @@ X(a, STATIC,   ONEOF,    MESSAGE,  (message,ErrorReportSummary,ErrorReportSummar
 #define file_transfer_message_message_ModuleErrorReport_MSGTYPE module_error_report
 #define file_transfer_message_message_ComponentErrorReport_MSGTYPE component_error_report
 #define file_transfer_message_message_ErrorReportSummary_MSGTYPE error_report_summary
+#define file_transfer_message_message_DosimeterCounts_MSGTYPE dosimeter_counts
+#define file_transfer_message_message_DosimeterSeries_MSGTYPE dosimeter_series
 
 #define obc_telemetry_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, UINT32,   mode,              1) \
@@ -541,10 +588,28 @@ X(a, STATIC,   SINGULAR, MESSAGE,  boardTwo,          2)
 #define dosimeter_data_boardOne_MSGTYPE dosimeter_board_data
 #define dosimeter_data_boardTwo_MSGTYPE dosimeter_board_data
 
+#define dosimeter_counts_FIELDLIST(X, a) \
+X(a, STATIC,   FIXARRAY, UINT32,   boardOne,          1) \
+X(a, STATIC,   FIXARRAY, UINT32,   boardTwo,          2)
+#define dosimeter_counts_CALLBACK NULL
+#define dosimeter_counts_DEFAULT NULL
+
+#define dosimeter_series_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, MESSAGE,  keyframe,          1) \
+X(a, STATIC,   SINGULAR, UINT32,   time,              2) \
+X(a, STATIC,   SINGULAR, BYTES,    records,           3)
+#define dosimeter_series_CALLBACK NULL
+#define dosimeter_series_DEFAULT NULL
+#define dosimeter_series_keyframe_MSGTYPE dosimeter_counts
+
 #define image_packet_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, UINT32,   id,                1) \
 X(a, STATIC,   SINGULAR, UENUM,    type,              2) \
-X(a, STATIC,   SINGULAR, BYTES,    data,              3)
+X(a, STATIC,   SINGULAR, BYTES,    data,              3) \
+X(a, STATIC,   SINGULAR, UINT32,   frame,             4) \
+X(a, STATIC,   SINGULAR, UENUM,    encoding,          5) \
+X(a, STATIC,   SINGULAR, UINT32,   frames,            6) \
+X(a, STATIC,   SINGULAR, UINT32,   maxError,          7)
 #define image_packet_CALLBACK NULL
 #define image_packet_DEFAULT NULL
 
@@ -587,6 +652,8 @@ extern const pb_msgdesc_t antenna_side_data_msg;
 extern const pb_msgdesc_t antenna_telemetry_msg;
 extern const pb_msgdesc_t dosimeter_board_data_msg;
 extern const pb_msgdesc_t dosimeter_data_msg;
+extern const pb_msgdesc_t dosimeter_counts_msg;
+extern const pb_msgdesc_t dosimeter_series_msg;
 extern const pb_msgdesc_t image_packet_msg;
 extern const pb_msgdesc_t module_error_report_msg;
 extern const pb_msgdesc_t component_error_report_msg;
@@ -609,6 +676,8 @@ extern const pb_msgdesc_t error_report_summary_msg;
 #define antenna_telemetry_fields &antenna_telemetry_msg
 #define dosimeter_board_data_fields &dosimeter_board_data_msg
 #define dosimeter_data_fields &dosimeter_data_msg
+#define dosimeter_counts_fields &dosimeter_counts_msg
+#define dosimeter_series_fields &dosimeter_series_msg
 #define image_packet_fields &image_packet_msg
 #define module_error_report_fields &module_error_report_msg
 #define component_error_report_fields &component_error_report_msg
@@ -631,12 +700,59 @@ extern const pb_msgdesc_t error_report_summary_msg;
 #define antenna_telemetry_size                   86
 #define dosimeter_board_data_size                40
 #define dosimeter_data_size                      84
+#define dosimeter_counts_size                    64
+#define dosimeter_series_size                    211
 #define image_packet_size                        211
 #define module_error_report_size                 17
 #define component_error_report_size              17
 #define error_record_size                        9
 #define error_report_summary_size                144
 
+/* Direct (straight-line) coders for fixed-layout messages */
+size_t receiver_telemetry_encoded_size_direct(const void *src_struct);
+pb_byte_t *receiver_telemetry_encode_direct(pb_byte_t *buf, const void *src_struct);
+bool receiver_telemetry_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+bool receiver_telemetry_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+size_t transmitter_telemetry_encoded_size_direct(const void *src_struct);
+pb_byte_t *transmitter_telemetry_encode_direct(pb_byte_t *buf, const void *src_struct);
+bool transmitter_telemetry_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+bool transmitter_telemetry_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+size_t transceiver_telemetry_encoded_size_direct(const void *src_struct);
+pb_byte_t *transceiver_telemetry_encode_direct(pb_byte_t *buf, const void *src_struct);
+bool transceiver_telemetry_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+bool transceiver_telemetry_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+size_t sun_sensor_data_encoded_size_direct(const void *src_struct);
+pb_byte_t *sun_sensor_data_encode_direct(pb_byte_t *buf, const void *src_struct);
+bool sun_sensor_data_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+bool sun_sensor_data_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+size_t eps_telemetry_encoded_size_direct(const void *src_struct);
+pb_byte_t *eps_telemetry_encode_direct(pb_byte_t *buf, const void *src_struct);
+bool eps_telemetry_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+bool eps_telemetry_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+size_t battery_telemetry_encoded_size_direct(const void *src_struct);
+pb_byte_t *battery_telemetry_encode_direct(pb_byte_t *buf, const void *src_struct);
+bool battery_telemetry_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+bool battery_telemetry_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+size_t dosimeter_board_data_encoded_size_direct(const void *src_struct);
+pb_byte_t *dosimeter_board_data_encode_direct(pb_byte_t *buf, const void *src_struct);
+bool dosimeter_board_data_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+bool dosimeter_board_data_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+size_t dosimeter_data_encoded_size_direct(const void *src_struct);
+pb_byte_t *dosimeter_data_encode_direct(pb_byte_t *buf, const void *src_struct);
+bool dosimeter_data_decode_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+bool dosimeter_data_merge_direct(const pb_byte_t *buf, size_t size, void *dest_struct);
+
+/* Messages with direct coders, as PB_DIRECT(message) entries */
+#define RFILETRANSFER_DIRECT_MESSAGES \
+    PB_DIRECT(receiver_telemetry) \
+    PB_DIRECT(transmitter_telemetry) \
+    PB_DIRECT(transceiver_telemetry) \
+    PB_DIRECT(sun_sensor_data) \
+    PB_DIRECT(eps_telemetry) \
+    PB_DIRECT(battery_telemetry) \
+    PB_DIRECT(dosimeter_board_data) \
+    PB_DIRECT(dosimeter_data)
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
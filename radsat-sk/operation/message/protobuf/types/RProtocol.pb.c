@@ -15,4 +15,7 @@ PB_BIND(ack, ack, AUTO)
 PB_BIND(nack, nack, AUTO)
 
 
+PB_BIND(selective_ack, selective_ack, AUTO)
+
+
 
@@ -12,17 +12,26 @@
 /* Struct definitions */
 typedef struct _ack {
     uint32_t resp;
+    uint32_t count;
+    uint32_t executed;
 } ack;
 
 typedef struct _nack {
     uint32_t resp;
 } nack;
 
+typedef struct _selective_ack {
+    uint32_t sequence;
+    uint64_t received;
+    uint32_t window;
+} selective_ack;
+
 typedef struct _protocol_message {
     pb_size_t which_message;
     union {
         ack Ack;
         nack Nack;
+        selective_ack SelectiveAck;
     };
 } protocol_message;
 
@@ -33,29 +42,41 @@ extern "C" {
 
 /* Initializer values for message structs */
 #define protocol_message_init_default            {0, {ack_init_default}}
-#define ack_init_default                         {0}
+#define ack_init_default                         {0, 0, 0}
 #define nack_init_default                        {0}
+#define selective_ack_init_default               {0, 0, 0}
 #define protocol_message_init_zero               {0, {ack_init_zero}}
-#define ack_init_zero                            {0}
+#define ack_init_zero                            {0, 0, 0}
 #define nack_init_zero                           {0}
+#define selective_ack_init_zero                  {0, 0, 0}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define ack_resp_tag                             1
+#define ack_count_tag                            2
+#define ack_executed_tag                         3
 #define nack_resp_tag                            1
+#define selective_ack_sequence_tag               1
+#define selective_ack_received_tag               2
+#define selective_ack_window_tag                 3
 #define protocol_message_Ack_tag                 1
 #define protocol_message_Nack_tag                2
+#define protocol_message_SelectiveAck_tag        3
 
 /* Struct field encoding specification for nanopb */
 #define protocol_message_FIELDLIST(X, a) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (message,Ack,Ack),   1) \
-X(a, STATIC,   ONEOF,    MESSAGE,  (message,Nack,Nack),   2)
+X(a, STATIC,   ONEOF,    MESSAGE,  (message,Nack,Nack),   2) \
+X(a, STATIC,   ONEOF,    MESSAGE,  (message,SelectiveAck,SelectiveAck),   3)
 #define protocol_message_CALLBACK NULL
 #define protocol_message_DEFAULT NULL
 #define protocol_message_message_Ack_MSGTYPE ack
 #define protocol_message_message_Nack_MSGTYPE nack
+#define protocol_message_message_SelectiveAck_MSGTYPE selective_ack
 
 #define ack_FIELDLIST(X, a) \
-X(a, STATIC,   SINGULAR, UINT32,   resp,              1)
+X(a, STATIC,   SINGULAR, UINT32,   resp,              1) \
+X(a, STATIC,   SINGULAR, UINT32,   count,             2) \
+X(a, STATIC,   SINGULAR, UINT32,   executed,          3)
 #define ack_CALLBACK NULL
 #define ack_DEFAULT NULL
 
@@ -64,19 +85,32 @@ X(a, STATIC,   SINGULAR, UINT32,   resp,              1)
 #define nack_CALLBACK NULL
 #define nack_DEFAULT NULL
 
+#define selective_ack_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UINT32,   sequence,          1) \
+X(a, STATIC,   SINGULAR, FIXED64,  received,          2) \
+X(a, STATIC,   SINGULAR, UINT32,   window,            3)
+#define selective_ack_CALLBACK NULL
+#define selective_ack_DEFAULT NULL
+
 extern const pb_msgdesc_t protocol_message_msg;
 extern const pb_msgdesc_t ack_msg;
 extern const pb_msgdesc_t nack_msg;
+extern const pb_msgdesc_t selective_ack_msg;
 
 /* Defines for backwards compatibility with code written before nanopb-0.4.0 */
 #define protocol_message_fields &protocol_message_msg
 #define ack_fields &ack_msg
 #define nack_fields &nack_msg
+#define selective_ack_fields &selective_ack_msg
 
 /* Maximum encoded size of messages (where known) */
-#define protocol_message_size                    8
-#define ack_size                                 6
+#define protocol_message_size                    23
+#define ack_size                                 18
 #define nack_size                                6
+#define selective_ack_size                       21
+
+/* Messages with direct coders, as PB_DIRECT(message) entries */
+#define RPROTOCOL_DIRECT_MESSAGES
 
 #ifdef __cplusplus
 } /* extern "C" */
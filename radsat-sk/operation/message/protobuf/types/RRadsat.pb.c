@@ -9,4 +9,7 @@
 PB_BIND(radsat_message, radsat_message, AUTO)
 
 
+PB_BIND(file_transfer_batch, file_transfer_batch, AUTO)
+
+
 
@@ -13,12 +13,17 @@
 #endif
 
 /* Struct definitions */
+typedef struct _file_transfer_batch {
+    char dummy_field;
+} file_transfer_batch;
+
 typedef struct _radsat_message {
     pb_size_t which_service;
     union {
         protocol_message ProtocolMessage;
         file_transfer_message FileTransferMessage;
         telecommand_message TelecommandMessage;
+        telecommand_batch TelecommandBatch;
     };
 } radsat_message;
 
@@ -29,31 +34,47 @@ extern "C" {
 
 /* Initializer values for message structs */
 #define radsat_message_init_default              {0, {protocol_message_init_default}}
+#define file_transfer_batch_init_default         {0}
 #define radsat_message_init_zero                 {0, {protocol_message_init_zero}}
+#define file_transfer_batch_init_zero            {0}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define radsat_message_ProtocolMessage_tag       1
 #define radsat_message_FileTransferMessage_tag   2
 #define radsat_message_TelecommandMessage_tag    3
+#define radsat_message_TelecommandBatch_tag      4
 
 /* Struct field encoding specification for nanopb */
 #define radsat_message_FIELDLIST(X, a) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (service,ProtocolMessage,ProtocolMessage),   1) \
 X(a, STATIC,   ONEOF,    MESSAGE,  (service,FileTransferMessage,FileTransferMessage),   2) \
-X(a, STATIC,   ONEOF,    MESSAGE,  (service,TelecommandMessage,TelecommandMessage),   3)
+X(a, STATIC,   ONEOF,    MESSAGE,  (service,TelecommandMessage,TelecommandMessage),   3) \
+X(a, STATIC,   ONEOF,    MESSAGE,  (service,TelecommandBatch,TelecommandBatch),   4)
 #define radsat_message_CALLBACK NULL
 #define radsat_message_DEFAULT NULL
 #define radsat_message_service_ProtocolMessage_MSGTYPE protocol_message
 #define radsat_message_service_FileTransferMessage_MSGTYPE file_transfer_message
 #define radsat_message_service_TelecommandMessage_MSGTYPE telecommand_message
+#define radsat_message_service_TelecommandBatch_MSGTYPE telecommand_batch
+
+#define file_transfer_batch_FIELDLIST(X, a) \
+
+#define file_transfer_batch_CALLBACK NULL
+#define file_transfer_batch_DEFAULT NULL
 
 extern const pb_msgdesc_t radsat_message_msg;
+extern const pb_msgdesc_t file_transfer_batch_msg;
 
 /* Defines for backwards compatibility with code written before nanopb-0.4.0 */
 #define radsat_message_fields &radsat_message_msg
+#define file_transfer_batch_fields &file_transfer_batch_msg
 
 /* Maximum encoded size of messages (where known) */
 #define radsat_message_size                      217
+#define file_transfer_batch_size                 0
+
+/* Messages with direct coders, as PB_DIRECT(message) entries */
+#define RRADSAT_DIRECT_MESSAGES
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -9,6 +9,9 @@
 PB_BIND(telecommand_message, telecommand_message, AUTO)
 
 
+PB_BIND(telecommand_batch, telecommand_batch, AUTO)
+
+
 PB_BIND(begin_pass, begin_pass, AUTO)
 
 
@@ -10,6 +10,11 @@
 #endif
 
 /* Enum definitions */
+typedef enum _begin_pass_dosimeter_encoding_t {
+    begin_pass_dosimeter_encoding_t_Counts = 0,
+    begin_pass_dosimeter_encoding_t_Voltage = 1
+} begin_pass_dosimeter_encoding_t;
+
 typedef enum _reset_device_t {
     reset_device_t_Obc = 0,
     reset_device_t_Transmitter = 1,
@@ -25,6 +30,10 @@ typedef struct _begin_file_transfer {
 
 typedef struct _begin_pass {
     uint32_t passLength;
+    bool compactHeaders;
+    uint32_t compactBaseTime;
+    uint32_t fecParity;
+    begin_pass_dosimeter_encoding_t dosimeterEncoding;
 } begin_pass;
 
 typedef struct _cease_transmission {
@@ -56,8 +65,17 @@ typedef struct _telecommand_message {
     };
 } telecommand_message;
 
+typedef struct _telecommand_batch {
+    pb_size_t Telecommands_count;
+    telecommand_message Telecommands[8];
+} telecommand_batch;
+
 
 /* Helper constants for enums */
+#define _begin_pass_dosimeter_encoding_t_MIN begin_pass_dosimeter_encoding_t_Counts
+#define _begin_pass_dosimeter_encoding_t_MAX begin_pass_dosimeter_encoding_t_Voltage
+#define _begin_pass_dosimeter_encoding_t_ARRAYSIZE ((begin_pass_dosimeter_encoding_t)(begin_pass_dosimeter_encoding_t_Voltage+1))
+
 #define _reset_device_t_MIN reset_device_t_Obc
 #define _reset_device_t_MAX reset_device_t_AntennaSideB
 #define _reset_device_t_ARRAYSIZE ((reset_device_t)(reset_device_t_AntennaSideB+1))
@@ -69,14 +87,16 @@ extern "C" {
 
 /* Initializer values for message structs */
 #define telecommand_message_init_default         {0, {begin_pass_init_default}}
-#define begin_pass_init_default                  {0}
+#define telecommand_batch_init_default           {0, {telecommand_message_init_default, telecommand_message_init_default, telecommand_message_init_default, telecommand_message_init_default, telecommand_message_init_default, telecommand_message_init_default, telecommand_message_init_default, telecommand_message_init_default}}
+#define begin_pass_init_default                  {0, 0, 0, 0, _begin_pass_dosimeter_encoding_t_MIN}
 #define begin_file_transfer_init_default         {0}
 #define cease_transmission_init_default          {0}
 #define resume_transmission_init_default         {0}
 #define update_time_init_default                 {0}
 #define reset_init_default                       {_reset_device_t_MIN, 0}
 #define telecommand_message_init_zero            {0, {begin_pass_init_zero}}
-#define begin_pass_init_zero                     {0}
+#define telecommand_batch_init_zero              {0, {telecommand_message_init_zero, telecommand_message_init_zero, telecommand_message_init_zero, telecommand_message_init_zero, telecommand_message_init_zero, telecommand_message_init_zero, telecommand_message_init_zero, telecommand_message_init_zero}}
+#define begin_pass_init_zero                     {0, 0, 0, 0, _begin_pass_dosimeter_encoding_t_MIN}
 #define begin_file_transfer_init_zero            {0}
 #define cease_transmission_init_zero             {0}
 #define resume_transmission_init_zero            {0}
@@ -86,6 +106,10 @@ extern "C" {
 /* Field tags (for use in manual encoding/decoding) */
 #define begin_file_transfer_resp_tag             1
 #define begin_pass_passLength_tag                1
+#define begin_pass_compactHeaders_tag            2
+#define begin_pass_compactBaseTime_tag           3
+#define begin_pass_fecParity_tag                 4
+#define begin_pass_dosimeterEncoding_tag         5
 #define cease_transmission_duration_tag          1
 #define reset_device_tag                         1
 #define reset_hard_tag                           2
@@ -97,6 +121,7 @@ extern "C" {
 #define telecommand_message_ResumeTransmission_tag 4
 #define telecommand_message_UpdateTime_tag       5
 #define telecommand_message_Reset_tag            6
+#define telecommand_batch_Telecommands_tag       1
 
 /* Struct field encoding specification for nanopb */
 #define telecommand_message_FIELDLIST(X, a) \
@@ -115,8 +140,18 @@ X(a, STATIC,   ONEOF,    MESSAGE,  (message,Reset,Reset),   6)
 #define telecommand_message_message_UpdateTime_MSGTYPE update_time
 #define telecommand_message_message_Reset_MSGTYPE reset
 
+#define telecommand_batch_FIELDLIST(X, a) \
+X(a, STATIC,   REPEATED, MESSAGE,  Telecommands,      1)
+#define telecommand_batch_CALLBACK NULL
+#define telecommand_batch_DEFAULT NULL
+#define telecommand_batch_Telecommands_MSGTYPE telecommand_message
+
 #define begin_pass_FIELDLIST(X, a) \
-X(a, STATIC,   SINGULAR, UINT32,   passLength,        1)
+X(a, STATIC,   SINGULAR, UINT32,   passLength,        1) \
+X(a, STATIC,   SINGULAR, BOOL,     compactHeaders,    2) \
+X(a, STATIC,   SINGULAR, UINT32,   compactBaseTime,   3) \
+X(a, STATIC,   SINGULAR, UINT32,   fecParity,         4) \
+X(a, STATIC,   SINGULAR, UENUM,    dosimeterEncoding,   5)
 #define begin_pass_CALLBACK NULL
 #define begin_pass_DEFAULT NULL
 
@@ -147,6 +182,7 @@ X(a, STATIC,   SINGULAR, UINT32,   hard,              2)
 #define reset_DEFAULT NULL
 
 extern const pb_msgdesc_t telecommand_message_msg;
+extern const pb_msgdesc_t telecommand_batch_msg;
 extern const pb_msgdesc_t begin_pass_msg;
 extern const pb_msgdesc_t begin_file_transfer_msg;
 extern const pb_msgdesc_t cease_transmission_msg;
@@ -156,6 +192,7 @@ extern const pb_msgdesc_t reset_msg;
 
 /* Defines for backwards compatibility with code written before nanopb-0.4.0 */
 #define telecommand_message_fields &telecommand_message_msg
+#define telecommand_batch_fields &telecommand_batch_msg
 #define begin_pass_fields &begin_pass_msg
 #define begin_file_transfer_fields &begin_file_transfer_msg
 #define cease_transmission_fields &cease_transmission_msg
@@ -164,14 +201,18 @@ extern const pb_msgdesc_t reset_msg;
 #define reset_fields &reset_msg
 
 /* Maximum encoded size of messages (where known) */
-#define telecommand_message_size                 10
-#define begin_pass_size                          6
+#define telecommand_message_size                 24
+#define telecommand_batch_size                   208
+#define begin_pass_size                          22
 #define begin_file_transfer_size                 6
 #define cease_transmission_size                  6
 #define resume_transmission_size                 6
 #define update_time_size                         6
 #define reset_size                               8
 
+/* Messages with direct coders, as PB_DIRECT(message) entries */
+#define RTELECOMMANDS_DIRECT_MESSAGES
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -8,6 +8,8 @@
 #include <RCameraCommon.h>
 #include <RCamera.h>
 #include <RCommon.h>
+#include <RFileTransferService.h>
+#include <RImageCompression.h>
 #include <stdlib.h>
 #include <string.h>
 #include <freertos/FreeRTOS.h>
@@ -39,15 +41,20 @@ int imageCaptureInterval = 0;
 /** 0 = 1024x1024, 1 = 512x512, 2 = 256x256, 3 = 128x128, 4 = 64x64 **/
 uint8_t imageDownloadSize = 4;
 
-/** Pointer to a local image frames prepared for downlink. */
-static full_image_t *image;
-/** Flag indicating image is ready for downlink. **/
+/* Struct for the compression of images prepared for downlink; lossless by default */
+typedef struct _image_compression_t {
+	uint8_t enabled;		///> Whether frames are compressed (otherwise sent as captured, one per packet)
+	uint8_t maxError;		///> Largest error allowed of any compressed pixel; 0 for lossless compression
+} image_compression_t;
+static image_compression_t imageCompression = { 1, 0 };
+
+/** Flag indicating every frame of the image has been prepared for downlink. **/
 static uint8_t imageReadyForDownlink = 0;
 /** Flag indicating system ready for a new image capture. **/
 static uint8_t imageReadyForNewCapture = 1;
 
-/** Index of the current image frame prepared for downlink. */
-static int currentImageFrameIndex = -1;
+/** ID of the image last captured into the download location (counts the captures since start-up). */
+static uint32_t capturedImageId = 0;
 
 /** Flag indicating that the CubeSense is currently in use. Used to prevent conflicts. **/
 static uint8_t cubeSenseIsInUse = 0;
@@ -65,6 +72,21 @@ typedef struct _image_download_t {
 } image_download_t;
 static image_download_t downloadParameters = {0};
 
+/* Struct for the progress of the image being streamed into the downlink, frame by frame */
+typedef struct _image_stream_t {
+	uint32_t id;			///> ID of the image being streamed
+	uint8_t sram;			///> SRAM the image is downloaded from
+	uint8_t size;			///> CubeSense's size of the image (0 to 4)
+	uint16_t framesCount;	///> Number of frames in the image
+	uint16_t nextFrame;		///> Index of the next frame to prepare for downlink
+	uint8_t compressed;		///> Whether the frames are compressed (see imageCompression)
+	image_encoder_t encoder;	///> Packet of compressed frames being built (from nextFrame onwards)
+} image_stream_t;
+static image_stream_t imageStream = {0};
+
+/** Image packet being prepared for downlink (kept off the Image Download Task's small stack). */
+static image_packet imageStreamPacketBuffer = {0};
+
 /* Struct for ADCS burst measurement parameters and local variable */
 typedef struct _adcs_capture_settings_t {
 	uint8_t nbMeasurements;
@@ -82,6 +104,10 @@ static uint8_t adcsReadyForNewBurst = 1;
 ***************************************************************************************************/
 
 void ImageDownloadTask(void* parameters);
+static int imageStreamFrame(uint16_t frameIndex, const tlm_image_frame_t *frame, void *context);
+static int imageStreamCompressed(image_stream_t *stream);
+static int imageStreamPacket(image_stream_t *stream);
+static image_type_t imageTypeFromSize(uint8_t size);
 
 /***************************************************************************************************
                                              PUBLIC API
@@ -324,6 +350,21 @@ uint8_t getImageDownloadSize(void) {
 }
 
 
+/*
+ * Set the compression of images prepared for downlink. Takes effect from the next image packet.
+ *
+ * @param enabled defines whether frames are compressed; otherwise each is sent as captured, in a packet of its own
+ * @param maxError defines the largest error allowed of any pixel (up to IMAGE_COMPRESSION_MAX_ERROR), 0 for lossless compression
+ */
+void setImageCompression(uint8_t enabled, uint8_t maxError) {
+	if (maxError > IMAGE_COMPRESSION_MAX_ERROR)
+		maxError = IMAGE_COMPRESSION_MAX_ERROR;
+
+	imageCompression.enabled = (enabled != 0);
+	imageCompression.maxError = maxError;
+}
+
+
 /*
  * Trigger a new image capture given the specified parameters.
  *
@@ -339,13 +380,18 @@ int requestImageCapture(uint8_t camera, uint8_t sram, uint8_t location) {
 
 	int error = captureImage(camera, sram, location);
 	cubeSenseIsInUse = 0;
+
+	// A new image is in place; its download (if any) starts over
+	if (error == SUCCESS)
+		capturedImageId++;
+
 	return error;
 }
 
 
 /*
  * Trigger a new image capture given the specified parameters, run
- * the detection algorithm on said image, and download the image into RAM.
+ * the detection algorithm on said image, and download the image into the downlink.
  *
  * @param camera defines which sensor to use to capture an image, 0 = Camera 1, 1 = Camera 2
  * @param sram defines which SRAM to use on CubeSense, 0 = SRAM1, 1 = SRAM2
@@ -434,7 +480,8 @@ int requestImageCaptureAndDetect(uint8_t camera, uint8_t sram) {
 
 
 /*
- * Start the download of the image into RAM.
+ * Start the download of the image into the downlink. An interrupted download of the same image
+ * resumes from the first frame not yet prepared for downlink.
  *
  * @param sram defines which SRAM to use on CubeSense, 0 = SRAM1, 1 = SRAM2
  * @param size defines the image size used to allocate memory, 0 = 1024x1024, 1 = 512x512, 2 = 256x256, 3 = 128x128, 4 = 64x64
@@ -499,7 +546,7 @@ uint16_t getImageFramesCount(void) {
 	if (!imageReadyForDownlink)
 		return 0;
 
-	return image->framesCount;
+	return imageStream.framesCount;
 }
 
 
@@ -515,139 +562,197 @@ uint8_t getCubeSenseUsageState(void) {
 
 
 /*
- * Set the image transfer frame index to the specified value.
+ * Set the index of the next image frame to prepare for downlink (i.e. to resend the image from a
+ * given frame onwards). The frames are downloaded again on the next image download.
  *
  * @param index defines the value to set the image transfer frame index
  */
 void setImageTransferFrameIndex(int index) {
-	currentImageFrameIndex = index;
+	if (index < 0)
+		index = 0;
+
+	if (index > imageStream.framesCount)
+		index = imageStream.framesCount;
+
+	imageStream.nextFrame = (uint16_t)index;
+	imageReadyForDownlink = (imageStream.nextFrame >= imageStream.framesCount && imageStream.framesCount > 0);
 }
 
-/**
- * Provide the next image frame. Calling the function passed the number of image frames
- * will loop back at the first image frame (circular buffer).
+/***************************************************************************************************
+                                           FREERTOS TASKS
+***************************************************************************************************/
+
+/*
+ * Task to download an image from CubeSense into the downlink.
+ *
+ * Frames are prepared for downlink as they are downloaded, rather than held in RAM. The download
+ * stops once the downlink has no more room for them, and resumes from there on the next request.
  *
- * @param frame pointer to a buffer that the frame will be placed into. Set by function.
- * @return The size of the image frame placed into the buffer; 0 on error.
+ * @param parameters defines the task parameters (unused)
  */
-uint8_t imageTransferNextFrame(image_frame_t* frame) {
-	// Check for null pointer
-	if (frame == NULL)
-		return 0;
+void ImageDownloadTask(void* parameters) {
+	// Flag CubeSense as "in use"
+	cubeSenseIsInUse = 1;
 
-	// Check stored image validity
-	if (!imageReadyForDownlink)
-		return 0;
+	// ignore the input parameter
+	(void)parameters;
 
-	// Validate that there is a next frame
-	int nextFrameIndex = currentImageFrameIndex + 1;
-	if (nextFrameIndex < 0)
-		return 0;
+	printf("ImageDownloadTask 1: SRAM = %i | Size = %i\n", downloadParameters.sram, downloadParameters.size);
 
-	// Increment image frame index
-	currentImageFrameIndex++;
+	// Start over for a new image (or another size of it); otherwise resume where the last download stopped
+	if (imageStream.id != capturedImageId || imageStream.sram != downloadParameters.sram ||
+		imageStream.size != downloadParameters.size || imageStream.framesCount == 0) {
+		imageReadyForDownlink = 0;
+		imageStream.id = capturedImageId;
+		imageStream.sram = downloadParameters.sram;
+		imageStream.size = downloadParameters.size;
+		imageStream.framesCount = getNumberOfFramesFromSize(downloadParameters.size);
+		imageStream.nextFrame = 0;
+	}
 
-	// Circular indexing
-	if (currentImageFrameIndex >= image->framesCount)
-		currentImageFrameIndex = 0;
+	// Frames are compressed into packets from where the download starts; a packet left unsent is built again
+	imageStream.compressed = imageCompression.enabled;
+	imageEncoderStart(&imageStream.encoder, imageStream.nextFrame, imageCompression.maxError);
 
-	// Get image frame size
-	uint8_t size = sizeof(image->imageFrames[currentImageFrameIndex].image_bytes);
+	// Download the remaining image frames straight into the downlink
+	int error = SUCCESS;
+	if (imageStream.nextFrame < imageStream.framesCount)
+		error = downloadImage(imageStream.sram, BOTTOM_HALVE, imageStream.size, imageStream.nextFrame, imageStreamFrame, &imageStream);
 
-	// Copy the image frame to the argument pointer
-	//printf("Copying image frame index %d containing %i bytes.\n", currentImageFrameIndex, size);
-	memcpy(frame->image_bytes, image->imageFrames[currentImageFrameIndex].image_bytes, size);
-	frame->frameIndex = currentImageFrameIndex;
+	if (error != SUCCESS) {
+		printf("\nImageDownloadTask(): Failed to download all image frames...\n");
+	} else if (imageStream.nextFrame < imageStream.framesCount) {
+		printf("\nImageDownloadTask(): Downlink full, stopped before frame %i\n", imageStream.nextFrame);
+	} else {
+		printf("\nImageDownloadTask(): Successfully downloaded image!\n");
 
-	// Return size of the frame
-	return size;
-}
+		// Flag the image as fully prepared for downlink
+		imageReadyForDownlink = 1;
+	}
 
+	// Flag CubeSense as "not used"
+	cubeSenseIsInUse = 0;
 
-/**
- * Provide the current image frame.
- *
- * @param frame pointer to a buffer that the frame will be placed into. Set by function.
- * @return The size of the image frame placed into the buffer; 0 on error.
- */
-uint8_t imageTransferCurrentFrame(image_frame_t* frame) {
-	return imageTransferSpecificFrame(frame, currentImageFrameIndex);
+	// Let this task delete itself
+	vTaskDelete(imageDownloadTaskHandle);
 }
 
 
-/**
- * Provide the image frame at the specified index.
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/*
+ * Prepare a downloaded image frame for downlink (see downloadImage).
+ *
+ * Compressed frames are gathered into a packet until it has no room for the next one, or the
+ * image is complete; only then is the packet stored for downlink.
  *
- * @param frame pointer to a buffer that the frame will be placed into. Set by function.
- * @param index defines which image frame to copy in the buffer
- * @return The size of the image frame placed into the buffer; 0 on error.
+ * @param frameIndex defines the index of the frame within the image
+ * @param frame defines the downloaded frame
+ * @param context defines the progress of the image being streamed
+ * @return 0 on success; non-zero if the downlink has no room for the frame (the download stops there)
  */
-uint8_t imageTransferSpecificFrame(image_frame_t* frame, int index) {
-	// Check for null pointer
-	if (frame == NULL)
-		return 0;
+static int imageStreamFrame(uint16_t frameIndex, const tlm_image_frame_t *frame, void *context) {
+	image_stream_t *stream = (image_stream_t*)context;
+	int error = SUCCESS;
+
+	// Frames sent as captured are each a packet of their own
+	if (!stream->compressed) {
+		image_packet *packet = &imageStreamPacketBuffer;
+		memset(packet, 0, sizeof(*packet));
+		packet->frame = frameIndex;
+		packet->encoding = image_encoding_t_Raw;
+		packet->frames = 1;
+		packet->data.size = sizeof(frame->image_bytes);
+		memcpy(packet->data.bytes, frame->image_bytes, sizeof(frame->image_bytes));
+		return imageStreamPacket(stream);
+	}
 
-	// Check stored image validity
-	if (!imageReadyForDownlink)
-		return 0;
+	// Once the packet is full, store it and begin the next one with this frame
+	if (imageEncoderAddFrame(&stream->encoder, frame->image_bytes) != SUCCESS) {
+		error = imageStreamCompressed(stream);
+		if (error != SUCCESS)
+			return error;
 
-	// Validate image frame index
-	if (index < 0 || index >= image->framesCount)
-		return 0;
+		imageEncoderStart(&stream->encoder, frameIndex, imageCompression.maxError);
+		error = imageEncoderAddFrame(&stream->encoder, frame->image_bytes);
+		if (error != SUCCESS)
+			return error;
+	}
 
-	// Get image frame size
-	uint8_t size = sizeof(image->imageFrames[index].image_bytes);
+	// The last frame of the image completes its last packet
+	if (frameIndex + 1 >= stream->framesCount)
+		error = imageStreamCompressed(stream);
+
+	return error;
+}
 
-	// Copy the image frame to the argument pointer
-	printf("\nCopying image frame index %i containing %i bytes.\n", index, size);
-	memcpy(frame->image_bytes, image->imageFrames[index].image_bytes, size);
-	frame->frameIndex = index;
 
-	// Return size of the frame
-	return size;
+/*
+ * Store the packet of compressed frames being built for downlink.
+ *
+ * @param stream defines the progress of the image being streamed
+ * @return 0 on success; non-zero if the downlink has no room for the packet (its frames are downloaded again later)
+ */
+static int imageStreamCompressed(image_stream_t *stream) {
+	image_packet *packet = &imageStreamPacketBuffer;
+	memset(packet, 0, sizeof(*packet));
+	packet->frame = stream->encoder.firstFrame;
+	packet->encoding = image_encoding_t_Compressed;
+	packet->frames = stream->encoder.frames;
+	packet->maxError = stream->encoder.maxError;
+	packet->data.size = imageEncoderFinish(&stream->encoder);
+	memcpy(packet->data.bytes, stream->encoder.data, packet->data.size);
+
+	return imageStreamPacket(stream);
 }
 
-/***************************************************************************************************
-                                           FREERTOS TASKS
-***************************************************************************************************/
 
 /*
- * Task to download an image from CubeSense into RAM.
+ * Store the prepared image packet (holding its frames and their encoding) for downlink, moving the
+ * stream on past its frames.
  *
- * @param parameters defines the task parameters (unused)
+ * @param stream defines the progress of the image being streamed
+ * @return 0 on success; non-zero if the downlink has no room for the packet
  */
-void ImageDownloadTask(void* parameters) {
-	// Flag CubeSense as "in use"
-	cubeSenseIsInUse = 1;
+static int imageStreamPacket(image_stream_t *stream) {
+	image_packet *packet = &imageStreamPacketBuffer;
 
-	// ignore the input parameter
-	(void)parameters;
+	// store the packet only while the bulk queue still has room for it; a full queue would drop it
+	file_transfer_queue_status_t bulk = { 0 };
+	int error = fileTransferQueueStatus(fileTransferQueueBulk, &bulk);
+	if (error != SUCCESS)
+		return error;
 
-	printf("ImageDownloadTask 1: SRAM = %i | Size = %i\n", downloadParameters.sram, downloadParameters.size);
+	if (bulk.frames + 1 >= bulk.capacity)
+		return E_GENERIC;
 
-	// Reset the image downlink ready flag since allocated memory is freed
-	imageReadyForDownlink = 0;
-	// Free the previous image allocated memory
-	free(image);
-	// Reset the image frame index
-	currentImageFrameIndex = -1;
-
-	// Initialize a new block of memory for the new image
-	image = initializeNewImage(downloadParameters.size);
-	// Download all image frames and store them in RAM
-	int error = downloadImage(downloadParameters.sram, BOTTOM_HALVE, image);
-	if (error != SUCCESS) {
-		printf("\nImageDownloadTask(): Failed to download all image frames...\n");
-	} else {
-		printf("\nImageDownloadTask(): Successfully downloaded image!\n");
+	packet->id = stream->id;
+	packet->type = imageTypeFromSize(stream->size);
 
-		// Flag the stored image as valid
-		imageReadyForDownlink = 1;
-	}
+	// frames that were not stored are downloaded again when the download resumes
+	error = fileTransferAddMessage(packet, sizeof(*packet), file_transfer_message_ImagePacket_tag);
+	if (error != SUCCESS)
+		return error;
 
-	// Flag CubeSense as "not used"
-	cubeSenseIsInUse = 0;
+	stream->nextFrame = packet->frame + packet->frames;
+	return SUCCESS;
+}
 
-	// Let this task delete itself
-	vTaskDelete(imageDownloadTaskHandle);
+
+/*
+ * Get the downlinked image type for a given CubeSense image size.
+ *
+ * @param size defines the CubeSense image size, 0 = 1024x1024, 1 = 512x512, 2 = 256x256, 3 = 128x128, 4 = 64x64
+ * @return the corresponding image type
+ */
+static image_type_t imageTypeFromSize(uint8_t size) {
+	switch(size) {
+		case 0: return image_type_t_FullResolution;
+		case 1: return image_type_t_HalfResolution;
+		case 2: return image_type_t_QuarterResolution;
+		case 3: return image_type_t_EighthResolution;
+		default: return image_type_t_Thumbnail;
+	}
 }
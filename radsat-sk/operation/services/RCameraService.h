@@ -20,12 +20,6 @@ typedef struct _adcs_detection_results_t {
 	detection_results_t results[];  // Variable size, corresponding to the number of measurements in a burst
 } adcs_detection_results_t;
 
-/* Struct prepared for downlink that holds an image frame */
-typedef struct _image_frame_t {
-	uint16_t frameIndex;
-	uint8_t image_bytes[FRAME_BYTES];
-} image_frame_t;
-
 /***************************************************************************************************
                                              PUBLIC API
 ***************************************************************************************************/
@@ -55,6 +49,8 @@ int getImageCaptureInterval(void);
 void setImageDownloadSize(uint8_t size);
 uint8_t getImageDownloadSize(void);
 
+void setImageCompression(uint8_t enabled, uint8_t maxError);
+
 int requestImageCapture(uint8_t camera, uint8_t sram, uint8_t location);
 int requestImageCaptureDetectAndDownload(uint8_t camera, uint8_t sram, uint8_t size);
 int requestImageCaptureAndDetect(uint8_t camera, uint8_t sram);
@@ -67,9 +63,6 @@ uint16_t getImageFramesCount(void);
 uint8_t getCubeSenseUsageState(void);
 
 void setImageTransferFrameIndex(int index);
-uint8_t imageTransferNextFrame(image_frame_t* frame);
-uint8_t imageTransferCurrentFrame(image_frame_t* frame);
-uint8_t imageTransferSpecificFrame(image_frame_t* frame, int index);
 /*****************************/
 
 #endif /* RCAMERASERVICE_H_ */
@@ -0,0 +1,230 @@
+/**
+ * @file RFileTransferSeries.c
+ * @date October 16, 2026
+ * @author
+ *
+ * Groups consecutive periodic records (i.e. dosimeter counts) into series before they are downlinked.
+ * Consecutive readings differ only slightly, so each record after the first of a series (its keyframe)
+ * is kept only as its differences from the previous record, as zig-zag varints (see RFileTransfer.proto).
+ */
+
+#include <RFileTransferSeries.h>
+#include <RCommon.h>
+#include <pb_encode.h>
+#include <pb_direct.h>
+#include <string.h>
+
+#include <hal/Timing/Time.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** The max number of records grouped into a single series (bounds how long a record waits in RAM). */
+#define SERIES_MAX_RECORDS		(16)
+
+/** The number of counts in each record (both boards). */
+#define SERIES_RECORD_COUNTS	(2 * (sizeof(((dosimeter_counts*)0)->boardOne) / sizeof(((dosimeter_counts*)0)->boardOne[0])))
+
+/** The max size of a record after the keyframe: its time and its differences, as varints of up to 5 bytes. */
+#define SERIES_MAX_RECORD_SIZE	(5 + (SERIES_RECORD_COUNTS * 5))
+
+/** The series being built. */
+typedef struct _series_state_t {
+	uint8_t count;				///> The number of records in the series
+	uint32_t recordBytes;		///> The encoded size of the records in the series, had they been sent on their own
+	dosimeter_counts previous;	///> The last record added to the series
+	dosimeter_series series;	///> The series, as it will be downlinked
+} series_state_t;
+
+/** The series being built. */
+static series_state_t state = { 0 };
+
+/** The last completed series; provided to the caller, and kept until the next one is completed. */
+static dosimeter_series completed = { 0 };
+
+/** The compression achieved so far. */
+static file_transfer_series_status_t statistics = { 0 };
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static uint8_t seriesEncodeRecord(const dosimeter_counts* counts, uint32_t time, uint8_t* record);
+static const dosimeter_series* seriesComplete(void);
+static uint32_t seriesEncodedSize(const pb_msgdesc_t* fields, const void* message);
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+/**
+ * Add a record to the series being built, completing the series if needed.
+ *
+ * A series is completed once it holds the max number of records, or once the next record no longer
+ * fits into it (or was recorded before its keyframe, i.e. after the time was updated); that record then
+ * starts the next series.
+ *
+ * @note Not thread-safe; the File Transfer Service calls it with its own lock held.
+ * @param counts The record to add.
+ * @return The completed series (valid until the next series is completed), or NULL if there is none yet.
+ */
+const dosimeter_series* seriesAdd(const dosimeter_counts* counts) {
+
+	uint32_t time = 0;
+	Time_getUnixEpoch((unsigned int*)&time);
+
+	// the record is only accounted for once its series is completed (see seriesComplete)
+	uint32_t recordBytes = seriesEncodedSize(dosimeter_counts_fields, counts);
+
+	const dosimeter_series* series = NULL;
+
+	// append the record's differences to the series being built, if they fit
+	if (state.count > 0) {
+		uint8_t record[SERIES_MAX_RECORD_SIZE];
+		uint8_t size = seriesEncodeRecord(counts, time, record);
+		uint16_t room = (uint16_t)(sizeof(state.series.records.bytes) - state.series.records.size);
+
+		if (size > 0 && size <= room) {
+			memcpy(&state.series.records.bytes[state.series.records.size], record, size);
+			state.series.records.size += size;
+			state.previous = *counts;
+			state.count++;
+			state.recordBytes += recordBytes;
+
+			if (state.count >= SERIES_MAX_RECORDS)
+				series = seriesComplete();
+
+			return series;
+		}
+
+		series = seriesComplete();
+	}
+
+	// start the next series with the record as its keyframe
+	state.series.keyframe = *counts;
+	state.series.time = time;
+	state.series.records.size = 0;
+	state.previous = *counts;
+	state.count = 1;
+	state.recordBytes = recordBytes;
+
+	return series;
+}
+
+
+/**
+ * Complete the series being built, without waiting for more records.
+ *
+ * @note Not thread-safe; the File Transfer Service calls it with its own lock held.
+ * @return The completed series (valid until the next series is completed), or NULL if there was none.
+ */
+const dosimeter_series* seriesFlush(void) {
+
+	if (state.count == 0)
+		return NULL;
+
+	return seriesComplete();
+}
+
+
+/**
+ * Drop the series being built; its records are not accounted for.
+ */
+void seriesReset(void) {
+	state.count = 0;
+	state.recordBytes = 0;
+}
+
+
+/**
+ * Provide the compression achieved by grouping records into series (since start-up).
+ *
+ * The compression ratio is recordBytes / seriesBytes; records of a series being built are not counted
+ * in either until it is completed.
+ *
+ * @param status Pointer to the status to fill in. Set by function.
+ */
+void seriesStatus(file_transfer_series_status_t* status) {
+	if (status != NULL)
+		*status = statistics;
+}
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Encode a record as its time (after the keyframe's) and the differences of its counts from the previous record's.
+ *
+ * @param counts The record to encode.
+ * @param time The time of the record (seconds since Unix Epoch).
+ * @param record The buffer to encode into; at least SERIES_MAX_RECORD_SIZE bytes.
+ * @return The size of the encoded record; 0 if it was recorded before the keyframe.
+ */
+static uint8_t seriesEncodeRecord(const dosimeter_counts* counts, uint32_t time, uint8_t* record) {
+
+	if (time < state.series.time)
+		return 0;
+
+	uint8_t* position = pb_direct_put_varint(record, time - state.series.time);
+
+	const uint16_t* current[] = { counts->boardOne, counts->boardTwo };
+	const uint16_t* previous[] = { state.previous.boardOne, state.previous.boardTwo };
+
+	for (uint8_t i = 0; i < SERIES_RECORD_COUNTS; i++) {
+		uint8_t board = i / (SERIES_RECORD_COUNTS / 2);
+		uint8_t channel = i % (SERIES_RECORD_COUNTS / 2);
+
+		// zig-zag encoding keeps small negative differences small (as with sint32)
+		int32_t difference = (int32_t)current[board][channel] - (int32_t)previous[board][channel];
+		uint32_t zigzag = ((uint32_t)difference << 1) ^ (uint32_t)(difference >> 31);
+
+		position = pb_direct_put_varint(position, zigzag);
+	}
+
+	return (uint8_t)(position - record);
+}
+
+
+/**
+ * Move the series being built into the completed series, and account for it (and its records).
+ *
+ * @return The completed series.
+ */
+static const dosimeter_series* seriesComplete(void) {
+
+	completed = state.series;
+
+	statistics.records += state.count;
+	statistics.recordBytes += state.recordBytes;
+	statistics.series++;
+	statistics.seriesBytes += seriesEncodedSize(dosimeter_series_fields, &completed);
+
+	state.count = 0;
+	state.recordBytes = 0;
+
+	return &completed;
+}
+
+
+/**
+ * Provide the size of an encoded message.
+ *
+ * @param fields The NanoPB layout of the message.
+ * @param message The message.
+ * @return The size of the encoded message; 0 if it could not be encoded.
+ */
+static uint32_t seriesEncodedSize(const pb_msgdesc_t* fields, const void* message) {
+
+	size_t size = 0;
+
+	if (!pb_get_encoded_size(&size, fields, message))
+		return 0;
+
+	return (uint32_t)size;
+}
@@ -0,0 +1,38 @@
+/**
+ * @file RFileTransferSeries.h
+ * @date October 16, 2026
+ * @author
+ */
+
+#ifndef RFILETRANSFERSERIES_H_
+#define RFILETRANSFERSERIES_H_
+
+#include <stdint.h>
+#include <RFileTransfer.pb.h>
+
+
+/***************************************************************************************************
+                                            DEFINITIONS
+***************************************************************************************************/
+
+/** The compression achieved by grouping records into series (since start-up). */
+typedef struct _file_transfer_series_status_t {
+	uint32_t records;			///< The number of records in the completed series
+	uint32_t series;			///< The number of series completed
+	uint32_t recordBytes;		///< The encoded size of the completed records, had they been sent on their own
+	uint32_t seriesBytes;		///< The encoded size of the completed series
+} file_transfer_series_status_t;
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+const dosimeter_series* seriesAdd(const dosimeter_counts* counts);
+const dosimeter_series* seriesFlush(void);
+void seriesReset(void);
+
+void seriesStatus(file_transfer_series_status_t* status);
+
+
+#endif /* RFILETRANSFERSERIES_H_ */
@@ -1,201 +1,1194 @@
-/**
- * @file RFileTransferService.c
- * @date February 25, 2022
- * @author Tyrel Kostyk (tck290)
- */
-
-#include <RFileTransferService.h>
-#include <RCommon.h>
-#include <RTransceiver.h>
-#include <RMessage.h>
-#include <string.h>
-#include <RCommon.h>
-#include <math.h>
-#include <RFram.h>
-
-
-/**
- * Ensure that our message sizes never exceed the transceiver's max frame size.
- * NOTE: This check allows for 15 bytes of overhead (i.e. from the header) which is more than we currently need. */
-#if ((PROTO_MAX_ENCODED_SIZE + 15) > (TRANCEIVER_TX_MAX_FRAME_SIZE))
-#error "Encoded protobuf message size (plus header) exceeds maximum transceiver frame size!! Reduce size of header or max protobuf messages"
-#endif
-
-
-/***************************************************************************************************
-                                   DEFINITIONS & PRIVATE GLOBALS
-***************************************************************************************************/
-
-/** The max number of frames locally stored at one time. */
-#define MAX_FRAME_COUNT 		(200)
-
-/** Error code for internal issues regarding frame cursors (wrap-around, etc.). */
-#define ERROR_CURSOR			(-1)
-
-/** Error code for failed message wrapping. */
-#define ERROR_MESSAGE_WRAPPING	(-2)
-
-/** Struct that defines a prepared FRAM frame and its total size. */
-typedef struct _fram_frame_t {
-	uint8_t size;								///> The size (in bytes) of the entire frame
-	uint8_t data[TRANCEIVER_TX_MAX_FRAME_SIZE];	///> The buffer holding the prepared frame
-} fram_frame_t;
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-/**
- * Increment the internal FIFO and provide the frame at that location.
- *
- * Invalidates (deletes) the previous frame before moving on.
- *
- * @param frame Pointer to a buffer that the frame will be placed into. Set by function.
- * @return The size of the frame placed into the buffer; 0 on error.
- */
-uint8_t fileTransferNextFrame(uint8_t* frame) {
-	// get the read cursor from FRAM
-	uint16_t frameReadCursor = 0;
-	framRead((uint8_t*)&frameReadCursor, FRAM_READ_CURSOR_ADDR, 2);
-
-	// ensure that there is a valid frame ahead
-	uint16_t nextFrameReadCursor = frameReadCursor + 1;
-	if (nextFrameReadCursor == MAX_FRAME_COUNT)
-		nextFrameReadCursor = 0;
-
-	fram_frame_t fram_frame = {0};
-	uint32_t framDataAddr = FRAM_DATA_START_ADDR + (nextFrameReadCursor * FRAM_DATA_FRAME_SIZE);
-	framRead((uint8_t*)&fram_frame, framDataAddr, FRAM_DATA_FRAME_SIZE);
-
-	if (fram_frame.size == 0)
-		return SUCCESS;
-
-	// invalidate the current (now previous frame)
-	fram_frame_t emptyFrame = {0};
-	framDataAddr = FRAM_DATA_START_ADDR + (frameReadCursor * FRAM_DATA_FRAME_SIZE);
-	framWrite((uint8_t*)&emptyFrame, framDataAddr, FRAM_DATA_FRAME_SIZE);
-
-	// increment the read cursor
-	frameReadCursor++;
-	if (frameReadCursor == MAX_FRAME_COUNT)
-		frameReadCursor = 0;
-	// save read cursor value in FRAM
-	framWrite((uint8_t*)&frameReadCursor, FRAM_READ_CURSOR_ADDR, 2);
-
-	// transfer the new (now current) frame into the provided buffer
-	memcpy(frame, fram_frame.data, fram_frame.size);
-
-	return fram_frame.size;
-}
-
-
-/**
- * Provide the current frame.
- *
- * @param frame Pointer to a buffer that the frame will be placed into. Set by function.
- * @return The size of the frame placed into the buffer; 0 on error.
- */
-uint8_t fileTransferCurrentFrame(uint8_t* frame) {
-	// get the read cursor from FRAM
-	uint16_t frameReadCursor = 0;
-	framRead((uint8_t*)&frameReadCursor, FRAM_READ_CURSOR_ADDR, 2);
-
-	// read current frame from FRAM
-	fram_frame_t fram_frame = {0};
-	uint32_t framDataAddr = FRAM_DATA_START_ADDR + (frameReadCursor * FRAM_DATA_FRAME_SIZE);
-	framRead((uint8_t*)&fram_frame, framDataAddr, FRAM_DATA_FRAME_SIZE);
-
-	sqrt(1);
-	// only provide a frame if the cursor is pointing at a valid frame
-	if (fram_frame.size > 0)
-		memcpy(frame, fram_frame.data, fram_frame.size);
-
-	// return the size of the frame
-	return fram_frame.size;
-}
-
-
-/**
- * Prepare a message for downlink and add it to the internal FIFO.
- *
- * @param message Pointer to the raw Protobuf message to be prepared.
- * @param size The size (in bytes) of the message.
- * @param messageTag The Protobuf tag of the message.
- * @return 0 on success, -1 on internal cursor error, -2 on message wrapping error, otherwise see hal/errors.h.
- */
-int fileTransferAddMessage(const void* message, uint8_t size, uint16_t messageTag) {
-
-	// ensure input pointer is valid
-	if (message == 0) {
-		return E_INPUT_POINTER_NULL;
-	}
-
-	// ensure size parameter is valid
-	if (size == 0 || size > (uint8_t)PROTO_MAX_ENCODED_SIZE)
-		return E_PARAM_OUTOFBOUNDS;
-
-	// get the write & read cursors from FRAM
-	uint16_t frameWriteCursor = 0;
-	uint16_t frameReadCursor = 0;
-	framRead((uint8_t*)&frameWriteCursor, FRAM_WRITE_CURSOR_ADDR, 2);
-	framRead((uint8_t*)&frameReadCursor, FRAM_READ_CURSOR_ADDR, 2);
-
-	// ensure we are not about to overwrite frames that have not been read
-	if (frameWriteCursor == frameReadCursor)
-		return ERROR_CURSOR;
-
-	// create new RADSAT-SK message to populate
-	radsat_message newMessage = { 0 };
-	newMessage.which_service = radsat_message_FileTransferMessage_tag;
-	newMessage.FileTransferMessage.which_message = messageTag;
-
-	// internal message data will go immediately after the "which message" property of the struct
-	// TODO: confirm that this works
-	void* newMessageAddr = &(newMessage.FileTransferMessage.which_message) + sizeof(newMessage.FileTransferMessage.which_message);
-	memcpy(newMessageAddr, message, size);
-
-	uint8_t data[TRANCEIVER_TX_MAX_FRAME_SIZE] = { 0 };
-	// wrap new message
-
-	fram_frame_t fram_frame = {0};
-	fram_frame.size = messageWrap(&newMessage, fram_frame.data);
-
-	// write data in FRAM
-	uint32_t framDataAddr = FRAM_DATA_START_ADDR + (frameWriteCursor * FRAM_DATA_FRAME_SIZE);
-	framWrite((uint8_t*)&fram_frame, framDataAddr, FRAM_DATA_FRAME_SIZE);
-
-	// return error if message wrapping failed
-	if (fram_frame.size == 0)
-		return ERROR_MESSAGE_WRAPPING;
-
-	// upon success, increment cursor
-	frameWriteCursor++;
-	if (frameWriteCursor == MAX_FRAME_COUNT)
-		frameWriteCursor = 0;
-	// save write cursor value in FRAM
-	framWrite((uint8_t*)&frameWriteCursor, FRAM_WRITE_CURSOR_ADDR, 2);
-
-	// return success
-	return SUCCESS;
-}
-
-
-/**
- * Resets the file transfer content in FRAM to the following initial values:
- *  - Write Cursor = 1
- *  - Read Cursor  = 0
- *  - All data frames are filled with 0.
- */
-void fileTransferReset(void) {
-	// reset the cursors to their default values
-	uint16_t defaultCursors[2] = {1,0};
-	framWrite((uint8_t*)&defaultCursors, FRAM_WRITE_CURSOR_ADDR, 4);
-
-	// reset all data frames to zero
-	fram_frame_t emptyFrame = {0};
-	for(int i=0; i<MAX_FRAME_COUNT; i++) {
-		uint32_t framDataAddr = FRAM_DATA_START_ADDR + (i * FRAM_DATA_FRAME_SIZE);
-		framWrite((uint8_t*)&emptyFrame, framDataAddr, FRAM_DATA_FRAME_SIZE);
-	}
-}
+/**
+ * @file RFileTransferService.c
+ * @date February 25, 2022
+ * @author Tyrel Kostyk (tck290)
+ */
+
+#include <RFileTransferService.h>
+#include <RFileTransferSeries.h>
+#include <RCommon.h>
+#include <RTransceiver.h>
+#include <RMessage.h>
+#include <string.h>
+#include <stddef.h>
+#include <RCommon.h>
+#include <RFram.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+
+/**
+ * Ensure that our message sizes never exceed the transceiver's max frame size.
+ * NOTE: This check allows for 9 bytes of header (RADSAT_SK_HEADER_SIZE; the preprocessor cannot use sizeof),
+ * plus the bytes reserved for downlink framing. */
+#if ((PROTO_MAX_ENCODED_SIZE + 9 + FILE_TRANSFER_FRAME_RESERVED_SIZE) > (TRANCEIVER_TX_MAX_FRAME_SIZE))
+#error "Encoded protobuf message size (plus header) exceeds maximum transceiver frame size!! Reduce size of header or max protobuf messages"
+#endif
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** The max number of frames locally stored at one time by each queue. */
+#define HEALTH_FRAME_COUNT		(40)
+#define SCIENCE_FRAME_COUNT		(60)
+#define BULK_FRAME_COUNT		(100)
+
+/** The number of FRAM slots of a queue; one more than its frames, to keep the current frame (for retransmission). */
+#define QUEUE_SLOT_COUNT(frames)	((frames) + 1)
+
+/** The number of FRAM slots of all queues. */
+#define MAX_SLOT_COUNT			(QUEUE_SLOT_COUNT(HEALTH_FRAME_COUNT) + QUEUE_SLOT_COUNT(SCIENCE_FRAME_COUNT) + QUEUE_SLOT_COUNT(BULK_FRAME_COUNT))
+
+/** Error code for internal issues regarding frame cursors (wrap-around, etc.). */
+#define ERROR_CURSOR			(-1)
+
+/** Error code for failed message wrapping. */
+#define ERROR_MESSAGE_WRAPPING	(-2)
+
+/** The max size (in bytes) of a packed frame, including its header. */
+#define PACK_MAX_FRAME_SIZE		(TRANCEIVER_TX_MAX_FRAME_SIZE - FILE_TRANSFER_FRAME_RESERVED_SIZE)
+
+/** The max time (in ms) a message waits in RAM for other messages to be packed alongside it. */
+#define PACK_MAX_AGE_MS			((portTickType)(10*60*1000))
+
+/** Max time (in ms) to wait for another task to finish using the FIFO. */
+#define FIFO_LOCK_TIMEOUT_MS	((portTickType)1000)
+
+/** Number of journal records; written in turn, so that a record is only ever overwritten by a newer one. */
+#define JOURNAL_RECORD_COUNT	(2)
+
+/** The max number of frames ordered for downlink ahead of the current frame (covers a full window, and then some). */
+#define ORDER_MAX_FRAME_COUNT	(64)
+
+/** Struct that defines a prepared FRAM frame and its total size. */
+typedef struct _fram_frame_t {
+	uint8_t size;								///> The size (in bytes) of the entire frame
+	uint8_t data[TRANCEIVER_TX_MAX_FRAME_SIZE];	///> The buffer holding the prepared frame
+} fram_frame_t;
+
+/** Identifies the frame held by a FIFO slot. */
+typedef struct __attribute__((packed)) _fram_slot_marker_t {
+	uint32_t epoch;			///> The epoch the frame was stored in
+	uint32_t sequence;		///> The sequence number of the stored frame
+} fram_slot_marker_t;
+
+/**
+ * A FIFO slot, as stored in FRAM.
+ *
+ * A slot only holds a valid frame if its epoch and sequence number are the ones expected at that
+ * position, so delivered (or reset) frames never need to be erased. The marker is stored last, so
+ * that a write interrupted by a loss of power leaves the slot invalid.
+ */
+typedef struct __attribute__((packed)) _fram_slot_t {
+	fram_frame_t frame;				///> The stored frame
+	fram_slot_marker_t marker;		///> Identifies the stored frame
+} fram_slot_t;
+
+/**
+ * A record of the FIFO cursors, as stored in FRAM.
+ * NOTE: All records must fit within the space allocated to the journal (see RFram.h).
+ */
+typedef struct __attribute__((packed)) _fifo_journal_t {
+	uint32_t commit;									///> Incremented with every record written; the latest valid record is used
+	uint32_t epoch;										///> Incremented with every reset; frames of other epochs are invalid
+	uint32_t writeSequence[fileTransferQueueCount];		///> Sequence number of the next frame to be written, per queue
+	uint32_t readSequence[fileTransferQueueCount];		///> Sequence number of the last frame moved past, per queue
+	uint8_t currentQueue;								///> The queue holding the current frame
+	crc_t crc;											///> Cyclical Redundancy Check of all of the above
+} fifo_journal_t;
+
+/** Refers to a single frame of the FIFO. */
+typedef struct _fifo_entry_t {
+	uint8_t queue;			///> The queue holding the frame
+	uint32_t sequence;		///> The sequence number of the frame within its queue
+} fifo_entry_t;
+
+/** The layout and settings of a single queue. */
+typedef struct _fifo_queue_config_t {
+	uint16_t firstSlot;						///> The first FRAM slot of the queue
+	uint16_t capacity;						///> The max number of frames stored at one time
+	uint8_t weight;							///> The share of the downlink given to the queue; 0 only uses idle time
+	file_transfer_overflow_t overflow;		///> What happens to a new frame when the queue is full
+} fifo_queue_config_t;
+
+/** The layout and settings of each queue (see @sa fileTransferConfigureQueue). */
+static fifo_queue_config_t queueConfig[fileTransferQueueCount] = {
+	{ .firstSlot = 0,											.capacity = HEALTH_FRAME_COUNT,		.weight = 3,	.overflow = fileTransferOverflowDropOldest },
+	{ .firstSlot = QUEUE_SLOT_COUNT(HEALTH_FRAME_COUNT),		.capacity = SCIENCE_FRAME_COUNT,	.weight = 2,	.overflow = fileTransferOverflowDropOldest },
+	{ .firstSlot = QUEUE_SLOT_COUNT(HEALTH_FRAME_COUNT) + QUEUE_SLOT_COUNT(SCIENCE_FRAME_COUNT),	.capacity = BULK_FRAME_COUNT,		.weight = 1,	.overflow = fileTransferOverflowReject },
+};
+
+/**
+ * The cursors of a single queue.
+ *
+ * Frames are numbered with ever-increasing sequence numbers; frame N is stored in slot N % (capacity + 1).
+ */
+typedef struct _fifo_queue_t {
+	uint32_t writeSequence;		///> Sequence number of the next frame to be written
+	uint32_t readSequence;		///> Sequence number of the last frame moved past
+	uint16_t ordered;			///> Number of frames ordered for downlink (but not yet moved past)
+	int16_t credit;				///> Downlink share owed to the queue (see @sa fifoOrderNext)
+	uint32_t dropped;			///> Frames dropped to make room for newer ones
+	uint32_t rejected;			///> Frames rejected due to a full queue
+} fifo_queue_t;
+
+/**
+ * The FIFO cursors, held in RAM as the authoritative copy.
+ *
+ * The queues are merged into a single downlink order as frames are requested; once ordered, a frame
+ * keeps its position until it is moved past, so that frames in flight are never reshuffled.
+ * Frames written since the last journal record are found again when loading (by their sequence
+ * numbers), so the journal is only written when frames are moved past (see @sa fifoCommit).
+ */
+typedef struct _fifo_state_t {
+	uint8_t loaded;									///> Whether the cursors have been loaded from FRAM
+	uint32_t epoch;									///> The epoch of all stored frames
+	fifo_queue_t queues[fileTransferQueueCount];	///> The cursors of each queue
+	fifo_entry_t current;							///> The current frame (the last one moved past)
+	fifo_entry_t order[ORDER_MAX_FRAME_COUNT];		///> Frames ahead of the current frame, in downlink order
+	uint8_t orderCount;								///> Number of frames in the downlink order
+	fifo_journal_t journal;							///> The latest journal record written to FRAM
+} fifo_state_t;
+
+/** The FIFO cursors */
+static fifo_state_t fifo = { 0 };
+
+/** Guards the FIFO cursors, the staged frames and the frames being packed; the FIFO is used by several tasks */
+static xSemaphoreHandle fifoLock = NULL;
+
+
+/** The number of upcoming frames kept staged in RAM, ready for downlink. */
+#define PREFETCH_FRAME_COUNT	(4)
+
+/** A frame staged in RAM, along with its position in the FIFO. */
+typedef struct _prefetch_entry_t {
+	uint8_t valid;			///> Whether this entry holds a staged frame
+	fifo_entry_t entry;		///> The position of the frame
+	fram_frame_t frame;		///> The staged frame
+} prefetch_entry_t;
+
+/**
+ * Keeps upcoming frames staged in RAM, so that they can be provided without accessing FRAM during
+ * the time between receiving an ACK and sending the next frame (see @sa fileTransferPrefetch).
+ */
+static prefetch_entry_t prefetch[PREFETCH_FRAME_COUNT] = { 0 };
+
+
+/**
+ * Collects several (small) messages into a single frame before it is added to the FIFO.
+ *
+ * The frame holds the encoded messages back to back after the room left for its header, which is
+ * only filled in once the frame is flushed (see @sa messageWrapEncoded).
+ */
+typedef struct _pack_state_t {
+	uint8_t count;				///> The number of messages packed into the frame
+	portTickType startTime;		///> The time the first message was packed into the frame
+	fram_frame_t frame;			///> The frame being packed; size includes the header
+} pack_state_t;
+
+/** The frame currently being packed, per queue */
+static pack_state_t pack[fileTransferQueueCount] = { 0 };
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static int fifoLoad(void);
+static void fifoCommit(void);
+static uint8_t fifoOrderNext(void);
+static uint8_t fifoReadFrame(fifo_entry_t entry, uint8_t* frame);
+static int fifoWriteFrame(uint8_t queue, const fram_frame_t* frame);
+static uint32_t fifoSlotAddress(uint8_t queue, uint32_t sequence);
+static void fifoStartOver(void);
+static void fifoErase(void);
+static int fifoLockTake(void);
+static void fifoLockGive(void);
+
+static prefetch_entry_t* prefetchFind(fifo_entry_t entry);
+
+static uint8_t packQueue(uint16_t messageTag);
+static int packAdd(uint8_t queue, const void* message, uint16_t messageTag);
+static uint8_t packEncode(uint8_t queue, const void* message, uint16_t messageTag);
+static int packFlush(uint8_t queue);
+static int packFlushExpired(void);
+static uint8_t packExpired(uint8_t queue);
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+/**
+ * Load the FIFO cursors from FRAM.
+ *
+ * Done automatically on first use otherwise; calling it during start-up keeps the (one-off) search
+ * for frames written since the last journal record out of the first pass.
+ *
+ * @return 0 on success, otherwise an error.
+ */
+int fileTransferInit(void) {
+
+	int error = fifoLockTake();
+	if (error != SUCCESS)
+		return error;
+
+	error = fifoLoad();
+
+	fifoLockGive();
+
+	return error;
+}
+
+
+/**
+ * Increment the internal FIFO and provide the frame at that location.
+ *
+ * @param frame Pointer to a buffer that the frame will be placed into. Set by function.
+ * @return The size of the frame placed into the buffer; 0 on error.
+ */
+uint8_t fileTransferNextFrame(uint8_t* frame) {
+
+	// ensure that there is a valid frame ahead
+	uint8_t frameSize = fileTransferPeekFrame(1, frame);
+	if (frameSize == 0)
+		return 0;
+
+	// the new (now current) frame is in the provided buffer; move on to it
+	if (fileTransferConsumeFrames(1) != SUCCESS)
+		return 0;
+
+	return frameSize;
+}
+
+
+/**
+ * Provide the current frame.
+ *
+ * @param frame Pointer to a buffer that the frame will be placed into. Set by function.
+ * @return The size of the frame placed into the buffer; 0 on error.
+ */
+uint8_t fileTransferCurrentFrame(uint8_t* frame) {
+
+	if (fifoLockTake() != SUCCESS)
+		return 0;
+
+	uint8_t frameSize = 0;
+	if (fifoLoad() == SUCCESS)
+		frameSize = fifoReadFrame(fifo.current, frame);
+
+	fifoLockGive();
+
+	// return the size of the frame
+	return frameSize;
+}
+
+
+/**
+ * Provide a frame ahead of the current frame, without moving the internal FIFO.
+ *
+ * Used by the windowed downlink, where several frames are in flight at once and must remain
+ * stored until the Ground Station acknowledges them (see @sa fileTransferConsumeFrames). Staged
+ * frames (see @sa fileTransferPrefetch) are provided without accessing FRAM.
+ *
+ * Frames are taken from the queues in the order decided by their weights (see @sa fileTransferConfigureQueue);
+ * once provided, a frame keeps its position until it is moved past.
+ *
+ * @param offset The position of the frame relative to the current frame (1 is the next frame).
+ * @param frame Pointer to a buffer that the frame will be placed into. Set by function.
+ * @return The size of the frame placed into the buffer; 0 on error or if no frame exists there.
+ */
+uint8_t fileTransferPeekFrame(uint16_t offset, uint8_t* frame) {
+
+	// ensure the offset lands within the downlink order
+	if (offset == 0 || offset > ORDER_MAX_FRAME_COUNT)
+		return 0;
+
+	if (fifoLockTake() != SUCCESS)
+		return 0;
+
+	uint8_t frameSize = 0;
+
+	if (fifoLoad() == SUCCESS) {
+
+		// decide which frames come next, up to the requested one
+		while (fifo.orderCount < offset && fifoOrderNext());
+
+		if (fifo.orderCount >= offset) {
+			fifo_entry_t entry = fifo.order[offset - 1];
+
+			// provide staged frames straight from RAM
+			prefetch_entry_t* staged = prefetchFind(entry);
+			if (staged != 0) {
+				memcpy(frame, staged->frame.data, staged->frame.size);
+				frameSize = staged->frame.size;
+			}
+
+			// read requested frame from FRAM
+			else
+				frameSize = fifoReadFrame(entry, frame);
+		}
+	}
+
+	fifoLockGive();
+
+	// return the size of the frame
+	return frameSize;
+}
+
+
+/**
+ * Advance the internal FIFO past frames that have been acknowledged.
+ *
+ * The last consumed frame becomes the new current frame, exactly as if @sa fileTransferNextFrame
+ * had been called the given number of times. Only the cursors in RAM are moved; they are recorded in
+ * FRAM during the next @sa fileTransferPrefetch.
+ *
+ * @param count The number of frames to move past.
+ * @return 0 on success, -1 on internal cursor error.
+ */
+int fileTransferConsumeFrames(uint16_t count) {
+
+	// nothing to do
+	if (count == 0)
+		return SUCCESS;
+
+	if (count > ORDER_MAX_FRAME_COUNT)
+		return ERROR_CURSOR;
+
+	int error = fifoLockTake();
+	if (error != SUCCESS)
+		return error;
+
+	error = fifoLoad();
+
+	if (error == SUCCESS) {
+		// decide which frames are being moved past (if not done already)
+		while (fifo.orderCount < count && fifoOrderNext());
+
+		// cannot move past frames that have not been written
+		if (fifo.orderCount < count)
+			error = ERROR_CURSOR;
+	}
+
+	if (error == SUCCESS) {
+		// increment the read cursors
+		for (uint16_t i = 0; i < count; i++) {
+			fifo_queue_t* queue = &fifo.queues[fifo.order[i].queue];
+			queue->readSequence = fifo.order[i].sequence;
+			queue->ordered--;
+		}
+
+		fifo.current = fifo.order[count - 1];
+		fifo.orderCount -= count;
+		memmove(&fifo.order[0], &fifo.order[count], fifo.orderCount * sizeof(fifo_entry_t));
+
+		// drop staged frames that were moved past (they are never provided again)
+		for (uint8_t i = 0; i < PREFETCH_FRAME_COUNT; i++) {
+			if (prefetch[i].entry.sequence <= fifo.queues[prefetch[i].entry.queue].readSequence)
+				prefetch[i].valid = 0;
+		}
+	}
+
+	fifoLockGive();
+
+	return error;
+}
+
+
+/**
+ * Record the FIFO cursors in FRAM and stage upcoming frames in RAM.
+ *
+ * Saves the read cursors (if frames were moved past), then reads the frames at the given offset
+ * (and those following it) into RAM, so that they can be provided without accessing FRAM. Should
+ * be called when there is time to spare (e.g. while awaiting an ACK).
+ *
+ * @param offset The position of the first frame to stage, relative to the current frame.
+ */
+void fileTransferPrefetch(uint16_t offset) {
+
+	if (fifoLockTake() != SUCCESS)
+		return;
+
+	if (fifoLoad() != SUCCESS) {
+		fifoLockGive();
+		return;
+	}
+
+	// bring FRAM up to date with any frames moved past, and with messages that have waited long enough
+	fifoCommit();
+	packFlushExpired();
+
+	// decide which frames come next, up to the last one to stage
+	uint16_t last = offset + PREFETCH_FRAME_COUNT - 1;
+	if (last > ORDER_MAX_FRAME_COUNT)
+		last = ORDER_MAX_FRAME_COUNT;
+
+	while (offset > 0 && fifo.orderCount < last && fifoOrderNext());
+
+	// release staged frames outside of the requested range
+	for (uint8_t i = 0; i < PREFETCH_FRAME_COUNT; i++) {
+		uint8_t wanted = 0;
+		for (uint16_t position = offset; position > 0 && position <= last && position <= fifo.orderCount; position++) {
+			if (fifo.order[position - 1].queue == prefetch[i].entry.queue
+			&& fifo.order[position - 1].sequence == prefetch[i].entry.sequence)
+				wanted = 1;
+		}
+
+		if (!wanted)
+			prefetch[i].valid = 0;
+	}
+
+	// stage the frames in the requested range (that have been written)
+	for (uint16_t position = offset; position > 0 && position <= last && position <= fifo.orderCount; position++) {
+		fifo_entry_t entry = fifo.order[position - 1];
+		if (prefetchFind(entry) != 0)
+			continue;
+
+		// place the frame into a free entry (one is always free, since the range fits all entries)
+		for (uint8_t i = 0; i < PREFETCH_FRAME_COUNT; i++) {
+			if (prefetch[i].valid)
+				continue;
+
+			prefetch[i].frame.size = fifoReadFrame(entry, prefetch[i].frame.data);
+			prefetch[i].entry = entry;
+			prefetch[i].valid = (prefetch[i].frame.size > 0);
+			break;
+		}
+	}
+
+	fifoLockGive();
+}
+
+
+/**
+ * Prepare a message for downlink and add it to the internal FIFO.
+ *
+ * Messages are packed together into frames (up to the max frame size) to make the most of both the
+ * FIFO and the downlink. A frame is added to the FIFO once the next message no longer fits into it,
+ * once its first message has waited long enough (see @sa fileTransferFlushExpired), or when requested
+ * (see @sa fileTransferFlush). Error reports are added to the FIFO straight away.
+ *
+ * The message is placed into the queue for its kind of data (see @sa file_transfer_queue_t), and
+ * is encoded straight from the given struct into the frame being packed for that queue.
+ *
+ * Periodic records (i.e. dosimeter counts) are first grouped into series, as differences from one
+ * another (see RFileTransferSeries.c); only completed series are packed.
+ *
+ * @param message Pointer to the raw Protobuf message to be prepared; its type must match messageTag.
+ * @param size The size (in bytes) of the message.
+ * @param messageTag The Protobuf tag of the message.
+ * @return 0 on success, -1 if a full queue rejected a frame, -2 on message wrapping error, otherwise see hal/errors.h.
+ */
+int fileTransferAddMessage(const void* message, uint8_t size, uint16_t messageTag) {
+
+	// ensure input pointer is valid
+	if (message == 0) {
+		return E_INPUT_POINTER_NULL;
+	}
+
+	// ensure size parameter is valid
+	if (size == 0 || size > (uint8_t)PROTO_MAX_ENCODED_SIZE)
+		return E_PARAM_OUTOFBOUNDS;
+
+	uint8_t queue = packQueue(messageTag);
+
+	int error = fifoLockTake();
+	if (error != SUCCESS)
+		return error;
+
+	// group periodic records into series; pack a series once it is completed
+	if (messageTag == file_transfer_message_DosimeterCounts_tag) {
+		const dosimeter_series* series = seriesAdd((const dosimeter_counts*)message);
+
+		if (series != NULL)
+			error = packAdd(queue, series, file_transfer_message_DosimeterSeries_tag);
+	}
+	else {
+		error = packAdd(queue, message, messageTag);
+
+		// error reports are often the last thing recorded before a reset; keep them in FRAM right away
+		if (messageTag == file_transfer_message_ModuleErrorReport_tag
+			|| messageTag == file_transfer_message_ComponentErrorReport_tag
+			|| messageTag == file_transfer_message_ErrorReportSummary_tag) {
+			int flushError = packFlush(queue);
+			if (error == SUCCESS)
+				error = flushError;
+		}
+	}
+
+	// frames of the other queues may have waited long enough as well (their failures are not this message's)
+	packFlushExpired();
+
+	fifoLockGive();
+
+	return error;
+}
+
+
+/**
+ * Add the frames whose first message has waited long enough to the internal FIFO.
+ *
+ * Messages wait in RAM (and are lost on a reset) until their frame is added to the FIFO; a queue that
+ * rarely receives messages would otherwise keep them there until the next pass. Should be called
+ * periodically (e.g. by the collection tasks); also done whenever messages are added.
+ *
+ * @return 0 on success, -1 if a full queue rejected a frame, -2 on message wrapping error, otherwise see hal/errors.h.
+ */
+int fileTransferFlushExpired(void) {
+
+	int error = fifoLockTake();
+	if (error != SUCCESS)
+		return error;
+
+	error = packFlushExpired();
+
+	fifoLockGive();
+
+	return error;
+}
+
+
+/**
+ * Add the frames currently being packed to the internal FIFO, without waiting for more messages.
+ *
+ * Should be called before frames are downlinked, so that recent messages are included.
+ *
+ * @return 0 on success, -1 on internal cursor error, -2 on message wrapping error, otherwise see hal/errors.h.
+ */
+int fileTransferFlush(void) {
+
+	int error = fifoLockTake();
+	if (error != SUCCESS)
+		return error;
+
+	// pack the series being built, so that its records are included as well
+	const dosimeter_series* series = seriesFlush();
+	if (series != NULL)
+		error = packAdd(packQueue(file_transfer_message_DosimeterSeries_tag), series, file_transfer_message_DosimeterSeries_tag);
+
+	// flush every queue, reporting the first failure
+	for (uint8_t queue = 0; queue < fileTransferQueueCount; queue++) {
+		int queueError = packFlush(queue);
+		if (error == SUCCESS)
+			error = queueError;
+	}
+
+	fifoLockGive();
+
+	return error;
+}
+
+
+/**
+ * Set the share of the downlink given to a queue, and what happens when it is full.
+ *
+ * Whenever several queues hold frames, each receives frames in proportion to its weight; a queue
+ * with a weight of 0 only receives frames while all other queues are empty. Settings are kept in RAM.
+ *
+ * @param queue The queue to configure.
+ * @param weight The share of the downlink given to the queue.
+ * @param overflow What happens to a new frame when the queue is full.
+ * @return 0 on success, otherwise see hal/errors.h.
+ */
+int fileTransferConfigureQueue(file_transfer_queue_t queue, uint8_t weight, file_transfer_overflow_t overflow) {
+
+	if (queue >= fileTransferQueueCount)
+		return E_PARAM_OUTOFBOUNDS;
+
+	if (overflow != fileTransferOverflowReject && overflow != fileTransferOverflowDropOldest)
+		return E_PARAM_OUTOFBOUNDS;
+
+	int error = fifoLockTake();
+	if (error != SUCCESS)
+		return error;
+
+	queueConfig[queue].weight = weight;
+	queueConfig[queue].overflow = overflow;
+
+	fifoLockGive();
+
+	return SUCCESS;
+}
+
+
+/**
+ * Provide the state of a queue.
+ *
+ * @param queue The queue of interest.
+ * @param status Pointer to the state to fill in. Set by function.
+ * @return 0 on success, otherwise see hal/errors.h.
+ */
+int fileTransferQueueStatus(file_transfer_queue_t queue, file_transfer_queue_status_t* status) {
+
+	if (status == 0)
+		return E_INPUT_POINTER_NULL;
+
+	if (queue >= fileTransferQueueCount)
+		return E_PARAM_OUTOFBOUNDS;
+
+	int error = fifoLockTake();
+	if (error != SUCCESS)
+		return error;
+
+	error = fifoLoad();
+
+	if (error == SUCCESS) {
+		status->capacity = queueConfig[queue].capacity;
+		status->frames = (uint16_t)(fifo.queues[queue].writeSequence - fifo.queues[queue].readSequence - 1);
+		status->weight = queueConfig[queue].weight;
+		status->dropped = fifo.queues[queue].dropped;
+		status->rejected = fifo.queues[queue].rejected;
+	}
+
+	fifoLockGive();
+
+	return error;
+}
+
+
+/**
+ * Resets the file transfer content in FRAM to the following initial values:
+ *  - Write Cursors = 1
+ *  - Read Cursors  = 0
+ *  - All stored frames are invalid (they belong to the previous epoch).
+ *
+ * Only the journal is written; the stored frames are left as they are.
+ */
+void fileTransferReset(void) {
+
+	if (fifoLockTake() != SUCCESS)
+		return;
+
+	// drop the frames being packed, and the series being built
+	memset(pack, 0, sizeof(pack));
+	seriesReset();
+
+	// the epoch must follow on from the one stored in FRAM
+	if (fifoLoad() == SUCCESS)
+		fifoStartOver();
+
+	fifoLockGive();
+}
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Load the FIFO cursors from the latest valid journal record, and find any frames written since.
+ *
+ * Does nothing once loaded. Without any valid record (e.g. on first start-up), the FIFO is erased.
+ *
+ * @pre The FIFO lock is held (see @sa fifoLockTake).
+ * @return 0 on success, otherwise an error.
+ */
+static int fifoLoad(void) {
+
+	if (fifo.loaded)
+		return SUCCESS;
+
+	// find the latest valid journal record
+	fifo_journal_t latest = { 0 };
+	uint8_t found = 0;
+
+	for (uint8_t i = 0; i < JOURNAL_RECORD_COUNT; i++) {
+		fifo_journal_t record = { 0 };
+		int error = framRead((uint8_t*)&record, FRAM_JOURNAL_ADDR + (i * sizeof(fifo_journal_t)), sizeof(fifo_journal_t));
+		if (error != SUCCESS)
+			return error;
+
+		if (record.crc != crcFast((uint8_t*)&record, offsetof(fifo_journal_t, crc)))
+			continue;
+
+		uint8_t valid = (record.currentQueue < fileTransferQueueCount);
+		for (uint8_t queue = 0; queue < fileTransferQueueCount; queue++) {
+			if (record.readSequence[queue] >= record.writeSequence[queue]
+			|| record.writeSequence[queue] - record.readSequence[queue] > QUEUE_SLOT_COUNT((uint32_t)queueConfig[queue].capacity))
+				valid = 0;
+		}
+
+		if (valid && (!found || (int32_t)(record.commit - latest.commit) > 0)) {
+			latest = record;
+			found = 1;
+		}
+	}
+
+	// nothing stored yet (or nothing that can be trusted); start with an empty FIFO
+	if (!found) {
+		fifoErase();
+		return SUCCESS;
+	}
+
+	fifo.journal = latest;
+	fifo.epoch = latest.epoch;
+	fifo.orderCount = 0;
+
+	for (uint8_t queue = 0; queue < fileTransferQueueCount; queue++) {
+		fifo_queue_t* cursors = &fifo.queues[queue];
+		cursors->writeSequence = latest.writeSequence[queue];
+		cursors->readSequence = latest.readSequence[queue];
+		cursors->ordered = 0;
+		cursors->credit = 0;
+
+		// frames written since the last record carry the sequence numbers that follow it
+		while (cursors->writeSequence - cursors->readSequence <= queueConfig[queue].capacity) {
+			fram_slot_marker_t marker = { 0 };
+			uint32_t address = fifoSlotAddress(queue, cursors->writeSequence) + offsetof(fram_slot_t, marker);
+			int error = framRead((uint8_t*)&marker, address, sizeof(marker));
+			if (error != SUCCESS || marker.epoch != fifo.epoch || marker.sequence != cursors->writeSequence)
+				break;
+
+			cursors->writeSequence++;
+		}
+	}
+
+	fifo.current.queue = latest.currentQueue;
+	fifo.current.sequence = latest.readSequence[latest.currentQueue];
+	fifo.loaded = 1;
+
+	return SUCCESS;
+}
+
+
+/**
+ * Write a journal record of the FIFO cursors, if they have moved since the last one.
+ *
+ * Records are written in turn, so that the previous record survives a write interrupted by a loss
+ * of power. Only the read cursors are compared; frames written are found again when loading.
+ *
+ * @pre The FIFO lock is held (see @sa fifoLockTake).
+ */
+static void fifoCommit(void) {
+
+	uint8_t changed = (fifo.journal.commit == 0 || fifo.journal.epoch != fifo.epoch || fifo.journal.currentQueue != fifo.current.queue);
+	for (uint8_t queue = 0; queue < fileTransferQueueCount; queue++) {
+		if (fifo.journal.readSequence[queue] != fifo.queues[queue].readSequence)
+			changed = 1;
+	}
+
+	if (!changed)
+		return;
+
+	fifo_journal_t record = { 0 };
+	record.commit = fifo.journal.commit + 1;
+	record.epoch = fifo.epoch;
+	for (uint8_t queue = 0; queue < fileTransferQueueCount; queue++) {
+		record.writeSequence[queue] = fifo.queues[queue].writeSequence;
+		record.readSequence[queue] = fifo.queues[queue].readSequence;
+	}
+	record.currentQueue = fifo.current.queue;
+	record.crc = crcFast((uint8_t*)&record, offsetof(fifo_journal_t, crc));
+
+	uint32_t address = FRAM_JOURNAL_ADDR + ((record.commit % JOURNAL_RECORD_COUNT) * sizeof(fifo_journal_t));
+	if (framWrite((uint8_t*)&record, address, sizeof(fifo_journal_t)) == SUCCESS)
+		fifo.journal = record;
+}
+
+
+/**
+ * Decide which frame comes next in the downlink order, using a smooth weighted round-robin.
+ *
+ * Every queue holding frames gains its weight in credit; the queue with the most credit provides
+ * the next frame and pays back the weights of all competing queues. Over time, each queue receives
+ * frames in proportion to its weight, without long runs from any single queue.
+ *
+ * @pre The FIFO lock is held (see @sa fifoLockTake).
+ * @return 1 if a frame was added to the downlink order; 0 if there are no more frames (or no more room).
+ */
+static uint8_t fifoOrderNext(void) {
+
+	if (fifo.orderCount >= ORDER_MAX_FRAME_COUNT)
+		return 0;
+
+	// queues without a weight are only used when no weighted queue holds frames
+	uint8_t pending[fileTransferQueueCount] = { 0 };
+	uint8_t weighted = 0;
+	for (uint8_t queue = 0; queue < fileTransferQueueCount; queue++) {
+		fifo_queue_t* cursors = &fifo.queues[queue];
+		pending[queue] = (cursors->readSequence + cursors->ordered + 1 < cursors->writeSequence);
+		if (pending[queue] && queueConfig[queue].weight > 0)
+			weighted = 1;
+	}
+
+	int16_t totalWeight = 0;
+	int8_t selected = -1;
+	for (uint8_t queue = 0; queue < fileTransferQueueCount; queue++) {
+		if (!pending[queue] || (weighted && queueConfig[queue].weight == 0))
+			continue;
+
+		fifo.queues[queue].credit += queueConfig[queue].weight;
+		totalWeight += queueConfig[queue].weight;
+
+		if (selected < 0 || fifo.queues[queue].credit > fifo.queues[selected].credit)
+			selected = queue;
+	}
+
+	// no frames left to order
+	if (selected < 0)
+		return 0;
+
+	fifo_queue_t* cursors = &fifo.queues[selected];
+	cursors->credit -= totalWeight;
+	cursors->ordered++;
+
+	fifo.order[fifo.orderCount].queue = (uint8_t)selected;
+	fifo.order[fifo.orderCount].sequence = cursors->readSequence + cursors->ordered;
+	fifo.orderCount++;
+
+	return 1;
+}
+
+
+/**
+ * Read a frame from FRAM.
+ *
+ * @pre The FIFO lock is held (see @sa fifoLockTake).
+ * @param entry The position of the frame.
+ * @param frame Pointer to a buffer that the frame will be placed into. Set by function.
+ * @return The size of the frame placed into the buffer; 0 on error or if the slot no longer holds the frame.
+ */
+static uint8_t fifoReadFrame(fifo_entry_t entry, uint8_t* frame) {
+
+	fram_slot_t slot = { 0 };
+	if (framRead((uint8_t*)&slot, fifoSlotAddress(entry.queue, entry.sequence), FRAM_DATA_FRAME_SIZE) != SUCCESS)
+		return 0;
+
+	// only provide a frame if the slot holds the requested frame
+	if (slot.marker.epoch != fifo.epoch || slot.marker.sequence != entry.sequence
+	|| slot.frame.size == 0 || slot.frame.size > TRANCEIVER_TX_MAX_FRAME_SIZE)
+		return 0;
+
+	memcpy(frame, slot.frame.data, slot.frame.size);
+
+	return slot.frame.size;
+}
+
+
+/**
+ * Write a frame into the next slot of a queue, applying its overflow policy when it is full.
+ *
+ * @pre The FIFO lock is held (see @sa fifoLockTake).
+ * @param queue The queue to write into.
+ * @param frame The frame to write.
+ * @return 0 on success, -1 if the queue is full, otherwise see hal/errors.h.
+ */
+static int fifoWriteFrame(uint8_t queue, const fram_frame_t* frame) {
+
+	int error = fifoLoad();
+	if (error != SUCCESS)
+		return error;
+
+	fifo_queue_t* cursors = &fifo.queues[queue];
+
+	// ensure we are not about to overwrite frames that have not been read
+	if (cursors->writeSequence - cursors->readSequence > queueConfig[queue].capacity) {
+
+		// the oldest frame can only be dropped if it has not yet been provided for downlink
+		if (queueConfig[queue].overflow != fileTransferOverflowDropOldest || cursors->ordered > 0) {
+			cursors->rejected++;
+			return ERROR_CURSOR;
+		}
+
+		// move past the oldest frame, and record it before its slot is reused
+		cursors->readSequence++;
+		cursors->dropped++;
+		fifoCommit();
+	}
+
+	// write data in FRAM (the marker identifies the slot as holding the new frame)
+	fram_slot_t slot = { 0 };
+	slot.frame = *frame;
+	slot.marker.epoch = fifo.epoch;
+	slot.marker.sequence = cursors->writeSequence;
+
+	error = framWrite((uint8_t*)&slot, fifoSlotAddress(queue, cursors->writeSequence), FRAM_DATA_FRAME_SIZE);
+	if (error != SUCCESS)
+		return error;
+
+	// upon success, increment cursor
+	cursors->writeSequence++;
+
+	return SUCCESS;
+}
+
+
+/**
+ * Provide the FRAM address of the slot holding a frame.
+ *
+ * @param queue The queue holding the frame.
+ * @param sequence The sequence number of the frame.
+ * @return The FRAM address of the slot.
+ */
+static uint32_t fifoSlotAddress(uint8_t queue, uint32_t sequence) {
+	uint32_t slot = queueConfig[queue].firstSlot + (sequence % QUEUE_SLOT_COUNT(queueConfig[queue].capacity));
+	return FRAM_DATA_START_ADDR + (slot * FRAM_DATA_FRAME_SIZE);
+}
+
+
+/**
+ * Start over with an empty FIFO and the default cursors (Write Cursors = 1, Read Cursors = 0).
+ *
+ * Moving on to a new epoch invalidates all stored frames at once, so only the journal is written.
+ *
+ * @pre The FIFO lock is held (see @sa fifoLockTake).
+ */
+static void fifoStartOver(void) {
+
+	// drop all staged frames
+	memset(prefetch, 0, sizeof(prefetch));
+
+	// reset the cursors to their default values (keeping the statistics)
+	for (uint8_t queue = 0; queue < fileTransferQueueCount; queue++) {
+		fifo.queues[queue].writeSequence = 1;
+		fifo.queues[queue].readSequence = 0;
+		fifo.queues[queue].ordered = 0;
+		fifo.queues[queue].credit = 0;
+	}
+
+	fifo.current.queue = 0;
+	fifo.current.sequence = 0;
+	fifo.orderCount = 0;
+	fifo.loaded = 1;
+
+	// frames of the previous epoch are no longer valid; record the new cursors
+	fifo.epoch++;
+	fifoCommit();
+}
+
+
+/**
+ * Erase all frames, and start over with an empty FIFO.
+ *
+ * Only needed when FRAM holds no journal record that can be trusted (e.g. on first start-up), since
+ * the stored frames could then match any epoch.
+ *
+ * @pre The FIFO lock is held (see @sa fifoLockTake).
+ */
+static void fifoErase(void) {
+
+	// reset all data frames to zero
+	fram_slot_t emptySlot = {0};
+	for(int i=0; i<MAX_SLOT_COUNT; i++) {
+		uint32_t framDataAddr = FRAM_DATA_START_ADDR + (i * FRAM_DATA_FRAME_SIZE);
+		framWrite((uint8_t*)&emptySlot, framDataAddr, FRAM_DATA_FRAME_SIZE);
+	}
+
+	fifoStartOver();
+}
+
+
+/**
+ * Obtain exclusive access to the FIFO.
+ *
+ * @return 0 on success, otherwise an error.
+ */
+static int fifoLockTake(void) {
+
+	// create the lock on first use
+	if (fifoLock == NULL) {
+		taskENTER_CRITICAL();
+		if (fifoLock == NULL)
+			fifoLock = xSemaphoreCreateMutex();
+		taskEXIT_CRITICAL();
+	}
+
+	if (fifoLock == NULL)
+		return E_GENERIC;
+
+	if (xSemaphoreTake(fifoLock, FIFO_LOCK_TIMEOUT_MS / portTICK_RATE_MS) != pdTRUE)
+		return E_GENERIC;
+
+	return SUCCESS;
+}
+
+
+/**
+ * Release exclusive access to the FIFO.
+ */
+static void fifoLockGive(void) {
+	xSemaphoreGive(fifoLock);
+}
+
+
+/**
+ * Find the staged copy of a frame.
+ *
+ * @param entry The position of the frame.
+ * @return The entry holding the staged frame; NULL if the frame is not staged.
+ */
+static prefetch_entry_t* prefetchFind(fifo_entry_t entry) {
+	for (uint8_t i = 0; i < PREFETCH_FRAME_COUNT; i++) {
+		if (prefetch[i].valid && prefetch[i].entry.queue == entry.queue && prefetch[i].entry.sequence == entry.sequence)
+			return &prefetch[i];
+	}
+
+	return 0;
+}
+
+
+/**
+ * Provide the queue that a message belongs in.
+ *
+ * @param messageTag The Protobuf tag of the message.
+ * @return The queue for the message (see @sa file_transfer_queue_t).
+ */
+static uint8_t packQueue(uint16_t messageTag) {
+	switch (messageTag) {
+		case file_transfer_message_DosimeterData_tag:
+		case file_transfer_message_DosimeterCounts_tag:
+		case file_transfer_message_DosimeterSeries_tag:
+			return fileTransferQueueScience;
+
+		case file_transfer_message_ImagePacket_tag:
+			return fileTransferQueueBulk;
+
+		default:
+			return fileTransferQueueHealth;
+	}
+}
+
+
+/**
+ * Pack a message into the frame being packed for a queue, adding frames to the FIFO as needed.
+ *
+ * @pre The FIFO lock is held (see @sa fifoLockTake).
+ * @param queue The queue the message is placed into.
+ * @param message Pointer to the raw Protobuf message.
+ * @param messageTag The Protobuf tag of the message.
+ * @return 0 on success, -1 if a full queue rejected a frame, -2 on message wrapping error, otherwise see hal/errors.h.
+ */
+static int packAdd(uint8_t queue, const void* message, uint16_t messageTag) {
+
+	int error = SUCCESS;
+
+	// add the frame being packed to the FIFO if it has waited long enough
+	if (packExpired(queue)) {
+		error = packFlush(queue);
+
+		// a frame rejected by a full queue is gone; the new message still starts the next frame
+		if (error != SUCCESS && error != ERROR_CURSOR)
+			return error;
+	}
+
+	// encode the message straight into the frame being packed
+	uint8_t encodedSize = packEncode(queue, message, messageTag);
+
+	// if the message does not fit, add the frame to the FIFO and start the next one with the message
+	if (encodedSize == 0 && pack[queue].count > 0) {
+		error = packFlush(queue);
+
+		if (error != SUCCESS && error != ERROR_CURSOR)
+			return error;
+
+		encodedSize = packEncode(queue, message, messageTag);
+	}
+
+	// return error if the message could not be encoded at all
+	if (encodedSize == 0)
+		return ERROR_MESSAGE_WRAPPING;
+
+	// report any frame rejected along the way
+	return error;
+}
+
+
+/**
+ * Encode a message straight into the frame being packed for a queue, starting a new frame if needed.
+ *
+ * @pre The FIFO lock is held (see @sa fifoLockTake).
+ * @param queue The queue whose frame the message is packed into.
+ * @param message Pointer to the raw Protobuf message.
+ * @param messageTag The Protobuf tag of the message.
+ * @return The size of the encoded message; 0 if it failed to encode or does not fit into the frame.
+ */
+static uint8_t packEncode(uint8_t queue, const void* message, uint16_t messageTag) {
+
+	// start a new frame, leaving room for the header
+	if (pack[queue].count == 0) {
+		pack[queue].frame.size = RADSAT_SK_HEADER_SIZE;
+		pack[queue].startTime = xTaskGetTickCount();
+	}
+
+	// encode behind the messages packed so far; nothing is kept unless the whole message fits
+	uint8_t encodedSize = protoEncodeMessage(radsat_message_FileTransferMessage_tag, messageTag, message,
+											 &pack[queue].frame.data[pack[queue].frame.size],
+											 (uint8_t)(PACK_MAX_FRAME_SIZE - pack[queue].frame.size));
+	if (encodedSize == 0)
+		return 0;
+
+	pack[queue].frame.size += encodedSize;
+	pack[queue].count++;
+
+	return encodedSize;
+}
+
+
+/**
+ * Wrap the frame being packed for a queue and write it into the FIFO.
+ *
+ * @pre The FIFO lock is held (see @sa fifoLockTake).
+ * @param queue The queue whose frame is flushed.
+ * @return 0 on success (or if there was nothing to flush), -1 on internal cursor error, -2 on message wrapping error.
+ */
+static int packFlush(uint8_t queue) {
+
+	// nothing to do
+	if (pack[queue].count == 0)
+		return SUCCESS;
+
+	// wrap the packed messages under a single header, filled in within the room left for it
+	uint8_t wrappedSize = messageWrapEncoded(pack[queue].frame.data, (uint8_t)(pack[queue].frame.size - RADSAT_SK_HEADER_SIZE));
+
+	// return error if message wrapping failed (the packed messages are kept for another attempt)
+	if (wrappedSize == 0)
+		return ERROR_MESSAGE_WRAPPING;
+
+	int error = fifoWriteFrame(queue, &pack[queue].frame);
+
+	// a rejected frame is lost; start over either way, so that the queue does not stall on it
+	if (error == SUCCESS || error == ERROR_CURSOR)
+		memset(&pack[queue], 0, sizeof(pack_state_t));
+
+	return error;
+}
+
+
+/**
+ * Add the frames whose first message has waited long enough to the FIFO (see @sa PACK_MAX_AGE_MS).
+ *
+ * @pre The FIFO lock is held (see @sa fifoLockTake).
+ * @return 0 on success (or if there was nothing to flush), otherwise the first failure (see @sa packFlush).
+ */
+static int packFlushExpired(void) {
+
+	int error = SUCCESS;
+
+	for (uint8_t queue = 0; queue < fileTransferQueueCount; queue++) {
+		if (!packExpired(queue))
+			continue;
+
+		int queueError = packFlush(queue);
+		if (error == SUCCESS)
+			error = queueError;
+	}
+
+	return error;
+}
+
+
+/**
+ * Provide whether the first message of the frame being packed for a queue has waited long enough.
+ *
+ * @pre The FIFO lock is held (see @sa fifoLockTake).
+ * @param queue The queue whose frame is checked.
+ * @return 1 if the frame holds messages and has waited at least PACK_MAX_AGE_MS; 0 otherwise.
+ */
+static uint8_t packExpired(uint8_t queue) {
+	return (pack[queue].count > 0 && (xTaskGetTickCount() - pack[queue].startTime) >= (PACK_MAX_AGE_MS / portTICK_RATE_MS));
+}
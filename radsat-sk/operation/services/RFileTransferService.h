@@ -1,26 +1,77 @@
-/**
- * @file RFileTransferService.h
- * @date February 25, 2022
- * @author Tyrel Kostyk (tck290)
- */
-
-#ifndef RFILETRANSFERSERVICE_H_
-#define RFILETRANSFERSERVICE_H_
-
-#include <stdint.h>
-#include <RFileTransfer.pb.h>
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-uint8_t fileTransferNextFrame(uint8_t* frame);
-uint8_t fileTransferCurrentFrame(uint8_t* frame);
-
-int fileTransferAddMessage(const void* message, uint8_t size, uint16_t messageTag);
-
-void fileTransferReset(void);
-
-
-#endif /* RFILETRANSFERSERVICE_H_ */
+/**
+ * @file RFileTransferService.h
+ * @date February 25, 2022
+ * @author Tyrel Kostyk (tck290)
+ */
+
+#ifndef RFILETRANSFERSERVICE_H_
+#define RFILETRANSFERSERVICE_H_
+
+#include <stdint.h>
+#include <RFileTransfer.pb.h>
+#include <RReedSolomon.h>
+
+
+/***************************************************************************************************
+                                            DEFINITIONS
+***************************************************************************************************/
+
+/**
+ * Bytes of every frame left free for downlink framing: the windowed downlink's sequence number, and the
+ * parity bytes appended when the Ground Station asks for forward error correction (see RReedSolomon.h).
+ */
+#define FILE_TRANSFER_FRAME_RESERVED_SIZE	(1 + RS_MAX_PARITY_SIZE)
+
+
+/**
+ * The queues of the downlink FIFO. Each holds its own frames and receives its own share of the downlink
+ * (see @sa fileTransferConfigureQueue), so that a burst of one kind of data cannot crowd out the others.
+ */
+typedef enum _file_transfer_queue_t {
+	fileTransferQueueHealth		= 0,	///< Telemetry and error reports
+	fileTransferQueueScience	= 1,	///< Science payload data (i.e. dosimeter measurements)
+	fileTransferQueueBulk		= 2,	///< Bulk data (i.e. image packets)
+	fileTransferQueueCount		= 3,	///< Number of queues (not a valid queue)
+} file_transfer_queue_t;
+
+
+/** What happens to a new frame when its queue is full */
+typedef enum _file_transfer_overflow_t {
+	fileTransferOverflowReject		= 0,	///< The new frame is rejected; stored frames are kept
+	fileTransferOverflowDropOldest	= 1,	///< The oldest stored frame (not yet provided for downlink) is dropped
+} file_transfer_overflow_t;
+
+
+/** The state of a single queue */
+typedef struct _file_transfer_queue_status_t {
+	uint16_t capacity;		///< The max number of frames stored at one time
+	uint16_t frames;		///< The number of frames stored and awaiting downlink
+	uint8_t weight;			///< The share of the downlink given to the queue
+	uint32_t dropped;		///< Frames dropped to make room for newer ones (since start-up)
+	uint32_t rejected;		///< Frames rejected due to a full queue (since start-up)
+} file_transfer_queue_status_t;
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+int fileTransferInit(void);
+
+uint8_t fileTransferNextFrame(uint8_t* frame);
+uint8_t fileTransferCurrentFrame(uint8_t* frame);
+uint8_t fileTransferPeekFrame(uint16_t offset, uint8_t* frame);
+int fileTransferConsumeFrames(uint16_t count);
+void fileTransferPrefetch(uint16_t offset);
+
+int fileTransferAddMessage(const void* message, uint8_t size, uint16_t messageTag);
+int fileTransferFlush(void);
+int fileTransferFlushExpired(void);
+
+int fileTransferConfigureQueue(file_transfer_queue_t queue, uint8_t weight, file_transfer_overflow_t overflow);
+int fileTransferQueueStatus(file_transfer_queue_t queue, file_transfer_queue_status_t* status);
+
+void fileTransferReset(void);
+
+
+#endif /* RFILETRANSFERSERVICE_H_ */
@@ -1,22 +1,23 @@
-/**
- * @file RProtocolService.h
- * @date February 21, 2022
- * @author Tyrel Kostyk (tck290)
- */
-
-#ifndef RPROTOCOLSERVICE_H_
-#define RPROTOCOLSERVICE_H_
-
-#include <RProtocol.pb.h>
-#include <stdint.h>
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-uint8_t protocolGenerate(uint16_t messageTag, uint8_t* wrappedMessage);
-uint8_t protocolHandle(uint8_t* wrappedMessage, uint8_t size);
-
-
-#endif /* RPROTOCOLSERVICE_H_ */
+/**
+ * @file RProtocolService.h
+ * @date February 21, 2022
+ * @author Tyrel Kostyk (tck290)
+ */
+
+#ifndef RPROTOCOLSERVICE_H_
+#define RPROTOCOLSERVICE_H_
+
+#include <RProtocol.pb.h>
+#include <stdint.h>
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+uint8_t protocolGenerate(uint16_t messageTag, uint8_t* wrappedMessage);
+uint8_t protocolGenerateBatchAck(uint8_t count, uint32_t executed, uint8_t* wrappedMessage);
+uint8_t protocolHandle(uint8_t* wrappedMessage, uint8_t size, selective_ack* selectiveAck);
+
+
+#endif /* RPROTOCOLSERVICE_H_ */
@@ -1,174 +1,221 @@
-/**
- * @file RTelecommandService.c
- * @date February 21, 2022
- * @author Tyrel Kostyk (tck290)
- */
-
-#include <RTelecommandService.h>
-#include <RCameraService.h>
-#include <RMessage.h>
-#include <stdio.h>
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-/**
- * Process (and execute where necessary) received telecommands.
- *
- * @param wrappedMessage A pointer to a wrapped (encrypted, etc.) RADSAT-SK message.
- * @param size The size (in bytes) of the wrapped message.
- * @return The tag of the processed telecommand (0 on failure).
- */
-uint8_t telecommandHandle(uint8_t* wrappedMessage, uint8_t size) {
-
-	// ensure the input pointer is not NULL
-	if (wrappedMessage == 0)
-		return 0;
-
-	// generate new RADSAT-SK message to populate
-	radsat_message rawMessage = { 0 };
-
-	// unwrap the message
-	uint8_t rawSize = messageUnwrap(wrappedMessage, size, &rawMessage);
-
-	// exit if unwrapping failed
-	if (rawSize == 0)
-		return 0;
-
-	// exit if this message is not a telecommand message
-	if (rawMessage.which_service != radsat_message_TelecommandMessage_tag)
-		return 0;
-
-	// obtain the specific telecommand
-	uint8_t telecommand = (uint8_t) rawMessage.TelecommandMessage.which_message;
-
-	// execute the telecommands
-	switch (telecommand) {
-
-		// indicates that a communication link has been established
-		case (telecommand_message_BeginPass_tag):
-			// do nothing; this reception of this telecommand already begins the pass mode
-			break;
-
-		// indicates that a telecommands are done; ready for file transfers
-		case (telecommand_message_BeginFileTransfer_tag):
-			// do nothing; higher level tasks will handle
-			break;
-
-		// indicates that all downlink activities shall be ceased
-		case (telecommand_message_CeaseTransmission_tag):
-			// do nothing; higher level tasks will handle
-			break;
-
-		// indicates that downlink activities may be resumed
-		case (telecommand_message_ResumeTransmission_tag):
-			// do nothing; higher level tasks will handle
-			break;
-
-		// provides a new accurate time for the OBC to set itself to
-		case (telecommand_message_UpdateTime_tag):
-			// TODO: implement functionality
-			break;
-
-		// instructs OBC to reset certain components on the Satellite
-		case (telecommand_message_Reset_tag):
-			// TODO: implement functionality
-			break;
-
-
-/*
-		// TO ADD: Reset cameras
-		case (?):
-			// TODO: Pass argument (reset option)
-			if (!getCubeSenseUsageState()) {
-				error = requestReset(resetOption);
-				if (error != 0) {
-					printf("Error resetting cameras.\n");
-				}
-			}
-			break;
-
-		// TO ADD: Change both cameras' settings
-		case (?):
-			// TODO: Pass arguments (2x CameraSettings_ConfigurationSettings struct)
-			if (!getCubeSenseUsageState()) {
-				// TODO: To replace with passed arguments
-				CameraSettings_ConfigurationSettings sunSettings = {0};
-				CameraSettings_ConfigurationSettings nadirSettings = {0};
-				error = setCamerasSettings(sunSettings, nadirSettings);
-				if (error != 0) {
-					printf("Error updating cameras settings.\n");
-				}
-			}
-			break;
-
-		// TO ADD: Change automatic image capture interval
-		case (?):
-			// TODO: Pass argument (interval in ms)
-			setImageCaptureInterval(interval);
-			break;
-
-		// TO ADD: Change automatic image download size
-		case (?):
-			// TODO: Pass argument (0, 1, 2, 3 or 4)
-			setImageDownloadSize(downloadSize);
-			break;
-
-		// TO ADD: Set image as ready for a new capture
-		case (?):
-			setImageReadyForNewCapture();
-			break;
-
-		// TO ADD: Change image transfer frame index
-		case (?):
-			// TODO: Pass argument (frame index)
-			setImageTransferFrameIndex(frameIndex);
-			break;
-
-		// TO ADD: Take manual image
-		case (?):
-			if (!getCubeSenseUsageState()) {
-				error = requestImageCapture(NADIR_SENSOR, SRAM2, BOTTOM_HALVE);
-				if (error != 0) {
-					printf("Failed to manually capture an image...\n");
-				}
-			}
-			break;
-
-		// TO ADD: Manually start the download of an image
-		case (?):
-			// TODO: Pass arguments (image size)
-			if (!getCubeSenseUsageState()) {
-				error = requestImageDownload(SRAM2, imageSize);
-				if (error != 0) {
-					printf("Failed to start the image download...\n");
-				}
-			}
-			break;
-
-		// TO ADD: Update ADCS settings
-		case (?):
-			// TODO: Pass arguments (nb of measurements in a burst, interval between measurements)
-			setADCSBurstSettings(nbMeasurements, interval);
-			break;
-
-		// TO ADD: Reset the adcs readiness flag so it can take another burst of measurements
-		case (?):
-			setADCSReadyForNewBurst();
-			break;
-
-		// TODO: Implement missing camera telecommands
-*/
-
-
-		// unknown telecommand
-		default:
-			// do nothing; return failure
-			return 0;
-	}
-
-	return telecommand;
-}
-
+/**
+ * @file RTelecommandService.c
+ * @date February 21, 2022
+ * @author Tyrel Kostyk (tck290)
+ */
+
+#include <RTelecommandService.h>
+#include <RCameraService.h>
+#include <RDosimeter.h>
+#include <RMessage.h>
+#include <RReedSolomon.h>
+#include <RCommon.h>
+#include <stdio.h>
+#include <hal/Timing/Time.h>
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+/**
+ * Unwrap received telecommands; a single telecommand, or a batch of them.
+ *
+ * @param wrappedMessage A pointer to a wrapped (encrypted, etc.) RADSAT-SK message.
+ * @param size The size (in bytes) of the wrapped message.
+ * @param telecommands The telecommands, in order of execution (a single telecommand is a batch of one). Set by function.
+ * @param batched Whether the telecommands were sent as a batch (to be answered with a single ACK). Set by function.
+ * @return The number of telecommands (0 on failure).
+ */
+uint8_t telecommandUnwrap(uint8_t* wrappedMessage, uint8_t size, telecommand_batch* telecommands, uint8_t* batched) {
+
+	// ensure the input pointers are not NULL
+	if (wrappedMessage == 0 || telecommands == 0 || batched == 0)
+		return 0;
+
+	*batched = 0;
+	telecommands->Telecommands_count = 0;
+
+	// generate new RADSAT-SK message to populate
+	radsat_message rawMessage = { 0 };
+
+	// unwrap the message
+	uint8_t rawSize = messageUnwrap(wrappedMessage, size, &rawMessage);
+
+	// exit if unwrapping failed
+	if (rawSize == 0)
+		return 0;
+
+	// a single telecommand
+	if (rawMessage.which_service == radsat_message_TelecommandMessage_tag) {
+		telecommands->Telecommands[0] = rawMessage.TelecommandMessage;
+		telecommands->Telecommands_count = 1;
+	}
+
+	// several telecommands
+	else if (rawMessage.which_service == radsat_message_TelecommandBatch_tag) {
+		*telecommands = rawMessage.TelecommandBatch;
+		*batched = 1;
+	}
+
+	return (uint8_t)telecommands->Telecommands_count;
+}
+
+
+/**
+ * Execute (where necessary) a received telecommand.
+ *
+ * @param telecommandMessage The telecommand (see @sa telecommandUnwrap).
+ * @return The tag of the executed telecommand (0 on failure).
+ */
+uint8_t telecommandExecute(const telecommand_message* telecommandMessage) {
+
+	// ensure the input pointer is not NULL
+	if (telecommandMessage == 0)
+		return 0;
+
+	// obtain the specific telecommand
+	uint8_t telecommand = (uint8_t) telecommandMessage->which_message;
+
+	// execute the telecommand
+	switch (telecommand) {
+
+		// indicates that a communication link has been established
+		case (telecommand_message_BeginPass_tag):
+			// this reception of this telecommand already begins the pass mode; only the downlink formats are set here
+			messageCompactHeaders(telecommandMessage->BeginPass.compactHeaders,
+								  telecommandMessage->BeginPass.compactBaseTime);
+			rsConfigure(telecommandMessage->BeginPass.fecParity);
+			dosimeterSetEncoding((telecommandMessage->BeginPass.dosimeterEncoding == begin_pass_dosimeter_encoding_t_Voltage) ?
+								 dosimeterEncodingVoltage : dosimeterEncodingCounts);
+			break;
+
+		// indicates that a telecommands are done; ready for file transfers
+		case (telecommand_message_BeginFileTransfer_tag):
+			// do nothing; higher level tasks will handle
+			break;
+
+		// indicates that all downlink activities shall be ceased
+		case (telecommand_message_CeaseTransmission_tag):
+			// do nothing; higher level tasks will handle
+			break;
+
+		// indicates that downlink activities may be resumed
+		case (telecommand_message_ResumeTransmission_tag):
+			// do nothing; higher level tasks will handle
+			break;
+
+		// provides a new accurate time for the OBC to set itself to
+		case (telecommand_message_UpdateTime_tag):
+			if (Time_setUnixEpoch(telecommandMessage->UpdateTime.unixTime) != SUCCESS)
+				return 0;
+			// message headers must not keep using the previous time
+			messageTimeResync();
+			break;
+
+		// instructs OBC to reset certain components on the Satellite
+		case (telecommand_message_Reset_tag):
+			// TODO: implement functionality
+			break;
+
+
+/*
+		// TO ADD: Reset cameras
+		case (?):
+			// TODO: Pass argument (reset option)
+			if (!getCubeSenseUsageState()) {
+				error = requestReset(resetOption);
+				if (error != 0) {
+					printf("Error resetting cameras.\n");
+				}
+			}
+			break;
+
+		// TO ADD: Change both cameras' settings
+		case (?):
+			// TODO: Pass arguments (2x CameraSettings_ConfigurationSettings struct)
+			if (!getCubeSenseUsageState()) {
+				// TODO: To replace with passed arguments
+				CameraSettings_ConfigurationSettings sunSettings = {0};
+				CameraSettings_ConfigurationSettings nadirSettings = {0};
+				error = setCamerasSettings(sunSettings, nadirSettings);
+				if (error != 0) {
+					printf("Error updating cameras settings.\n");
+				}
+			}
+			break;
+
+		// TO ADD: Change automatic image capture interval
+		case (?):
+			// TODO: Pass argument (interval in ms)
+			setImageCaptureInterval(interval);
+			break;
+
+		// TO ADD: Change automatic image download size
+		case (?):
+			// TODO: Pass argument (0, 1, 2, 3 or 4)
+			setImageDownloadSize(downloadSize);
+			break;
+
+		// TO ADD: Change image compression
+		case (?):
+			// TODO: Pass arguments (enabled, largest error of any pixel; 0 for lossless)
+			setImageCompression(compressionEnabled, compressionMaxError);
+			break;
+
+		// TO ADD: Set image as ready for a new capture
+		case (?):
+			setImageReadyForNewCapture();
+			break;
+
+		// TO ADD: Change image transfer frame index
+		case (?):
+			// TODO: Pass argument (frame index)
+			setImageTransferFrameIndex(frameIndex);
+			break;
+
+		// TO ADD: Take manual image
+		case (?):
+			if (!getCubeSenseUsageState()) {
+				error = requestImageCapture(NADIR_SENSOR, SRAM2, BOTTOM_HALVE);
+				if (error != 0) {
+					printf("Failed to manually capture an image...\n");
+				}
+			}
+			break;
+
+		// TO ADD: Manually start the download of an image
+		case (?):
+			// TODO: Pass arguments (image size)
+			if (!getCubeSenseUsageState()) {
+				error = requestImageDownload(SRAM2, imageSize);
+				if (error != 0) {
+					printf("Failed to start the image download...\n");
+				}
+			}
+			break;
+
+		// TO ADD: Update ADCS settings
+		case (?):
+			// TODO: Pass arguments (nb of measurements in a burst, interval between measurements)
+			setADCSBurstSettings(nbMeasurements, interval);
+			break;
+
+		// TO ADD: Reset the adcs readiness flag so it can take another burst of measurements
+		case (?):
+			setADCSReadyForNewBurst();
+			break;
+
+		// TODO: Implement missing camera telecommands
+*/
+
+
+		// unknown telecommand
+		default:
+			// do nothing; return failure
+			return 0;
+	}
+
+	return telecommand;
+}
+
@@ -1,21 +1,30 @@
-/**
- * @file RTelecommandService.h
- * @date February 21, 2022
- * @author Tyrel Kostyk (tck290)
- */
-
-#ifndef RTELECOMMANDSERVICE_H_
-#define RTELECOMMANDSERVICE_H_
-
-#include <RTelecommands.pb.h>
-#include <stdint.h>
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-uint8_t telecommandHandle(uint8_t* wrappedMessage, uint8_t size);
-
-
-#endif /* RTELECOMMANDSERVICE_H_ */
+/**
+ * @file RTelecommandService.h
+ * @date February 21, 2022
+ * @author Tyrel Kostyk (tck290)
+ */
+
+#ifndef RTELECOMMANDSERVICE_H_
+#define RTELECOMMANDSERVICE_H_
+
+#include <RTelecommands.pb.h>
+#include <stdint.h>
+
+
+/***************************************************************************************************
+                                            DEFINITIONS
+***************************************************************************************************/
+
+/** The most telecommands uplinked in a single frame (see telecommand_batch in RTelecommands.proto). */
+#define TELECOMMAND_BATCH_MAX	(pb_arraysize(telecommand_batch, Telecommands))
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+uint8_t telecommandUnwrap(uint8_t* wrappedMessage, uint8_t size, telecommand_batch* telecommands, uint8_t* batched);
+uint8_t telecommandExecute(const telecommand_message* telecommandMessage);
+
+
+#endif /* RTELECOMMANDSERVICE_H_ */
@@ -1,37 +1,45 @@
-/**
- * @file RDosimeter.h
- * @date December 28, 2021
- * @author Tyrel Kostyk (tck290) and Isaac Poirier (iap992)
- */
-
-#ifndef RDOSIMETER_H_
-#define RDOSIMETER_H_
-
-#include <stdint.h>
-#include <RFileTransfer.pb.h>
-
-
-
-/***************************************************************************************************
-                                            DEFINITIONS
-***************************************************************************************************/
-
-/** The two Melanin-Dosimeter boards. */
-typedef enum _dosimeterBoard {
-	dosimeterBoardOne,
-	dosimeterBoardTwo,
-	dosimeterBoardCount,
-} dosimeterBoard_t;
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-int dosimeterData(dosimeter_data* data);
-int dosimeterCollectData(void);
-int16_t dosimeterTemperature(dosimeterBoard_t board);
-void printDosimeterData(dosimeter_data* data);
-
-
-#endif /* RDOSIMETER_H_ */
+/**
+ * @file RDosimeter.h
+ * @date December 28, 2021
+ * @author Tyrel Kostyk (tck290) and Isaac Poirier (iap992)
+ */
+
+#ifndef RDOSIMETER_H_
+#define RDOSIMETER_H_
+
+#include <stdint.h>
+#include <RFileTransfer.pb.h>
+
+
+
+/***************************************************************************************************
+                                            DEFINITIONS
+***************************************************************************************************/
+
+/** The two Melanin-Dosimeter boards. */
+typedef enum _dosimeterBoard {
+	dosimeterBoardOne,
+	dosimeterBoardTwo,
+	dosimeterBoardCount,
+} dosimeterBoard_t;
+
+/** The forms in which Dosimeter readings can be downlinked. */
+typedef enum _dosimeterEncoding {
+	dosimeterEncodingCounts,	///< Raw 12-bit ADC counts, converted on the ground (dosimeter_counts)
+	dosimeterEncodingVoltage,	///< Readings converted on board to mV and Celsius (dosimeter_data)
+} dosimeterEncoding_t;
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+int dosimeterData(dosimeter_data* data);
+int dosimeterCounts(dosimeter_counts* counts);
+void dosimeterSetEncoding(dosimeterEncoding_t encoding);
+int dosimeterCollectData(void);
+int16_t dosimeterTemperature(dosimeterBoard_t board);
+void printDosimeterData(dosimeter_data* data);
+
+
+#endif /* RDOSIMETER_H_ */
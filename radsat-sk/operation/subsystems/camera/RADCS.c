@@ -8,7 +8,6 @@
 #include <RUart.h>
 #include <RADCS.h>
 #include <RCommon.h>
-#include <stdlib.h>
 #include <string.h>
 #include <math.h>
 #include <hal/Timing/Time.h>
@@ -22,6 +21,17 @@
 
 #define TELEMETRY_20_TO_25_LEN			((uint8_t) 10)
 
+/* Telecommands and telemetry requests of the ADCS functions (telemetry per sensor and SRAM) */
+static const camera_telecommand_t captureAndDetectionTelecommand = { TELECOMMAND_20, TELECOMMAND_20_LEN };
+static const camera_telemetry_t sensorResultAndDetectionTelemetry[] = {
+	{ sensor1,       TELEMETRY_20_TO_25_LEN },
+	{ sensor2,       TELEMETRY_20_TO_25_LEN },
+	{ sensor1_sram1, TELEMETRY_20_TO_25_LEN },
+	{ sensor2_sram2, TELEMETRY_20_TO_25_LEN },
+	{ sensor1_sram2, TELEMETRY_20_TO_25_LEN },
+	{ sensor2_sram1, TELEMETRY_20_TO_25_LEN },
+};
+
 
 // TODO: REMOVE. Test purposes only.
 static void printDetectionData(tlm_detection_result_and_trigger_adcs_t *data);
@@ -65,58 +75,17 @@ void printDetectionData(tlm_detection_result_and_trigger_adcs_t *data) {
  * @return error of telecommand attempt. 0 on success, otherwise failure
  * */
 int tcImageCaptureAndDetection(uint8_t camera, uint8_t sram) {
-	uint8_t *telecommandBuffer;
-	uint8_t *telecommandResponse;
-	uint16_t sizeOfBuffer;
-	uint8_t tcErrorFlag;
-	int error;
-
-	// Dynamically allocate a buffer to hold the Telecommand message with header and footer implemented
-	telecommandBuffer = MessageBuilder(TELECOMMAND_20_LEN);
-	sizeOfBuffer = TELECOMMAND_20_LEN + BASE_MESSAGE_LEN;
-
-	// Fill buffer with Telecommand ID
-	telecommandBuffer[MESSAGE_ID_OFFSET] = TELECOMMAND_20;
+	// Build the telecommand (ID, header and footer in place)
+	uint8_t *telecommandBuffer = buildTelecommand(&captureAndDetectionTelecommand);
 
-	// Fill buffer with SRAM
+	// Fill buffer with camera selection
 	telecommandBuffer[TELECOMMAND_OFFSET_0] = camera;
 
-	// Fill buffer with Location in SRAM
+	// Fill buffer with SRAM
 	telecommandBuffer[TELECOMMAND_OFFSET_1] = sram;
 
-    // Send Telemetry Request
-	error = uartTransmit(UART_CAMERA_BUS, telecommandBuffer, sizeOfBuffer); // No escaping needed
-
-	// Free the dynamically allocated buffer
-	free(telecommandBuffer);
-
-	if (error != 0) {
-		return E_GENERIC;
-	}
-
-	// Dynamically allocate a buffer to hold the telecommand message with header and footer implemented
-	telecommandResponse = MessageBuilder(TELECOMMAND_RESPONSE_LEN);
-	sizeOfBuffer = TELECOMMAND_RESPONSE_LEN + BASE_MESSAGE_LEN;
-
-	// Read automatically reply to telecommand
-	error = uartReceive(UART_CAMERA_BUS, telecommandResponse, sizeOfBuffer);
-
-	if (error != 0) {
-		free(telecommandResponse);
-		return E_GENERIC;
-	}
-
-	// Receive the telecommand response from buffer
-	tcErrorFlag = telecommandResponse[TELECOMMAND_RESPONSE_OFFSET];
-
-	// Free the dynamically allocated buffer
-	free(telecommandResponse);
-
-	if (tcErrorFlag != 0) {
-		return E_GENERIC;
-	}
-
-	return SUCCESS;
+    // Send Telecommand, and check its response
+	return sendTelecommand(&captureAndDetectionTelecommand);
 }
 
 /*
@@ -127,39 +96,21 @@ int tcImageCaptureAndDetection(uint8_t camera, uint8_t sram) {
  * @return error of telemetry request attempt. 0 on success, otherwise failure
  * */
 int tlmSensorResultAndDetection(tlm_detection_result_and_trigger_adcs_t *telemetry_reply, SensorResultAndDetection sensorSelection) {
-	uint8_t* telemetryBuffer;
-	uint16_t sizeOfBuffer;
+	const uint8_t *telemetryBuffer;
 	int error;
 
 	// ensure the input pointers are not NULL
 	if (telemetry_reply == 0)
 		return E_GENERIC;
 
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REQUEST_LEN);
-	sizeOfBuffer = TELEMETRY_REQUEST_LEN + BASE_MESSAGE_LEN;
-
-    // Fill buffer with telemetry ID
-	telemetryBuffer[MESSAGE_ID_OFFSET] = sensorSelection;
-
-    // Send Telemetry Request
-	error = uartTransmit(UART_CAMERA_BUS, telemetryBuffer, sizeOfBuffer);
-
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
-
-	if (error != 0) {
+	// Select the telemetry of the sensor and SRAM
+	if (sensorSelection < sensor1 || sensorSelection > sensor2_sram1)
 		return E_GENERIC;
-	}
 
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REPLY_SIZE_6);
-
-    // Reading Automatic reply from CubeSense regarding status of Telemetry request
-	error = receiveAndUnescapeTelemetry(telemetryBuffer, TELEMETRY_20_TO_25_LEN);
+    // Send Telemetry Request, and read its reply
+	error = requestTelemetry(&sensorResultAndDetectionTelemetry[sensorSelection - sensor1], &telemetryBuffer);
 
 	if (error != 0) {
-		free(telemetryBuffer);
 		return E_GENERIC;
 	}
 
@@ -170,9 +121,6 @@ int tlmSensorResultAndDetection(tlm_detection_result_and_trigger_adcs_t *telemet
 	telemetry_reply->detectionResult = telemetryBuffer[TELEMETRY_OFFSET_5];
 	Time_getUnixEpoch((unsigned int *)&(telemetry_reply->timestamp));
 
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
-
 	printDetectionData(telemetry_reply);
 
 	return SUCCESS;
@@ -21,11 +21,20 @@
                                PRIVATE DEFINITIONS AND VARIABLES
 ***************************************************************************************************/
 
-/* Interval in milliseconds before retrying a frame info request (40ms seems to be the lower limit) */
+/* Longest interval in milliseconds before retrying a frame info request; also the first latency estimate */
 #define IMAGE_FRAME_INTERVAL_MS			40
 
-/* Maximum number of requests before timing out (set to 2 seconds) */
-#define IMAGE_FRAME_MAX_RETRY			(2000 / IMAGE_FRAME_INTERVAL_MS)
+/* Shortest interval in milliseconds before retrying a frame info request; doubled on every retry */
+#define IMAGE_FRAME_MIN_INTERVAL_MS		2
+
+/* Time in milliseconds before giving up on a frame that never becomes ready (set to 2 seconds) */
+#define IMAGE_FRAME_TIMEOUT_MS			2000
+
+/* Weight of a new measurement in the learned frame latency (1/N) */
+#define IMAGE_FRAME_LATENCY_WEIGHT		4
+
+/* Fractional bits kept by the learned frame latency, so that it can settle on small latencies */
+#define IMAGE_FRAME_LATENCY_SHIFT		4
 
 /* Telecommand ID numbers and Related Parameters */
 #define TELECOMMAND_0               	((uint8_t) 0x00)
@@ -54,6 +63,25 @@
 #define TELEMETRY_40_LEN				((uint8_t) 18)
 #define TELEMETRY_64_LEN				((uint8_t) 132)
 
+/* Telecommands and telemetry requests of the camera functions (per camera, where they differ) */
+static const camera_telecommand_t resetTelecommand = { TELECOMMAND_0, TELECOMMAND_0_LEN };
+static const camera_telecommand_t detectionThresholdTelecommand[] = {
+	[SUN_SENSOR]   = { TELECOMMAND_40, TELECOMMAND_40_AND_41_LEN },
+	[NADIR_SENSOR] = { TELECOMMAND_41, TELECOMMAND_40_AND_41_LEN },
+};
+static const camera_telecommand_t autoAdjustTelecommand[] = {
+	[SUN_SENSOR]   = { TELECOMMAND_42, TELECOMMAND_42_AND_44_LEN },
+	[NADIR_SENSOR] = { TELECOMMAND_44, TELECOMMAND_42_AND_44_LEN },
+};
+static const camera_telecommand_t cameraSettingsTelecommand[] = {
+	[SUN_SENSOR]   = { TELECOMMAND_43, TELECOMMAND_43_AND_45_LEN },
+	[NADIR_SENSOR] = { TELECOMMAND_45, TELECOMMAND_43_AND_45_LEN },
+};
+static const camera_telemetry_t statusTelemetry = { TELEMETRY_0, TELEMETRY_0_LEN };
+static const camera_telemetry_t powerTelemetry = { TELEMETRY_26, TELEMETRY_26_LEN };
+static const camera_telemetry_t configTelemetry = { TELEMETRY_40, TELEMETRY_40_LEN };
+static const camera_telemetry_t imageFrameTelemetry = { TELEMETRY_64, TELEMETRY_64_LEN };
+
 /* Struct for telmetry status, ID 0*/
 typedef struct _tlm_status_t {
 	uint8_t  nodeType;
@@ -129,6 +157,12 @@ typedef struct _tlm_read_sensor_mask_t {
 	uint16_t MaxYAreaFifth;
 } tlm_read_sensor_mask_t;
 
+/* Learned time for the camera to load a frame once requested (in 1/16 ms); kept from one download to the next */
+static uint32_t frameLatencyEstimate = IMAGE_FRAME_INTERVAL_MS << IMAGE_FRAME_LATENCY_SHIFT;
+
+/* Statistics of the last image download */
+static image_download_stats_t downloadStats = {0};
+
 /***************************************************************************************************
                                        PRIVATE FUNCTION STUBS
 ***************************************************************************************************/
@@ -136,31 +170,30 @@ static int tlmStatus(tlm_status_t *telemetry_reply);
 static int tlmPower(tlm_power_t *telemetry_reply);
 static int tlmConfig(tlm_config_t *telemetry_reply);
 static int tlmImageFrame(tlm_image_frame_t *telemetry_reply);
+static int waitForImageFrame(uint16_t frameNumber, portTickType requestTime);
 static int tcCameraDetectionThreshold(uint8_t camera, uint8_t detectionThreshold);
 static int tcCameraAutoAdjust(uint8_t camera, uint8_t enabler);
 static int tcCameraSettings(uint8_t camera, uint16_t exposureTime, uint8_t AGC, uint8_t blue_gain, uint8_t red_gain);
-static uint16_t getNumberOfFramesFromSize(uint8_t size);
 
 /***************************************************************************************************
                                              PUBLIC API
 ***************************************************************************************************/
 
 /*
- * Memory allocation and initialization of a new image of a given size
+ * Get the number of frames required for a given CubeSense image size
  *
- * @note it is important to free the allocated pointer memory after usage
- * @param size defines the image size used to allocate memory, 0 = 1024x1024, 1 = 512x512, 2 = 256x256, 3 = 128x128, 4 = 64x64
- * @return pointer to a new image in memory
+ * @param size defines the resolution of the image to download, 0 = 1024x1024, 1 = 512x512, 2 = 256x256, 3 = 128x128, 4 = 64x64
+ * @return number of frames corresponding to the desired size
  */
-full_image_t * initializeNewImage(uint8_t size) {
-	uint16_t numberOfFrames = getNumberOfFramesFromSize(size);
-	full_image_t *image = calloc(1, sizeof(*image) + sizeof(tlm_image_frame_t) * numberOfFrames);
-	printf("Image allocated memory size = %i bytes\n", sizeof(*image) + sizeof(tlm_image_frame_t) * numberOfFrames);
-	if (image != NULL) {
-		image->imageSize = size;
-		image->framesCount = numberOfFrames;
+uint16_t getNumberOfFramesFromSize(uint8_t size) {
+	switch(size) {
+		case 0: return 8192; // 1024x1024
+		case 1: return 2048; // 512x512
+		case 2: return 512;  // 256x256
+		case 3: return 128;  // 128x128
+		case 4: return 32; 	 // 64x64
+		default: return 32;
 	}
-	return image;
 }
 
 /*
@@ -220,53 +253,66 @@ int captureImageAndDetect(uint8_t camera, uint8_t sram) {
 /*
  * Used to Download an image from CubeSense Camera
  *
+ * Frames are handed to the sink one at a time, as they arrive, so that only a single frame is
+ * held here at once; the sink decides where the frame goes (i.e. straight into the downlink).
+ *
+ * The camera is asked for the next frame as soon as a frame has been read, so that it loads the
+ * next frame while the sink handles the current one. Whether a frame is ready is then polled
+ * on a schedule learned from the time the camera has been taking to load frames.
+ *
  * @param sram defines which SRAM to use on Cubesense
  * @param location defines which SRAM slot to use within selected SRAM, 0 = top, 1 = bottom
- * @param image defines a pointer to where the entire photo will reside with an image ID
+ * @param size defines the resolution of the image to download, 0 = 1024x1024, 1 = 512x512, 2 = 256x256, 3 = 128x128, 4 = 64x64
+ * @param firstFrame defines the index of the first frame to download (frames before it are skipped)
+ * @param sink defines the function receiving each downloaded frame; the download stops early if it returns non-zero
+ * @param context defines a pointer passed along to the sink
  *
- * @return error, 0 on success, otherwise failure
+ * @return error, 0 on success (including a download stopped by the sink), otherwise failure
  * */
-int downloadImage(uint8_t sram, uint8_t location, full_image_t *image) {
-	int imageFrameNum = 1;
+int downloadImage(uint8_t sram, uint8_t location, uint8_t size, uint16_t firstFrame, image_frame_sink_t sink, void *context) {
 	int error;
-	uint8_t counter = 0;
-	uint8_t isFirstRequest = 1;
-	tlm_image_frame_info_t imageFrameInfo = {0};
+	uint16_t framesCount = getNumberOfFramesFromSize(size);
+	portTickType requestTime;
 	tlm_image_frame_t imageFrame = {0};
 
-	// Verify if image has been initialized
-	if (image == NULL) {
-		return E_GENERIC;
+	// Verify that there is somewhere for the frames to go
+	if (sink == NULL) {
+		return E_INPUT_POINTER_NULL;
+	}
+
+	if (firstFrame >= framesCount) {
+		return E_PARAM_OUTOFBOUNDS;
 	}
 
+	memset(&downloadStats, 0, sizeof(downloadStats));
+	downloadStats.latencyMinMs = UINT16_MAX;
+	portTickType startTime = xTaskGetTickCount();
+
 	printf("\n--- Initializing Image Download (TC 64) of SRAM=%i and location=%i---\n\n", sram, location);
 	// Send telecommand 64 to initialize a download
-	error = tcInitImageDownload(sram, location, image->imageSize);
+	error = tcInitImageDownload(sram, location, size);
 	if (error != SUCCESS) {
 		printf("Error during tcInitImageDownload()...\n");
 		return error;
 	}
+	requestTime = xTaskGetTickCount();
 
-	// Loop for the amount of frames that are being downloaded
-	for (uint16_t i = 0; i < image->framesCount; i++) {
-		printf("\nFRAME NUMBER = %i  |  Attempts:", i);
-		// Request image frame status until image frame is loaded in the camera buffer,
-		// the counter is used to ensure we don't deadlock
-		counter = 0;
-		while((imageFrameNum != i) && (counter < IMAGE_FRAME_MAX_RETRY)) {
-			if (isFirstRequest == 1) {
-				isFirstRequest = 0;
-			} else {
-				vTaskDelay(IMAGE_FRAME_INTERVAL_MS); // Delay in ms between each frame info request
-			}
-			printf(" %i ", counter);
-			error = tlmImageFrameInfo(&imageFrameInfo);
-			if(error != SUCCESS){
-				return error;
-			}
+	// Skip ahead to the first frame requested (i.e. resuming an interrupted download)
+	if (firstFrame > 0) {
+		error = tcAdvanceImageDownload(firstFrame);
+		if (error != SUCCESS) {
+			return error;
+		}
+		requestTime = xTaskGetTickCount();
+	}
 
-			imageFrameNum = imageFrameInfo.imageFrameNumber;
-			counter++;
+	// Loop for the amount of frames that are being downloaded
+	for (uint16_t i = firstFrame; i < framesCount; i++) {
+		// Wait until the image frame is loaded in the camera buffer
+		error = waitForImageFrame(i, requestTime);
+		if (error != SUCCESS) {
+			printf("\nFRAME NUMBER = %i  |  Not ready after %lu polls\n", i, (unsigned long)downloadStats.polls);
+			return error;
 		}
 
 		// Collect Image Frame with TLM 64
@@ -275,26 +321,46 @@ int downloadImage(uint8_t sram, uint8_t location, full_image_t *image) {
 			return error;
 		}
 
-		// Store Image Frame inside master struct
-		image->imageFrames[i] = imageFrame;
-
-		if (i+1 < image->framesCount) {
-			// Quickly pause the task to allow other important tasks to execute if necessary
-			vTaskDelay(1);
-			// Advance Image Download to Continue to the next Frame
+		// Have the camera load the next frame right away, while this one is handed over
+		if (i+1 < framesCount) {
 			error = tcAdvanceImageDownload(i+1);
 			if(error != SUCCESS) {
 				return error;
 			}
+			requestTime = xTaskGetTickCount();
+		}
+
+		downloadStats.frames++;
+
+		// Hand the Image Frame over; stop here if the sink has no room for more
+		if (sink(i, &imageFrame, context) != 0) {
+			break;
 		}
 	}
 
-	// Give the image an ID
-	image->image_ID = sram + (location << 1);
+	downloadStats.durationMs = xTaskGetTickCount() - startTime;
+	printf("\nDownloaded %i frames in %lu ms (%lu polls, frame latency %i ms on average)\n", downloadStats.frames,
+		   (unsigned long)downloadStats.durationMs, (unsigned long)downloadStats.polls,
+		   (downloadStats.frames > 0) ? (int)(downloadStats.latencyTotalMs / downloadStats.frames) : 0);
 
 	return SUCCESS;
 }
 
+/*
+ * Get the statistics of the last image download.
+ *
+ * @param stats a struct that will contain the statistics
+ */
+void getImageDownloadStats(image_download_stats_t *stats) {
+	if (stats == NULL)
+		return;
+
+	*stats = downloadStats;
+	stats->latencyEstimateMs = (uint16_t)(frameLatencyEstimate >> IMAGE_FRAME_LATENCY_SHIFT);
+	if (stats->frames == 0)
+		stats->latencyMinMs = 0;
+}
+
 /*
  * Run the image capture & detection and return the detection status.
  *
@@ -496,24 +562,29 @@ int setSettings(CameraSettings *cameraSettings) {
  * Filtering out unwanted images. Use the images within range of 40 to 240 on the grayscale range
  *
  * @post return 0 if image is in desired range 1 if it is not
- * @param image where the entire photo will reside with an image ID
+ * @param frames the image frames to check
+ * @param framesCount the number of image frames
  * @return 0 on success, otherwise failure
  * */
-int SaturationFilter(full_image_t *image) {
+int SaturationFilter(const tlm_image_frame_t *frames, uint16_t framesCount) {
 	uint16_t sumOfAverages = 0;
 	uint16_t allFrameAverage = 0;
 
-	for (int i = 0; i < image->framesCount; i++) {
+	if (frames == NULL || framesCount == 0) {
+		return E_GENERIC;
+	}
+
+	for (int i = 0; i < framesCount; i++) {
 		int sum = 0;
 		//average of one frame's bytes
 		for	(int j = 0; j < FRAME_BYTES; j++) {
-			sum += image->imageFrames[i].image_bytes[j];
+			sum += frames[i].image_bytes[j];
 		}
 		sumOfAverages += sum/FRAME_BYTES;
 	}
 
 	//average of all the average of all frame bytes
-	allFrameAverage = sumOfAverages/image->framesCount;
+	allFrameAverage = sumOfAverages/framesCount;
 
 	// checking if the overall average is in reasonable range
 	if (allFrameAverage < 40 || allFrameAverage > 240) {
@@ -530,55 +601,14 @@ int SaturationFilter(full_image_t *image) {
  * @return 0 on success, otherwise failure
  */
 int executeReset(uint8_t resetOption) {
-	uint8_t *telecommandBuffer;
-	uint8_t *telecommandResponse;
-	uint16_t sizeOfBuffer;
-	uint8_t tcErrorFlag;
-	int error;
+	// Build the telecommand (ID, header and footer in place)
+	uint8_t *telecommandBuffer = buildTelecommand(&resetTelecommand);
 
-	// Dynamically allocate a buffer to hold the Telecommand message with header and footer implemented
-	telecommandBuffer = MessageBuilder(TELECOMMAND_0_LEN);
-	sizeOfBuffer = TELECOMMAND_0_LEN + BASE_MESSAGE_LEN;
-
-	// Fill buffer with Telecommand ID
-	telecommandBuffer[MESSAGE_ID_OFFSET] = TELECOMMAND_0;
-
-	// Fill buffer with detection threshold
+	// Fill buffer with reset option
 	telecommandBuffer[TELECOMMAND_OFFSET_0] = resetOption;
 
-	// Send telecommand
-	error = uartTransmit(UART_CAMERA_BUS, telecommandBuffer, sizeOfBuffer); // No escaping needed
-
-	// Free the dynamically allocated buffer
-	free(telecommandBuffer);
-
-	if (error != 0) {
-		return E_GENERIC;
-	}
-
-	// Dynamically allocate a buffer to hold the telecommand message with header and footer implemented
-	telecommandResponse = MessageBuilder(TELECOMMAND_RESPONSE_LEN);
-	sizeOfBuffer = TELECOMMAND_RESPONSE_LEN + BASE_MESSAGE_LEN;
-
-	// Read automatically reply to telecommand
-	error = uartReceive(UART_CAMERA_BUS, telecommandResponse, sizeOfBuffer);
-
-	if (error != 0) {
-		free(telecommandResponse);
-		return E_GENERIC;
-	}
-
-	// Receive the telecommand response from buffer
-	tcErrorFlag = telecommandResponse[TELECOMMAND_RESPONSE_OFFSET];
-
-	// Free the dynamically allocated buffer
-	free(telecommandResponse);
-
-	if (tcErrorFlag != 0) {
-		return E_GENERIC;
-	}
-
-	return SUCCESS;
+	// Send telecommand, and check its response
+	return sendTelecommand(&resetTelecommand);
 }
 
 /***************************************************************************************************
@@ -591,41 +621,19 @@ int executeReset(uint8_t resetOption) {
  * @return error of telecommand attempt. 0 on success, otherwise failure
  * */
 static int tlmStatus(tlm_status_t *telemetry_reply) {
-	uint8_t *telemetryBuffer;
-	uint16_t sizeOfBuffer;
+	const uint8_t *telemetryBuffer;
 	int error;
 
 	// ensure the input pointers are not NULL
 	if (telemetry_reply == 0)
 		return E_GENERIC;
 
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REQUEST_LEN);
-	sizeOfBuffer = TELEMETRY_REQUEST_LEN + BASE_MESSAGE_LEN;
-
-    // Fill buffer with telemetry ID
-	telemetryBuffer[MESSAGE_ID_OFFSET] = TELEMETRY_0;
-
-    // Send Telemetry Request
-	error = uartTransmit(UART_CAMERA_BUS, telemetryBuffer, sizeOfBuffer);
-
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
+    // Send Telemetry Request, and read its reply
+	error = requestTelemetry(&statusTelemetry, &telemetryBuffer);
 
 	if (error != 0)
 		return E_GENERIC;
 
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REPLY_SIZE_8);
-
-    // Reading Automatic reply from CubeSense regarding status of Telemetry request
-	error = receiveAndUnescapeTelemetry(telemetryBuffer, TELEMETRY_0_LEN);
-
-	if (error != 0) {
-		free(telemetryBuffer);
-		return E_GENERIC;
-	}
-
 	// Fill telemetry reply, data from uart read starts at index two
 	telemetry_reply->nodeType = telemetryBuffer[TELEMETRY_OFFSET_0];
 	telemetry_reply->interfaceVersion = telemetryBuffer[TELEMETRY_OFFSET_1];
@@ -634,9 +642,6 @@ static int tlmStatus(tlm_status_t *telemetry_reply) {
 	memcpy(&telemetry_reply->runtimeSeconds, &telemetryBuffer[TELEMETRY_OFFSET_4], sizeof(telemetry_reply->runtimeSeconds));
 	memcpy(&telemetry_reply->runtimeMSeconds, &telemetryBuffer[TELEMETRY_OFFSET_6], sizeof(telemetry_reply->runtimeMSeconds));
 
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
-
 	return SUCCESS;
 }
 
@@ -647,41 +652,19 @@ static int tlmStatus(tlm_status_t *telemetry_reply) {
  * @return error of telecommand attempt. 0 on success, otherwise failure
  * */
 static int tlmPower(tlm_power_t *telemetry_reply) {
-	uint8_t* telemetryBuffer;
-	uint16_t sizeOfBuffer;
+	const uint8_t *telemetryBuffer;
 	int error;
 
 	// ensure the input pointers are not NULL
 	if (telemetry_reply == 0)
 		return E_GENERIC;
 
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REQUEST_LEN);
-	sizeOfBuffer = TELEMETRY_REQUEST_LEN + BASE_MESSAGE_LEN;
-
-    // Fill buffer with telemetry ID
-	telemetryBuffer[MESSAGE_ID_OFFSET] = TELEMETRY_26;
-
-    // Send Telemetry Request
-	error = uartTransmit(UART_CAMERA_BUS, telemetryBuffer, sizeOfBuffer);
-
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
+    // Send Telemetry Request, and read its reply
+	error = requestTelemetry(&powerTelemetry, &telemetryBuffer);
 
 	if (error != 0)
 		return error;
 
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REPLY_SIZE_10);
-
-    // Reading Automatic reply from CubeSense regarding status of Telemetry request
-	error = receiveAndUnescapeTelemetry(telemetryBuffer, TELEMETRY_26_LEN);
-
-	if (error != 0){
-		free(telemetryBuffer);
-		return error;
-	}
-
 	// Fill telemetry reply, data from uart read starts at index two
 	memcpy(&telemetry_reply->threeVcurrent, &telemetryBuffer[TELEMETRY_OFFSET_0], sizeof(telemetry_reply->threeVcurrent));
 	memcpy(&telemetry_reply->sramOneCurrent, &telemetryBuffer[TELEMETRY_OFFSET_2], sizeof(telemetry_reply->sramOneCurrent));
@@ -690,9 +673,6 @@ static int tlmPower(tlm_power_t *telemetry_reply) {
 	telemetry_reply->sramOneOverCurrent = telemetryBuffer[TELEMETRY_OFFSET_8];
 	telemetry_reply->sramTwoOverCurrent = telemetryBuffer[TELEMETRY_OFFSET_9];
 
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
-
 	return SUCCESS;
 }
 
@@ -703,43 +683,19 @@ static int tlmPower(tlm_power_t *telemetry_reply) {
  * @return error of telecommand attempt. 0 on success, otherwise failure
  * */
 static int tlmConfig(tlm_config_t *telemetry_reply) {
-	uint8_t* telemetryBuffer;
-	uint16_t sizeOfBuffer;
+	const uint8_t *telemetryBuffer;
 	int error;
 
 	// ensure the input pointers are not NULL
 	if (telemetry_reply == 0)
 		return E_GENERIC;
 
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REQUEST_LEN);
-	sizeOfBuffer = TELEMETRY_REQUEST_LEN + BASE_MESSAGE_LEN;
-
-    // Fill buffer with telemetry ID
-	telemetryBuffer[MESSAGE_ID_OFFSET] = TELEMETRY_40;
-
-    // Send Telemetry Request
-	error = uartTransmit(UART_CAMERA_BUS, telemetryBuffer, sizeOfBuffer);
+    // Send Telemetry Request, and read its reply
+	error = requestTelemetry(&configTelemetry, &telemetryBuffer);
 
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
-
-    // Error Check on uartTransmit
 	if (error != 0)
 		return error;
 
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REPLY_SIZE_14);
-
-    // Reading Automatic reply from CubeSense regarding status of Telemetry request
-	error = receiveAndUnescapeTelemetry(telemetryBuffer, TELEMETRY_40_LEN);
-
-	// Error Check on uartRecieve, if error, free allocated buffer
-	if (error != 0) {
-		free(telemetryBuffer);
-		return error;
-	}
-
 	// Fill telemetry reply, data from uart read starts at index two
 	telemetry_reply->cameraOneDetectionThreshold = telemetryBuffer[TELEMETRY_OFFSET_0];
 	telemetry_reply->cameraTwoDetectionThreshold = telemetryBuffer[TELEMETRY_OFFSET_1];
@@ -754,9 +710,6 @@ static int tlmConfig(tlm_config_t *telemetry_reply) {
 	telemetry_reply->cameraTwoBlueGain = telemetryBuffer[TELEMETRY_OFFSET_12];
 	telemetry_reply->cameraTwoRedGain = telemetryBuffer[TELEMETRY_OFFSET_13];
 
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
-
 	return SUCCESS;
 }
 
@@ -767,50 +720,24 @@ static int tlmConfig(tlm_config_t *telemetry_reply) {
  * @return error of telecommand attempt. 0 on success, otherwise failure
  * */
 int tlmImageFrame(tlm_image_frame_t *telemetry_reply) {
-	uint8_t* telemetryBuffer;
-	uint16_t sizeOfBuffer;
+	const uint8_t *telemetryBuffer;
 	int error;
 
 	// ensure the input pointers are not NULL
 	if (telemetry_reply == 0)
 		return E_GENERIC;
 
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REQUEST_LEN);
-	sizeOfBuffer = TELEMETRY_REQUEST_LEN + BASE_MESSAGE_LEN;
-
-    // Fill buffer with telemetry ID
-	telemetryBuffer[MESSAGE_ID_OFFSET] = TELEMETRY_64;
-
-    // Send Telemetry Request
-	error = uartTransmit(UART_CAMERA_BUS, telemetryBuffer, sizeOfBuffer);
-
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
-
-	if (error != 0) {
-		printf("tlmImageFrame(): Error during uartTransmit()... (error=%d)\n", error);
-		return E_GENERIC;
-	}
-
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REPLY_SIZE_128);
-
-    // Reading Automatic reply from CubeSense regarding status of Telemetry request
-	error = receiveAndUnescapeTelemetry(telemetryBuffer, TELEMETRY_64_LEN);
+    // Send Telemetry Request, and read its reply
+	error = requestTelemetry(&imageFrameTelemetry, &telemetryBuffer);
 
 	if (error != 0) {
-		printf("tlmImageFrame(): Error during receiveAndUnescapeTelemetry()... (error=%d)\n", error);
-		free(telemetryBuffer);
+		printf("tlmImageFrame(): Error during requestTelemetry()... (error=%d)\n", error);
 		return E_GENERIC;
 	}
 
 	// Fill telemetry reply, data from uart read starts at index two
 	memcpy(&telemetry_reply->image_bytes, &telemetryBuffer[TELEMETRY_OFFSET_0], sizeof(telemetry_reply->image_bytes));
 
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
-
 	return SUCCESS;
 }
 
@@ -822,61 +749,18 @@ int tlmImageFrame(tlm_image_frame_t *telemetry_reply) {
  * @return error on telecommand attempt, 0 on success, otherwise failure
  */
 static int tcCameraDetectionThreshold(uint8_t camera, uint8_t detectionThreshold) {
-	uint8_t *telecommandBuffer;
-	uint8_t *telecommandResponse;
-	uint16_t sizeOfBuffer;
-	uint8_t tcErrorFlag;
-	int error;
-
-	// Dynamically allocate a buffer to hold the Telecommand message with header and footer implemented
-	telecommandBuffer = MessageBuilder(TELECOMMAND_40_AND_41_LEN);
-	sizeOfBuffer = TELECOMMAND_40_AND_41_LEN + BASE_MESSAGE_LEN;
-
-	// Fill buffer with Telecommand ID
-	if (camera == SUN_SENSOR) {
-		telecommandBuffer[MESSAGE_ID_OFFSET] = TELECOMMAND_40;
-	} else if (camera == NADIR_SENSOR) {
-		telecommandBuffer[MESSAGE_ID_OFFSET] = TELECOMMAND_41;
-	} else {
+	// Select the telecommand of the camera
+	if (camera != SUN_SENSOR && camera != NADIR_SENSOR)
 		return E_GENERIC;
-	}
+
+	// Build the telecommand (ID, header and footer in place)
+	uint8_t *telecommandBuffer = buildTelecommand(&detectionThresholdTelecommand[camera]);
 
 	// Fill buffer with detection threshold
 	telecommandBuffer[TELECOMMAND_OFFSET_0] = detectionThreshold;
 
-    // Send Telecommand
-	error = escapeAndTransmitTelecommand(telecommandBuffer, sizeOfBuffer);
-
-	// Free the dynamically allocated buffer
-	free(telecommandBuffer);
-
-	if (error != 0) {
-		return E_GENERIC;
-	}
-
-	// Dynamically allocate a buffer to hold the telecommand message with header and footer implemented
-	telecommandResponse = MessageBuilder(TELECOMMAND_RESPONSE_LEN);
-	sizeOfBuffer = TELECOMMAND_RESPONSE_LEN + BASE_MESSAGE_LEN;
-
-	// Read automatically reply to telecommand
-	error = uartReceive(UART_CAMERA_BUS, telecommandResponse, sizeOfBuffer);
-
-	if (error != 0) {
-		free(telecommandResponse);
-		return E_GENERIC;
-	}
-
-	// Receive the telecommand response from buffer
-	tcErrorFlag = telecommandResponse[TELECOMMAND_RESPONSE_OFFSET];
-
-	// Free the dynamically allocated buffer
-	free(telecommandResponse);
-
-	if (tcErrorFlag != 0) {
-		return E_GENERIC;
-	}
-
-	return SUCCESS;
+    // Send Telecommand, and check its response
+	return sendTelecommand(&detectionThresholdTelecommand[camera]);
 }
 
 /*
@@ -887,61 +771,18 @@ static int tcCameraDetectionThreshold(uint8_t camera, uint8_t detectionThreshold
  * @return error of telecommand. 0 on success, otherwise failure
  */
 static int tcCameraAutoAdjust(uint8_t camera, uint8_t enabler) {
-	uint8_t *telecommandBuffer;
-	uint8_t *telecommandResponse;
-	uint16_t sizeOfBuffer;
-	uint8_t tcErrorFlag;
-	int error;
-
-	// Dynamically allocate a buffer to hold the Telecommand message with header and footer implemented
-	telecommandBuffer = MessageBuilder(TELECOMMAND_42_AND_44_LEN);
-	sizeOfBuffer = TELECOMMAND_42_AND_44_LEN + BASE_MESSAGE_LEN;
-
-	// Fill buffer with Telecommand ID
-	if (camera == SUN_SENSOR) {
-		telecommandBuffer[MESSAGE_ID_OFFSET] = TELECOMMAND_42;
-	} else if (camera == NADIR_SENSOR) {
-		telecommandBuffer[MESSAGE_ID_OFFSET] = TELECOMMAND_44;
-	} else {
-		return E_GENERIC;
-	}
-
-	// Fill buffer with detection threshold
-	telecommandBuffer[TELECOMMAND_OFFSET_0] = enabler;
-
-    // Send Telemetry Request
-	error = uartTransmit(UART_CAMERA_BUS, telecommandBuffer, sizeOfBuffer); // No escaping needed
-
-	// Free the dynamically allocated buffer
-	free(telecommandBuffer);
-
-	if (error != 0) {
-		return E_GENERIC;
-	}
-
-	// Dynamically allocate a buffer to hold the telecommand message with header and footer implemented
-	telecommandResponse = MessageBuilder(TELECOMMAND_RESPONSE_LEN);
-	sizeOfBuffer = TELECOMMAND_RESPONSE_LEN + BASE_MESSAGE_LEN;
-
-	// Read automatically reply to telecommand
-	error = uartReceive(UART_CAMERA_BUS, telecommandResponse, sizeOfBuffer);
-
-	if (error != 0) {
-		free(telecommandResponse);
+	// Select the telecommand of the camera
+	if (camera != SUN_SENSOR && camera != NADIR_SENSOR)
 		return E_GENERIC;
-	}
 
-	// Receive the telecommand response from buffer
-	tcErrorFlag = telecommandResponse[TELECOMMAND_RESPONSE_OFFSET];
+	// Build the telecommand (ID, header and footer in place)
+	uint8_t *telecommandBuffer = buildTelecommand(&autoAdjustTelecommand[camera]);
 
-	// Free the dynamically allocated buffer
-	free(telecommandResponse);
-
-	if (tcErrorFlag != 0) {
-		return E_GENERIC;
-	}
+	// Fill buffer with auto-adjust enabler
+	telecommandBuffer[TELECOMMAND_OFFSET_0] = enabler;
 
-	return SUCCESS;
+    // Send Telecommand, and check its response
+	return sendTelecommand(&autoAdjustTelecommand[camera]);
 }
 
 /*
@@ -954,24 +795,12 @@ static int tcCameraAutoAdjust(uint8_t camera, uint8_t enabler) {
  * @param red_gain changes the red gain control register
  */
 static int tcCameraSettings(uint8_t camera, uint16_t exposureTime, uint8_t AGC, uint8_t blue_gain, uint8_t red_gain) {
-	uint8_t *telecommandBuffer;
-	uint8_t *telecommandResponse;
-	uint16_t sizeOfBuffer;
-	uint8_t tcErrorFlag;
-	int error;
-
-	// Dynamically allocate a buffer to hold the Telecommand message with header and footer implemented
-	telecommandBuffer = MessageBuilder(TELECOMMAND_43_AND_45_LEN);
-	sizeOfBuffer = TELECOMMAND_43_AND_45_LEN + BASE_MESSAGE_LEN;
-
-	// Fill buffer with Telecommand ID
-	if (camera == SUN_SENSOR) {
-		telecommandBuffer[MESSAGE_ID_OFFSET] = TELECOMMAND_43;
-	} else if (camera == NADIR_SENSOR) {
-		telecommandBuffer[MESSAGE_ID_OFFSET] = TELECOMMAND_45;
-	} else {
+	// Select the telecommand of the camera
+	if (camera != SUN_SENSOR && camera != NADIR_SENSOR)
 		return E_GENERIC;
-	}
+
+	// Build the telecommand (ID, header and footer in place)
+	uint8_t *telecommandBuffer = buildTelecommand(&cameraSettingsTelecommand[camera]);
 
 	// Fill buffer with exposureTime
 	memcpy(&telecommandBuffer[TELECOMMAND_OFFSET_0], &exposureTime, sizeof(exposureTime));
@@ -985,54 +814,61 @@ static int tcCameraSettings(uint8_t camera, uint16_t exposureTime, uint8_t AGC,
 	// Fill buffer with red gain
 	telecommandBuffer[TELECOMMAND_OFFSET_4] = red_gain;
 
-    // Send Telecommand
-	error = escapeAndTransmitTelecommand(telecommandBuffer, sizeOfBuffer);
-
-	// Free the dynamically allocated buffer
-	free(telecommandBuffer);
-
-	if (error != 0) {
-		return E_GENERIC;
-	}
-
-	// Dynamically allocate a buffer to hold the telecommand message with header and footer implemented
-	telecommandResponse = MessageBuilder(TELECOMMAND_RESPONSE_LEN);
-	sizeOfBuffer = TELECOMMAND_RESPONSE_LEN + BASE_MESSAGE_LEN;
-
-	// Read automatically reply to telecommand
-	error = uartReceive(UART_CAMERA_BUS, telecommandResponse, sizeOfBuffer);
+    // Send Telecommand, and check its response
+	return sendTelecommand(&cameraSettingsTelecommand[camera]);
+}
 
-	if (error != 0) {
-		free(telecommandResponse);
-		return E_GENERIC;
-	}
+/*
+ * Wait for the camera to load the given image frame into its buffer (TLM 65).
+ *
+ * The first poll is made a little before the learned frame latency is up (so that the estimate
+ * can shrink as well as grow), then retried at growing intervals (starting from a fraction of the
+ * latency, so that slow frames are not polled for needlessly), up to IMAGE_FRAME_INTERVAL_MS.
+ *
+ * @param frameNumber defines the frame being waited on
+ * @param requestTime defines the time at which the frame was requested (TC 64 or TC 65)
+ * @return 0 once the frame is ready, otherwise failure (including timing out)
+ */
+static int waitForImageFrame(uint16_t frameNumber, portTickType requestTime) {
+	tlm_image_frame_info_t imageFrameInfo = {0};
+	uint32_t estimateMs = frameLatencyEstimate >> IMAGE_FRAME_LATENCY_SHIFT;
+	portTickType margin = (estimateMs + IMAGE_FRAME_LATENCY_WEIGHT - 1) / IMAGE_FRAME_LATENCY_WEIGHT;
+	portTickType pollTime = requestTime + estimateMs - margin;
+	portTickType interval = (margin / 2 > IMAGE_FRAME_MIN_INTERVAL_MS) ? (margin / 2) : IMAGE_FRAME_MIN_INTERVAL_MS;
+
+	while (1) {
+		portTickType now = xTaskGetTickCount();
+		if ((int32_t)(pollTime - now) > 0)
+			vTaskDelay(pollTime - now);
+
+		// Request image frame status, noting when the request was made
+		portTickType polledAt = xTaskGetTickCount();
+		int error = tlmImageFrameInfo(&imageFrameInfo);
+		downloadStats.polls++;
+		if (error != SUCCESS)
+			return error;
 
-	// Receive the telecommand response from buffer
-	tcErrorFlag = telecommandResponse[TELECOMMAND_RESPONSE_OFFSET];
+		if (imageFrameInfo.imageFrameNumber == frameNumber) {
+			uint16_t latency = (uint16_t)(polledAt - requestTime);
 
-	// Free the dynamically allocated buffer
-	free(telecommandResponse);
+			// Record the latency, and learn from it
+			downloadStats.latencyTotalMs += latency;
+			if (latency < downloadStats.latencyMinMs)
+				downloadStats.latencyMinMs = latency;
+			if (latency > downloadStats.latencyMaxMs)
+				downloadStats.latencyMaxMs = latency;
 
-	if (tcErrorFlag != 0) {
-		return E_GENERIC;
-	}
+			int32_t deviation = ((int32_t)latency << IMAGE_FRAME_LATENCY_SHIFT) - (int32_t)frameLatencyEstimate;
+			int32_t estimate = (int32_t)frameLatencyEstimate + deviation / IMAGE_FRAME_LATENCY_WEIGHT;
+			frameLatencyEstimate = (estimate > 0) ? (uint32_t)estimate : 0;
+			return SUCCESS;
+		}
 
-	return SUCCESS;
-}
+		// Ensure we don't deadlock on a frame that never loads
+		if (xTaskGetTickCount() - requestTime >= IMAGE_FRAME_TIMEOUT_MS)
+			return E_GENERIC;
 
-/*
- * Get the number of frames required for a given CubeSense image size
- *
- * @param size defines the resolution of the image to download, 0 = 1024x1024, 1 = 512x512, 2 = 256x256, 3 = 128x128, 4 = 64x64
- * @return number of frames corresponding to the desired size
- */
-static uint16_t getNumberOfFramesFromSize(uint8_t size) {
-	switch(size) {
-		case 0: return 8192; // 1024x1024
-		case 1: return 2048; // 512x512
-		case 2: return 512;  // 256x256
-		case 3: return 128;  // 128x128
-		case 4: return 32; 	 // 64x64
-		default: return 32;
+		pollTime = xTaskGetTickCount() + interval;
+		interval = (2 * interval < IMAGE_FRAME_INTERVAL_MS) ? (2 * interval) : IMAGE_FRAME_INTERVAL_MS;
 	}
 }
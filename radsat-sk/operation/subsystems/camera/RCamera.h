@@ -63,22 +63,32 @@ typedef struct _tlm_image_frame_t {
 	uint8_t image_bytes[FRAME_BYTES];
 } tlm_image_frame_t;
 
-/* Struct that holds full image with ID */
-typedef struct _full_image_t {
-	uint8_t image_ID;
-	uint8_t imageSize;    // CubeSense's size (0 to 4)
-	uint16_t framesCount;
-	tlm_image_frame_t imageFrames[];
-} full_image_t;
+/* Struct that holds the statistics of the last image download (see downloadImage) */
+typedef struct _image_download_stats_t {
+	uint16_t frames;              // Frames downloaded
+	uint32_t polls;               // Frame info requests (TLM 65) made while waiting for frames to be ready
+	uint16_t latencyMinMs;        // Shortest time from requesting a frame until it was seen ready
+	uint16_t latencyMaxMs;        // Longest time from requesting a frame until it was seen ready
+	uint32_t latencyTotalMs;      // Sum of the frame latencies (average = latencyTotalMs / frames)
+	uint16_t latencyEstimateMs;   // Learned frame latency, used to schedule the first poll of each frame
+	uint32_t durationMs;          // Time taken by the whole download
+} image_download_stats_t;
+
+/*
+ * Receives each image frame as it is downloaded (see downloadImage), in order of frame index.
+ * Returns 0 to carry on with the download, or non-zero to stop it after this frame.
+ */
+typedef int (*image_frame_sink_t)(uint16_t frameIndex, const tlm_image_frame_t *frame, void *context);
 
 /****************************************************************************************************
                                              PUBLIC API
 ***************************************************************************************************/
 
-full_image_t * initializeNewImage(uint8_t size);
+uint16_t getNumberOfFramesFromSize(uint8_t size);
 int captureImage(uint8_t camera, uint8_t sram, uint8_t location);
 int captureImageAndDetect(uint8_t camera, uint8_t sram);
-int downloadImage(uint8_t sram, uint8_t location, full_image_t *image);
+int downloadImage(uint8_t sram, uint8_t location, uint8_t size, uint16_t firstFrame, image_frame_sink_t sink, void *context);
+void getImageDownloadStats(image_download_stats_t *stats);
 int getSingleDetectionStatus(SensorResultAndDetection sensorSelection);
 int getResultsAndTriggerNewDetection(detection_results_t *data);
 int triggerNewDetectionForBothSensors(void);
@@ -7,49 +7,135 @@
 #include <RUart.h>
 //#include <RImage.h>
 #include <RCommon.h>
-#include <stdlib.h>
+#include <stdio.h>
 #include <string.h>
 //#include <freertos/task.h>
 
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/* Size of a telemetry request (telemetry ID, header and footer) */
+#define TELEMETRY_REQUEST_SIZE			((uint8_t) (TELEMETRY_REQUEST_LEN + BASE_MESSAGE_LEN))
+
+/* Size of a telecommand response (error flag, header and footer) */
+#define TELECOMMAND_RESPONSE_SIZE		((uint8_t) (TELECOMMAND_RESPONSE_LEN + BASE_MESSAGE_LEN))
+
+/* Buffers of the camera bus, reused by every message sent or received over it */
+typedef struct _camera_bus_buffers_t {
+	uint8_t telecommand[CAMERA_TELECOMMAND_MAX_LEN + BASE_MESSAGE_LEN];		// Telecommand being built
+	uint8_t transmit[(2 * CAMERA_TELECOMMAND_MAX_LEN) + BASE_MESSAGE_LEN];	// Message being sent (escaped)
+	uint8_t receive[CAMERA_TELEMETRY_MAX_LEN];								// Reply being received (unescaped)
+} camera_bus_buffers_t;
+
+/*
+ * The messages of the camera bus are built and parsed here rather than in buffers allocated for
+ * each one; the CubeSense is used by a single task at a time (see getCubeSenseUsageState), which
+ * waits for each reply before sending its next message.
+ */
+static camera_bus_buffers_t cameraBus = { 0 };
+
 /***************************************************************************************************
                                              PUBLIC API
 ***************************************************************************************************/
 /*
- * Used to dynamically allocated buffer sizes as each telecommand and telemetry
- * require different sizes
+ * Used to start building a telecommand, in the telecommand buffer of the camera bus
+ *
+ * @note the buffer is reused by the next telecommand; send it with sendTelecommand() once filled
+ * @param telecommand describes the telecommand to build
+ * @return the telecommand buffer, with its header, ID and footer in place and its parameters (from
+ *         TELECOMMAND_OFFSET_0 on) cleared; NULL if the telecommand does not fit in the buffer
+ * */
+uint8_t* buildTelecommand(const camera_telecommand_t *telecommand) {
+	uint8_t *buffer = cameraBus.telecommand;
+
+	if (telecommand == 0 || telecommand->length == 0 || telecommand->length > CAMERA_TELECOMMAND_MAX_LEN)
+		return 0;
+
+	uint8_t totalLength = telecommand->length + BASE_MESSAGE_LEN;
+
+	buffer[0] = ESCAPE_CHARACTER;
+	buffer[1] = START_IDENTIFIER;
+	buffer[MESSAGE_ID_OFFSET] = telecommand->id;
+	memset(&buffer[TELECOMMAND_OFFSET_0], FILLER, telecommand->length - 1);
+	buffer[totalLength - 2] = ESCAPE_CHARACTER;
+	buffer[totalLength - 1] = END_IDENTIFIER;
+
+	return buffer;
+}
+
+
+/*
+ * Used to send the telecommand built with buildTelecommand() and read its response
  *
- * @note must use Free() to free the allocated memory when finished using the buffer
- * @param message_size defines how many data bytes are required in the buffer
- * @return dynamically allocated buffer
+ * @param telecommand describes the telecommand to send (as given to buildTelecommand())
+ * @return error of telecommand attempt. 0 on success (and accepted by the CubeSense), otherwise failure
  * */
-uint8_t * MessageBuilder(uint8_t message_size) {
-
-	// Define the total size the buffer should be
-    uint8_t total_buffer_length = message_size + BASE_MESSAGE_LEN;
-
-    // Dynamically Allocate a buffer for telecommand and telemetry
-    uint8_t* buffer = malloc(sizeof(*buffer) * total_buffer_length);
-
-    // Fill buffer with default values
-    for(uint8_t i = 0; i < total_buffer_length; i++) {
-        if (i == 0) {
-        	buffer[i] = ESCAPE_CHARACTER;
-        }
-        else if (i == 1) {
-            buffer[i] = START_IDENTIFIER;
-        }
-        else if (i == total_buffer_length-2) {
-        	buffer[i] = ESCAPE_CHARACTER;
-        }
-        else if (i == total_buffer_length-1) {
-        	buffer[i] = END_IDENTIFIER;
-        }
-        else {
-        	buffer[i] = FILLER;
-        }
-    }
-
-    return buffer;
+int sendTelecommand(const camera_telecommand_t *telecommand) {
+	int error;
+
+	if (telecommand == 0)
+		return E_INPUT_POINTER_NULL;
+
+	if (telecommand->length == 0 || telecommand->length > CAMERA_TELECOMMAND_MAX_LEN)
+		return E_PARAM_OUTOFBOUNDS;
+
+	// Send the telecommand
+	error = escapeAndTransmitTelecommand(cameraBus.telecommand, telecommand->length + BASE_MESSAGE_LEN);
+	if (error != 0)
+		return E_GENERIC;
+
+	// Read automatically reply to telecommand
+	error = uartReceive(UART_CAMERA_BUS, cameraBus.receive, TELECOMMAND_RESPONSE_SIZE);
+	if (error != 0)
+		return E_GENERIC;
+
+	// Check the error flag of the telecommand response
+	if (cameraBus.receive[TELECOMMAND_RESPONSE_OFFSET] != 0)
+		return E_GENERIC;
+
+	return SUCCESS;
+}
+
+
+/*
+ * Used to request telemetry and receive its reply, in the receive buffer of the camera bus
+ *
+ * @note the reply is overwritten by the next message on the bus
+ * @param telemetry describes the telemetry to request
+ * @param reply set to the unescaped reply; its data bytes start at TELEMETRY_OFFSET_0
+ * @return error of telemetry request. 0 on success, otherwise failure
+ * */
+int requestTelemetry(const camera_telemetry_t *telemetry, const uint8_t **reply) {
+	uint8_t *request = cameraBus.transmit;
+	int error;
+
+	// ensure the input pointers are not NULL
+	if (telemetry == 0 || reply == 0)
+		return E_INPUT_POINTER_NULL;
+
+	if (telemetry->length < BASE_MESSAGE_LEN || telemetry->length > CAMERA_TELEMETRY_MAX_LEN)
+		return E_PARAM_OUTOFBOUNDS;
+
+	// Build the telemetry request
+	request[0] = ESCAPE_CHARACTER;
+	request[1] = START_IDENTIFIER;
+	request[MESSAGE_ID_OFFSET] = telemetry->id;
+	request[TELEMETRY_REQUEST_SIZE - 2] = ESCAPE_CHARACTER;
+	request[TELEMETRY_REQUEST_SIZE - 1] = END_IDENTIFIER;
+
+	// Send Telemetry Request
+	error = uartTransmit(UART_CAMERA_BUS, request, TELEMETRY_REQUEST_SIZE);
+	if (error != 0)
+		return error;
+
+	// Reading Automatic reply from CubeSense regarding status of Telemetry request
+	error = receiveAndUnescapeTelemetry(cameraBus.receive, telemetry->length);
+	if (error != 0)
+		return error;
+
+	*reply = cameraBus.receive;
+	return SUCCESS;
 }
 
 
@@ -57,83 +143,120 @@ uint8_t * MessageBuilder(uint8_t message_size) {
  * Used to escape and transmit UART telecommand messages
  *
  * @param telecommandBuffer is a pointer to a telecommand buffer to escape and transmit
- * @param messageSize defines how many data bytes are required in the buffer
+ * @param messageSize defines the size of the telecommand (with header and footer)
  * @return error of telecommand attempt. 0 on success, otherwise failure
  */
 int escapeAndTransmitTelecommand(uint8_t *telecommandBuffer, uint8_t messageSize) {
-	uint8_t *escapedBuffer;
-	uint8_t escapeBufferIndex;
-	uint8_t escapeCharacterCount = 0;
-	uint8_t newMessageSize;
-	int error;
+	uint8_t *escapedBuffer = cameraBus.transmit;
+	uint8_t escapedSize = 0;
 
-	// Count the number of characters that should be escaped in the data bytes
-	for(uint8_t i = TELECOMMAND_OFFSET_0; i < messageSize - 2; i++) {
-		if (telecommandBuffer[i] == ESCAPE_CHARACTER) {
-			escapeCharacterCount++;
-		}
-	}
+	// ensure the input pointer is not NULL
+	if (telecommandBuffer == 0)
+		return E_INPUT_POINTER_NULL;
 
-	// If no escaping is needed, send the telecommand as is and let function caller free the buffer
-	if (escapeCharacterCount == 0) {
-		return uartTransmit(UART_CAMERA_BUS, telecommandBuffer, messageSize);
-	}
-
-	// Calculate the new buffer size
-	newMessageSize = messageSize + escapeCharacterCount;
-
-	// Build a new telecommand buffer
-	escapedBuffer = MessageBuilder(newMessageSize - BASE_MESSAGE_LEN);
+	if (messageSize <= BASE_MESSAGE_LEN || messageSize > CAMERA_TELECOMMAND_MAX_LEN + BASE_MESSAGE_LEN)
+		return E_PARAM_OUTOFBOUNDS;
 
-	// Fill the new buffer adding escape characters
-	escapeBufferIndex = MESSAGE_ID_OFFSET;
-	for(uint8_t i = MESSAGE_ID_OFFSET; i < messageSize - 2; i++, escapeBufferIndex++) {
-		escapedBuffer[escapeBufferIndex] = telecommandBuffer[i];
-		if (telecommandBuffer[i] == ESCAPE_CHARACTER) {
-			// Add an extra escape character
-			escapeBufferIndex++;
-			escapedBuffer[escapeBufferIndex] = telecommandBuffer[i];
-		}
+	// Copy the telecommand into the transmit buffer, doubling any escape character between the header and footer
+	escapedBuffer[escapedSize++] = ESCAPE_CHARACTER;
+	escapedBuffer[escapedSize++] = START_IDENTIFIER;
+	for (uint8_t i = MESSAGE_ID_OFFSET; i < messageSize - 2; i++) {
+		escapedBuffer[escapedSize++] = telecommandBuffer[i];
+		if (telecommandBuffer[i] == ESCAPE_CHARACTER)
+			escapedBuffer[escapedSize++] = ESCAPE_CHARACTER;
 	}
+	escapedBuffer[escapedSize++] = ESCAPE_CHARACTER;
+	escapedBuffer[escapedSize++] = END_IDENTIFIER;
 
 	// Send the escaped telecommand buffer
-	error = uartTransmit(UART_CAMERA_BUS, escapedBuffer, newMessageSize);
-
-	// Free the new escaped buffer
-	free(escapedBuffer);
-
-	return error;
+	return uartTransmit(UART_CAMERA_BUS, escapedBuffer, escapedSize);
 }
 
 
 /*
  * Used to receive and unescape UART telemetry messages
  *
+ * The reply is read in chunks of the bytes still missing from it, each unescaped in place as it
+ * arrives (see unescapeTelemetry). A chunk never reaches past the end of the reply, as every byte
+ * of the unescaped reply takes at least one byte on the bus; a reply holding n escape characters
+ * takes at most about log2(n) more reads.
+ *
  * @param telemetryBuffer is a pointer to a telemetry buffer where data will be stored
- * @param messageSize defines how many data bytes are required in the buffer
+ * @param messageSize defines the size of the unescaped message (with header and footer)
  * @return error of telecommand attempt. 0 on success, otherwise failure
  */
 int receiveAndUnescapeTelemetry(uint8_t *telemetryBuffer, uint8_t messageSize) {
-	// Receive the message via UART
-	int error = uartReceive(UART_CAMERA_BUS, telemetryBuffer, messageSize);
-	if (error != 0) {
-		printf("receiveAndUnescapeTelemetry(): Error during first uartReceive()... (error=%d)\n", error);
-		return E_GENERIC;
+	uint8_t received = 0;
+	uint8_t escaped = 0;
+
+	// ensure the input pointer is not NULL
+	if (telemetryBuffer == 0)
+		return E_INPUT_POINTER_NULL;
+
+	while (received < messageSize) {
+		uint8_t chunkSize = messageSize - received;
+
+		// Receive at most the rest of the message via UART
+		int error = uartReceive(UART_CAMERA_BUS, &telemetryBuffer[received], chunkSize);
+		if (error != 0) {
+			printf("receiveAndUnescapeTelemetry(): Error during uartReceive()... (error=%d)\n", error);
+			return E_GENERIC;
+		}
+
+		// Remove the duplicated escape characters it holds
+		received += unescapeTelemetry(&telemetryBuffer[received], chunkSize, &escaped);
 	}
 
-	// Check for escaped characters in the data bytes
-	for(uint8_t i = TELEMETRY_OFFSET_0; i < messageSize - 2; i++) {
-		if (telemetryBuffer[i] == ESCAPE_CHARACTER) {
-			// Left shift array to remove the duplicated escape character
-			memmove(&telemetryBuffer[i+1], &telemetryBuffer[i+2], (messageSize-i-1)*sizeof(uint8_t));
-			// Read one more byte from UART and store at the end of the buffer
-			error = uartReceive(UART_CAMERA_BUS, &telemetryBuffer[messageSize-1], 1);
-			if (error != 0) {
-				printf("receiveAndUnescapeTelemetry(): Error during second uartReceive()... (error=%d)\n", error);
-				return E_GENERIC;
+	return SUCCESS;
+}
+
+
+/*
+ * Used to unescape received telemetry in place, one chunk of it at a time
+ *
+ * An escape character is kept, and the one doubling it (if any) is dropped; the header and footer
+ * (an escape character followed by their identifier) pass through as they are.
+ *
+ * @param data defines the received bytes; unescaped in place
+ * @param size defines the number of received bytes
+ * @param escaped whether the last byte kept was an escape character not yet followed by another
+ *        byte; 0 at the start of a message, carried from one chunk to the next
+ * @return the number of unescaped bytes, from the start of the data
+ */
+uint8_t unescapeTelemetry(uint8_t *data, uint8_t size, uint8_t *escaped) {
+	uint8_t pending = *escaped;
+	uint8_t kept = 0;
+	uint8_t i = 0;
+
+	while (i < size) {
+		// Drop the second escape character of a pair
+		if (pending) {
+			pending = 0;
+			if (data[i] == ESCAPE_CHARACTER) {
+				i++;
+				continue;
 			}
 		}
+
+		// Keep an escape character right away (i.e. in runs of escaped bytes)
+		if (data[i] == ESCAPE_CHARACTER) {
+			data[kept++] = ESCAPE_CHARACTER;
+			i++;
+			pending = 1;
+			continue;
+		}
+
+		// Keep the bytes up to (and including) the next escape character, moving them down over those dropped
+		const uint8_t *escape = memchr(&data[i], ESCAPE_CHARACTER, size - i);
+		uint8_t run = (escape != 0) ? (uint8_t)(escape - &data[i] + 1) : (uint8_t)(size - i);
+		if (kept != i)
+			memmove(&data[kept], &data[i], run);
+
+		kept += run;
+		i += run;
+		pending = (escape != 0);
 	}
 
-	return SUCCESS;
+	*escaped = pending;
+	return kept;
 }
@@ -51,6 +51,12 @@
 #define FILLER							((uint16_t) 0x00)
 #define END_IDENTIFIER                  ((uint16_t) 0xFF)
 
+/* Largest telecommand sent to the CubeSense (ID and parameters; TC 43 and 45) */
+#define CAMERA_TELECOMMAND_MAX_LEN		((uint8_t) 6)
+
+/* Largest telemetry reply received from the CubeSense (data bytes, header and footer; TLM 64) */
+#define CAMERA_TELEMETRY_MAX_LEN		((uint16_t) (TELEMETRY_REPLY_SIZE_128 + BASE_MESSAGE_LEN))
+
 #define SUN_SENSOR	         	        ((uint8_t) 0)
 #define NADIR_SENSOR	                ((uint8_t) 1)
 #define SRAM1                           ((uint8_t) 0)
@@ -68,6 +74,18 @@ typedef enum _SensorResultAndDetection {
 	sensor2_sram1  = 0x99  // TLM 25
 } SensorResultAndDetection;
 
+/* Describes a telecommand sent to the CubeSense */
+typedef struct _camera_telecommand_t {
+	uint8_t id;		// Telecommand ID
+	uint8_t length;	// Length of the telecommand (ID and parameters, without header and footer)
+} camera_telecommand_t;
+
+/* Describes a telemetry request sent to the CubeSense */
+typedef struct _camera_telemetry_t {
+	uint8_t id;		// Telemetry ID
+	uint8_t length;	// Length of the reply (data bytes, header and footer)
+} camera_telemetry_t;
+
 /* Struct to define 3D vector */
 typedef struct _interpret_detection_result_t {
 	float X_AXIS;
@@ -78,8 +96,11 @@ typedef struct _interpret_detection_result_t {
 /****************************************************************************************************
                                              PUBLIC API
 ***************************************************************************************************/
-uint8_t* MessageBuilder(uint8_t response_size);
+uint8_t* buildTelecommand(const camera_telecommand_t *telecommand);
+int sendTelecommand(const camera_telecommand_t *telecommand);
+int requestTelemetry(const camera_telemetry_t *telemetry, const uint8_t **reply);
 int escapeAndTransmitTelecommand(uint8_t *telecommandBuffer, uint8_t messageSize);
 int receiveAndUnescapeTelemetry(uint8_t *telemetryBuffer, uint8_t messageSize);
+uint8_t unescapeTelemetry(uint8_t *data, uint8_t size, uint8_t *escaped);
 
 #endif /* RCAMERACOMMON_H_ */
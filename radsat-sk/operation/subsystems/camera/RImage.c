@@ -8,7 +8,6 @@
 #include <RUart.h>
 #include <RImage.h>
 #include <RCommon.h>
-#include <stdlib.h>
 #include <string.h>
 #include <freertos/task.h>
 
@@ -35,6 +34,17 @@
 
 #define SIZE_OF_BITMAP					((uint8_t) 4096)
 
+/* Telecommands and telemetry requests of the image functions */
+static const camera_telecommand_t imageCaptureTelecommand = { TELECOMMAND_21, TELECOMMAND_21_LEN };
+static const camera_telecommand_t initImageDownloadTelecommand = { TELECOMMAND_64, TELECOMMAND_64_LEN };
+static const camera_telecommand_t advanceImageDownloadTelecommand = { TELECOMMAND_65, TELECOMMAND_65_LEN };
+static const camera_telemetry_t telecommandAcknowledgeTelemetry = { TELEMETRY_3, TELEMETRY_3_LEN };
+static const camera_telemetry_t imageFrameInfoTelemetry = { TELEMETRY_65, TELEMETRY_65_LEN };
+static const camera_telemetry_t sensorResultTelemetry[] = {
+	[SUN_SENSOR]   = { TELEMETRY_20, TELEMETRY_20_AND_21_LEN },
+	[NADIR_SENSOR] = { TELEMETRY_21, TELEMETRY_20_AND_21_LEN },
+};
+
 /***************************************************************************************************
                                              PUBLIC API
 ***************************************************************************************************/
@@ -47,18 +57,8 @@
  * @return error of telecommand attempt. 0 on success, otherwise failure
  * */
 int tcImageCapture(uint8_t camera, uint8_t SRAM, uint8_t location) {
-	uint8_t *telecommandBuffer;
-	uint8_t *telecommandResponse;
-	uint16_t sizeOfBuffer;
-	uint8_t  tcErrorFlag;
-	int error;
-
-	// Dynamically allocate a buffer to hold the Telecommand message with header and footer implemented
-	telecommandBuffer = MessageBuilder(TELECOMMAND_21_LEN);
-	sizeOfBuffer = TELECOMMAND_21_LEN + BASE_MESSAGE_LEN;
-
-	// Fill buffer with Telecommand ID
-	telecommandBuffer[MESSAGE_ID_OFFSET] = TELECOMMAND_21;
+	// Build the telecommand (ID, header and footer in place)
+	uint8_t *telecommandBuffer = buildTelecommand(&imageCaptureTelecommand);
 
     // Fill buffer with Camera selection
 	telecommandBuffer[TELECOMMAND_OFFSET_0] = camera;
@@ -69,39 +69,8 @@ int tcImageCapture(uint8_t camera, uint8_t SRAM, uint8_t location) {
 	// Fill buffer with Location in SRAM
 	telecommandBuffer[TELECOMMAND_OFFSET_2] = location;
 
-    // Send Telemetry Request
-	error = uartTransmit(UART_CAMERA_BUS, telecommandBuffer, sizeOfBuffer); // No escaping needed
-
-	// Free the dynamically allocated buffer
-	free(telecommandBuffer);
-
-	if (error != 0) {
-		return E_GENERIC;
-	}
-
-	// Dynamically allocate a buffer to hold the telecommand message with header and footer implemented
-	telecommandResponse = MessageBuilder(TELECOMMAND_RESPONSE_LEN);
-	sizeOfBuffer = TELECOMMAND_RESPONSE_LEN + BASE_MESSAGE_LEN;
-
-	// Read automatically reply to telecommand
-	error = uartReceive(UART_CAMERA_BUS, telecommandResponse, sizeOfBuffer);
-
-	if (error != 0) {
-		free(telecommandResponse);
-		return E_GENERIC;
-	}
-
-	// Receive the telecommand response from buffer
-	tcErrorFlag = telecommandResponse[TELECOMMAND_RESPONSE_OFFSET];
-
-	// Free the dynamically allocated buffer
-	free(telecommandResponse);
-
-	if (tcErrorFlag != 0) {
-		return E_GENERIC;
-	}
-
-	return SUCCESS;
+    // Send Telecommand, and check its response
+	return sendTelecommand(&imageCaptureTelecommand);
 }
 
 /*
@@ -112,45 +81,21 @@ int tcImageCapture(uint8_t camera, uint8_t SRAM, uint8_t location) {
  * @return error of telecommand attempt. 0 on success, otherwise failure
  * */
 int tlmSensorResult(uint8_t camera, tlm_detection_result_and_trigger_t *telemetry_reply) {
-	uint8_t* telemetryBuffer;
-	uint16_t sizeOfBuffer;
+	const uint8_t *telemetryBuffer;
 	int error;
 
 	// ensure the input pointers are not NULL
 	if (telemetry_reply == 0)
 		return E_GENERIC;
 
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REQUEST_LEN);
-	sizeOfBuffer = TELEMETRY_REQUEST_LEN + BASE_MESSAGE_LEN;
-
-    // Fill buffer with telemetry ID
-	if (camera == SUN_SENSOR) {
-		telemetryBuffer[MESSAGE_ID_OFFSET] = TELEMETRY_20;
-	} else if (camera == NADIR_SENSOR) {
-		telemetryBuffer[MESSAGE_ID_OFFSET] = TELEMETRY_21;
-	} else {
+	// Select the telemetry of the camera
+	if (camera != SUN_SENSOR && camera != NADIR_SENSOR)
 		return E_GENERIC;
-	}
 
-    // Send Telemetry Request
-	error = uartTransmit(UART_CAMERA_BUS, telemetryBuffer, sizeOfBuffer);
-
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
-
-	if (error != 0) {
-		return E_GENERIC;
-	}
-
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REPLY_SIZE_6);
-
-    // Reading Automatic reply from CubeSense regarding status of Telemetry request
-	error = receiveAndUnescapeTelemetry(telemetryBuffer, TELEMETRY_20_AND_21_LEN);
+    // Send Telemetry Request, and read its reply
+	error = requestTelemetry(&sensorResultTelemetry[camera], &telemetryBuffer);
 
 	if (error != 0) {
-		free(telemetryBuffer);
 		return E_GENERIC;
 	}
 
@@ -160,9 +105,6 @@ int tlmSensorResult(uint8_t camera, tlm_detection_result_and_trigger_t *telemetr
 	telemetry_reply->captureResult = telemetryBuffer[TELEMETRY_OFFSET_4];
 	telemetry_reply->detectionResult = telemetryBuffer[TELEMETRY_OFFSET_5];
 
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
-
 	return SUCCESS;
 }
 
@@ -175,60 +117,23 @@ int tlmSensorResult(uint8_t camera, tlm_detection_result_and_trigger_t *telemetr
  * @return error of telecommand attempt. 0 on success, otherwise failure
  * */
 int tcInitImageDownload(uint8_t SRAM, uint8_t location, uint8_t size) {
-	uint8_t *telecommandBuffer;
-	uint8_t *telecommandResponse;
-	uint16_t sizeOfBuffer;
-	uint8_t tcErrorFlag;
-	int error;
+	// Build the telecommand (ID, header and footer in place)
+	uint8_t *telecommandBuffer = buildTelecommand(&initImageDownloadTelecommand);
 
-	// Dynamically allocate a buffer to hold the Telecommand message with header and footer implemented
-	telecommandBuffer = MessageBuilder(TELECOMMAND_64_LEN);
-	sizeOfBuffer = TELECOMMAND_64_LEN + BASE_MESSAGE_LEN;
-
-	// Fill buffer with Telecommand ID
-	telecommandBuffer[MESSAGE_ID_OFFSET] = TELECOMMAND_64;
-
-    // Fill buffer with Camera selection
+    // Fill buffer with SRAM
 	telecommandBuffer[TELECOMMAND_OFFSET_0] = SRAM;
 
-	// Fill buffer with SRAM
+	// Fill buffer with Location in SRAM
 	telecommandBuffer[TELECOMMAND_OFFSET_1] = location;
 
-	// Fill buffer with Location in SRAM
+	// Fill buffer with image size
 	telecommandBuffer[TELECOMMAND_OFFSET_2] = size;
 
-    // Send Telemetry Request
-	error = uartTransmit(UART_CAMERA_BUS, telecommandBuffer, sizeOfBuffer); // No escaping needed
-
-	// Free the dynamically allocated buffer
-	free(telecommandBuffer);
+    // Send Telecommand, and check its response
+	int error = sendTelecommand(&initImageDownloadTelecommand);
 
 	if (error != 0) {
-		printf("tcInitImageDownload(): Error during uartTransmit()...\n");
-		return E_GENERIC;
-	}
-
-	// Dynamically allocate a buffer to hold the telecommand message with header and footer implemented
-	telecommandResponse = MessageBuilder(TELECOMMAND_RESPONSE_LEN);
-	sizeOfBuffer = TELECOMMAND_RESPONSE_LEN + BASE_MESSAGE_LEN;
-
-	// Read automatically reply to telecommand
-	error = uartReceive(UART_CAMERA_BUS, telecommandResponse, sizeOfBuffer);
-
-	if (error != 0) {
-		printf("tcInitImageDownload(): Error during uartReceive()...");
-		free(telecommandResponse);
-		return E_GENERIC;
-	}
-
-	// Receive the telecommand response from buffer
-	tcErrorFlag = telecommandResponse[TELECOMMAND_RESPONSE_OFFSET];
-
-	// Free the dynamically allocated buffer
-	free(telecommandResponse);
-
-	if (tcErrorFlag != 0) {
-		printf("tcInitImageDownload(): Bad tcErrorFlag...\n");
+		printf("tcInitImageDownload(): Error during sendTelecommand()... (error=%d)\n", error);
 		return E_GENERIC;
 	}
 
@@ -242,41 +147,18 @@ int tcInitImageDownload(uint8_t SRAM, uint8_t location, uint8_t size) {
  * @return error of telecommand attempt. 0 on success, otherwise failure
  * */
 int tlmImageFrameInfo(tlm_image_frame_info_t *telemetry_reply) {
-	uint8_t* telemetryBuffer;
-	uint16_t sizeOfBuffer;
+	const uint8_t *telemetryBuffer;
 	int error;
 
 	// ensure the input pointers are not NULL
 	if (telemetry_reply == 0)
 		return E_GENERIC;
 
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REQUEST_LEN);
-	sizeOfBuffer = TELEMETRY_REQUEST_LEN + BASE_MESSAGE_LEN;
-
-    // Fill buffer with telemetry ID
-	telemetryBuffer[MESSAGE_ID_OFFSET] = TELEMETRY_65;
-
-    // Send Telemetry Request
-	error = uartTransmit(UART_CAMERA_BUS, telemetryBuffer, sizeOfBuffer);
-
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
+    // Send Telemetry Request, and read its reply
+	error = requestTelemetry(&imageFrameInfoTelemetry, &telemetryBuffer);
 
 	if (error != 0) {
-		printf("tlmImageFrameInfo(): Error during uartTransmit()... (error=%d)\n", error);
-		return E_GENERIC;
-	}
-
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REPLY_SIZE_3);
-
-    // Reading Automatic reply from CubeSense regarding status of Telemetry request
-	error = receiveAndUnescapeTelemetry(telemetryBuffer, TELEMETRY_65_LEN);
-
-	if (error != 0) {
-		printf("tlmImageFrameInfo(): Error during receiveAndUnescapeTelemetry()... (error=%d)\n", error);
-		free(telemetryBuffer);
+		printf("tlmImageFrameInfo(): Error during requestTelemetry()... (error=%d)\n", error);
 		return E_GENERIC;
 	}
 
@@ -284,9 +166,6 @@ int tlmImageFrameInfo(tlm_image_frame_info_t *telemetry_reply) {
 	memcpy(&telemetry_reply->imageFrameNumber, &telemetryBuffer[TELEMETRY_OFFSET_0], sizeof(telemetry_reply->imageFrameNumber));
 	telemetry_reply->checksum = telemetryBuffer[TELEMETRY_OFFSET_2];
 
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
-
 	return SUCCESS;
 }
 
@@ -297,55 +176,14 @@ int tlmImageFrameInfo(tlm_image_frame_info_t *telemetry_reply) {
  * @return error of telecommand attempt. 0 on success, otherwise failure
  * */
 int tcAdvanceImageDownload(uint16_t nextFrameNumber) {
-	uint8_t *telecommandBuffer;
-	uint8_t *telecommandResponse;
-	uint16_t sizeOfBuffer;
-	uint8_t  tcErrorFlag;
-	int error;
-
-	// Dynamically allocate a buffer to hold the Telecommand message with header and footer implemented
-	telecommandBuffer = MessageBuilder(TELECOMMAND_65_LEN);
-	sizeOfBuffer = TELECOMMAND_65_LEN + BASE_MESSAGE_LEN;
-
-	// Fill buffer with Telecommand ID
-	telecommandBuffer[MESSAGE_ID_OFFSET] = TELECOMMAND_65;
+	// Build the telecommand (ID, header and footer in place)
+	uint8_t *telecommandBuffer = buildTelecommand(&advanceImageDownloadTelecommand);
 
 	// Fill buffer with Next frame number
 	memcpy(&telecommandBuffer[TELECOMMAND_OFFSET_0], &nextFrameNumber, sizeof(nextFrameNumber));
 
-    // Send Telecommand
-	error = escapeAndTransmitTelecommand(telecommandBuffer, sizeOfBuffer);
-
-	// Free the dynamically allocated buffer
-	free(telecommandBuffer);
-
-	if (error != 0) {
-		return E_GENERIC;
-	}
-
-	// Dynamically allocate a buffer to hold the telecommand message with header and footer implemented
-	telecommandResponse = MessageBuilder(TELECOMMAND_RESPONSE_LEN);
-	sizeOfBuffer = TELECOMMAND_RESPONSE_LEN + BASE_MESSAGE_LEN;
-
-	// Read automatically reply to telecommand
-	error = uartReceive(UART_CAMERA_BUS, telecommandResponse, sizeOfBuffer);
-
-	if (error != 0) {
-		free(telecommandResponse);
-		return E_GENERIC;
-	}
-
-	// Receive the telecommand response from buffer
-	tcErrorFlag = telecommandResponse[TELECOMMAND_RESPONSE_OFFSET];
-
-	// Free the dynamically allocated buffer
-	free(telecommandResponse);
-
-	if (tcErrorFlag != 0) {
-		return E_GENERIC;
-	}
-
-	return SUCCESS;
+    // Send Telecommand, and check its response
+	return sendTelecommand(&advanceImageDownloadTelecommand);
 }
 
 /*
@@ -355,49 +193,23 @@ int tcAdvanceImageDownload(uint16_t nextFrameNumber) {
  * @return error of telecommand attempt. 0 on success, otherwise failure
  * */
 int tlmTelecommandAcknowledge(tlm_telecommand_ack_t *telemetry_reply) {
-	uint8_t* telemetryBuffer;
-	uint16_t sizeOfBuffer;
+	const uint8_t *telemetryBuffer;
 	int error;
 
 	//  Ensure the input pointers are not NULL
 	if (telemetry_reply == 0)
 		return E_GENERIC;
 
-    // Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-    telemetryBuffer = MessageBuilder(TELEMETRY_REQUEST_LEN);
-    sizeOfBuffer = TELEMETRY_REQUEST_LEN + BASE_MESSAGE_LEN;
-
-    // Fill buffer with telemetry ID
-	telemetryBuffer[MESSAGE_ID_OFFSET] = TELEMETRY_3;
-
-    // Send Telemetry Request
-	error = uartTransmit(UART_CAMERA_BUS, telemetryBuffer, sizeOfBuffer);
-
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
+    // Send Telemetry Request, and read its reply
+	error = requestTelemetry(&telecommandAcknowledgeTelemetry, &telemetryBuffer);
 
 	if (error != 0) {
 		return E_GENERIC;
 	}
 
-	// Dynamically allocate a buffer to hold the telemetry message with header and footer implemented
-	telemetryBuffer = MessageBuilder(TELEMETRY_REPLY_SIZE_3);
-
-    // Reading Automatic reply from CubeSense regarding status of Telemetry request
-	error = uartReceive(UART_CAMERA_BUS, telemetryBuffer, TELEMETRY_3_LEN); // No unescaping needed
-
-	if (error != 0) {
-		free(telemetryBuffer);
-		return E_GENERIC;
-	}
-
 	// Fill telemetry reply, data from uart read starts at index two
 	memcpy(&telemetry_reply->tc_error_flag, &telemetryBuffer[TELEMETRY_OFFSET_2], sizeof(telemetry_reply->tc_error_flag));
 
-
-	// Free the dynamically allocated buffer
-	free(telemetryBuffer);
-
 	return SUCCESS;
 }
 
@@ -25,6 +25,7 @@
 #include <RUart.h>
 
 #include <RTransceiver.h>
+#include <RFileTransferService.h>
 #include <RCommon.h>
 
 #include <RCommunicationTasks.h>
@@ -178,6 +179,10 @@ static int initDrivers(void) {
 		return error;
 	}
 
+	// load the state of the downlink frames stored in FRAM; not fatal, as they are loaded on first use otherwise
+	if (fileTransferInit() != SUCCESS)
+		debugPrint("initDriver(): failed to load File Transfer frames; loading on first use instead.\n");
+
 	return error;
 }
 
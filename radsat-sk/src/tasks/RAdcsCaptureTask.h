@@ -1,18 +1,18 @@
-/**
- * @file RAdcsCaptureTask.h
- * @date February 27, 2022
- * @author Tyrel Kostyk (tck290)
- */
-
-#ifndef RADCSCAPTURETASK_H_
-#define RADCSCAPTURETASK_H_
-
-
-/***************************************************************************************************
-                                           FREERTOS TASKS
-***************************************************************************************************/
-
-void AdcsCaptureTask(void* parameters);
-
-
-#endif /* RADCSCAPTURETASK_H_ */
+/**
+ * @file RAdcsCaptureTask.h
+ * @date February 27, 2022
+ * @author Tyrel Kostyk (tck290)
+ */
+
+#ifndef RADCSCAPTURETASK_H_
+#define RADCSCAPTURETASK_H_
+
+
+/***************************************************************************************************
+                                           FREERTOS TASKS
+***************************************************************************************************/
+
+void AdcsCaptureTask(void* parameters);
+
+
+#endif /* RADCSCAPTURETASK_H_ */
@@ -1,491 +1,1234 @@
-/**
- * @file RCommunicationTasks.c
- * @date January 30, 2022
- * @author Tyrel Kostyk (tck290) and Matthew Buglass (mab839)
- */
-
-#include <RCommunicationTasks.h>
-#include <RTransceiver.h>
-#include <RProtocolService.h>
-#include <RTelecommandService.h>
-#include <RFileTransferService.h>
-
-#include <freertos/FreeRTOS.h>
-#include <freertos/task.h>
-#include <freertos/timers.h>
-
-#include <string.h>
-
-
-/***************************************************************************************************
-                                   DEFINITIONS & PRIVATE GLOBALS
-***************************************************************************************************/
-
-/** Maximum possible duration of a pass is 15 minutes; value set in ms. */
-#define MAX_PASS_MODE_DURATION	((portTickType)(15*60*1000))
-
-/** Typical duration of quiet mode is 15 minutes; value set in ms. */
-#define QUIET_MODE_DURATION		((portTickType)(15*60*1000))
-
-/** Maximum amount of consecutive NACKs before transmission is aborted. */
-#define NACK_ERROR_LIMIT		((uint8_t)15)
-
-
-/** Communication Receive Task delay (in ms). */
-#define COMMUNICATION_RX_TASK_DELAY_MS			((portTickType)1)
-
-/** Communication Transmit Task delay (in ms) during typical operation. */
-#define COMMUNICATION_TX_TASK_SHORT_DELAY_MS	((portTickType)1)
-
-/**
- * Communication Transmit Task delay (in ms) when the transmitter's buffer is full.
- *
- * Transmission speed: 9600 bps => roughly 1 byte per ms; This delay should long enough to transmit
- * one full frame.
- */
-#define COMMUNICATION_TX_TASK_LONG_DELAY_MS		((portTickType)TRANCEIVER_TX_MAX_FRAME_SIZE)
-
-
-/** Abstraction of the response states */
-typedef enum _response_state_t {
-	responseStateIdle	= 0,	///> Awaiting response from Ground Station
-	responseStateReady	= 1,	///> Ready to transmit to Ground Station
-} response_state_t;
-
-
-/** Abstraction of the ACK/NACK return types */
-typedef enum _response_t {
-	responseAck		= protocol_message_Ack_tag,	///> Acknowledge (the message was received properly)
-	responseNack	= protocol_message_Nack_tag,	///> Negative Acknowledge (the message was NOT received properly)
-} response_t;
-
-
-/** Abstraction of the communication modes */
-typedef enum _comm_mode_t {
-	commModeQuiet			= -1,	///> Prevent downlink transmissions and automatic state changes
-	commModeIdle			= 0,	///> Not in a pass
-	commModeTelecommand		= 1,	///> Receiving Telecommands from Ground Station
-	commModeFileTransfer	= 2,	///> Transmitting data to the Ground Station
-} comm_mode_t;
-
-
-/** Co-ordinates tasks during the telecommand phase */
-typedef struct _telecommand_state_t {
-	response_state_t transmitReady;	///> Whether the Satellite is ready to transmit a response (ACK, NACK, etc.)
-	response_t responseToSend;		///> What response to send, when ready
-} telecommand_state_t;
-
-
-/** Co-ordinates tasks during the file transfer phase */
-typedef struct _file_transfer_state_t {
-	response_state_t transmitReady;		///> Whether the Satellite is ready to transmit another Frame (telemetry, etc.)
-	response_t responseReceived;		///> What response was received (ACK, NACK, etc.) regarding the previous message
-	uint8_t transmissionErrors;			///> Error counter for recording consecutive NACKs
-} file_transfer_state_t;
-
-
-/** Wrapper structure for communications co-ordination */
-typedef struct _communication_state_t {
-	comm_mode_t mode;					///> The current state of the Communications Tasks
-	telecommand_state_t telecommand;	///> The state during the Telecommand mode
-	file_transfer_state_t fileTransfer;	///> The state during the File Transfer mode
-} communication_state_t;
-
-
-/** Timer for pass mode */
-static xTimerHandle passTimer;
-
-/** Timer for quiet mode */
-static xTimerHandle quietTimer;
-
-/** Communication co-orditation structure */
-static communication_state_t state = { 0 };
-
-
-/***************************************************************************************************
-                                       PRIVATE FUNCTION STUBS
-***************************************************************************************************/
-
-static void startPassMode(void);
-static void endPassMode(void);
-static void endPassModeCallback(xTimerHandle timer);
-
-static void startQuietMode(void);
-static void endQuietModeCallback(xTimerHandle timer);
-
-static void resetState(void);
-
-static void ceaseTransmission(void);
-static void resumeTransmission(void);
-
-
-/***************************************************************************************************
-                                           FREERTOS TASKS
-***************************************************************************************************/
-
-/**
- * Receive and process frames received by the Transceiver's receiver buffer (when available).
- *
- * Constantly checks for the existence of received frames within the Transceiver; if they exist,
- * this task will retrieve and process them. If they are telecommands, they are immediately sent off
- * to another module for further processing. If the received message is an ACK/NACK, this task
- * updates the proper flags (local and private to this module) to continue communication operations
- * as guided by our protocol (single ACK-NACK responses per message).
- *
- * @note	This is a high priority task, and must never be disabled for extented periods of time.
- * @note	When an operational error occurs (e.g. a call to the transceiver module failed), this
- * 			Task will simply ignore the operation and try again next time. Lower level modules
- * 			(e.g. the Transceiver) are responsible for reporting those errors to the system.
- * @param	parameters Unused.
- */
-void CommunicationRxTask(void* parameters) {
-
-	// ignore the input parameter
-	(void)parameters;
-
-	int error = 0;				// error detection
-	uint16_t rxFrameCount = 0;	// number of frames currently in the receiver's buffer
-	uint16_t rxMessageSize = 0;	// size (in bytes) of a received frame
-	uint8_t rxMessage[TRANCEIVER_RX_MAX_FRAME_SIZE] = { 0 };	// input buffer for received frames
-
-	while (1) {
-
-		// get the number of frames currently in the receive buffer
-		rxFrameCount = 0;
-		error = transceiverRxFrameCount(&rxFrameCount);
-
-		// obtain frames when present
-		if (rxFrameCount > 0 && error == 0) {
-
-			// obtain new frame from the transceiver
-			rxMessageSize = 0;
-			memset(rxMessage, 0, sizeof(rxMessage));
-			error = transceiverGetFrame(rxMessage, &rxMessageSize);
-
-			// handle valid frames once obtained
-			if (rxMessageSize > 0 && error == 0) {
-
-				// transition out of idle mode and into pass mode (if not already done)
-				if (state.mode == commModeIdle)
-					startPassMode();
-
-				// telecommand (or quiet) mode, awaiting the next telecommand from the Ground Station
-				if ((state.mode == commModeTelecommand || state.mode == commModeQuiet)
-				&& (!state.telecommand.transmitReady))
-				{
-					// send telecommands to Telecommand Service for execution; extract specific telecommand
-					uint8_t telecommand = telecommandHandle(rxMessage, rxMessageSize);
-
-					// a valid telecommand was received and extracted
-					if (telecommand > 0)
-						state.telecommand.responseToSend = responseAck;
-
-					// no valid telecommand could be extracted
-					else
-						state.telecommand.responseToSend = responseNack;
-
-					// prepare to send ACK/NACK response
-					state.telecommand.transmitReady = responseStateReady;
-
-					// handle additional (communication-related) telecommand actions if necessary
-					switch (telecommand) {
-
-						// indicates that a telecommands are done; ready for file transfers
-						case (telecommand_message_BeginFileTransfer_tag):
-							// prepare for File Transfer Mode
-							state.mode = commModeFileTransfer;
-							break;
-
-						// indicates that all downlink activities shall be ceased
-						case (telecommand_message_CeaseTransmission_tag):
-							// immediately cease all downlink communications
-							ceaseTransmission();
-							break;
-
-						// indicates that downlink activities may be resumed
-						case (telecommand_message_ResumeTransmission_tag):
-							// immediately resume all downlink communications
-							resumeTransmission();
-							break;
-
-						default:
-							// do nothing; all other responsibilities are managed within the Telecommand Service
-							break;
-					}
-				}
-
-				// file transfer mode, awaiting ACK/NACK from the Ground Station
-				else if (state.mode == commModeFileTransfer && !state.fileTransfer.transmitReady)
-				{
-					// forward message to the Protocol Service and extract the received ACK/NACK response
-					response_t response = protocolHandle(rxMessage, rxMessageSize);
-
-					// prepare to send subsequent (or resend previous) file transfer frame
-					state.fileTransfer.responseReceived = response;
-					state.fileTransfer.transmitReady = responseStateReady;
-				}
-			}
-		}
-
-		vTaskDelay(COMMUNICATION_RX_TASK_DELAY_MS);
-	}
-}
-
-
-/**
- * Transmits outgoing frames to the Transceiver's transmitter buffer.
- *
- * When NOT in a pass mode, this task does nothing. When in a pass and in the telecommand mode
- * (i.e. receiving telecommands), this task is responsible for transmitting the appropriate ACKs
- * (or NACKs) and updating the flags (that are local and private to this module). When in a pass
- * and in the File Transfer mode, this task is responsible for transmitting frames that are ready
- * for downlink transmission. Preperation of downlink messages is done by another module prior to
- * the pass duration.
- *
- * @note	This is a high priority task.
- * @note	When an operational error occurs (e.g. a call to the transceiver module failed), this
- * 			Task will simply ignore the operation and try again next time. Lower level modules
- * 			(e.g. the Transceiver) are responsible for reporting these errors to the system.
- * @param	parameters Unused.
- */
-void CommunicationTxTask(void* parameters) {
-
-	// ignore the input parameter
-	(void)parameters;
-
-	int error = 0;												// error detection
-	uint8_t txSlotsRemaining = TRANCEIVER_TX_MAX_FRAME_COUNT;	// number of open frame slots in the transmitter's buffer
-	uint8_t txMessageSize = 0;									// size (in bytes) of an outgoing frame
-	uint8_t txMessage[TRANCEIVER_TX_MAX_FRAME_SIZE] = { 0 };	// output buffer for messages to be transmitted
-
-	while (1) {
-
-		// pass mode is active
-		if (communicationPassModeActive()) {
-
-			// ready to send ACK/NACK to the Ground Station
-			if (state.telecommand.transmitReady) {
-
-				// serialize the ACK/NACK response to be sent
-				txMessageSize = protocolGenerate(state.telecommand.responseToSend, txMessage);
-
-				// send the message
-				if (txMessageSize > 0)
-					error = transceiverSendFrame(txMessage, txMessageSize, &txSlotsRemaining);
-
-				// prepare to receive next message
-				if (error == 0 && txMessageSize > 0)
-					state.telecommand.transmitReady = responseStateIdle;
-			}
-
-			// file transfer mode, ready to transmit a message
-			else if (state.mode == commModeFileTransfer && state.fileTransfer.transmitReady) {
-
-				// ACK received from ground Station; obtain next message and send it
-				if (state.fileTransfer.responseReceived == responseAck) {
-
-					// clear transmission error counter
-					state.fileTransfer.transmissionErrors = 0;
-
-					// obtain new message and size from File Transfer Service
-					txMessageSize = fileTransferNextFrame(txMessage);
-
-					// send the message if one exists
-					if (txMessageSize > 0) {
-						error = transceiverSendFrame(txMessage, txMessageSize, &txSlotsRemaining);
-
-						// prepare to receive ACK/NACK
-						if (error == 0)
-							state.telecommand.transmitReady = responseStateIdle;
-						// force NACK in order to resend the packet
-						else
-							state.fileTransfer.responseReceived = responseNack;
-					}
-				}
-
-				// NACK received from ground Station; re-send the previous message
-				else {
-
-					// record the NACK
-					state.fileTransfer.transmissionErrors++;
-
-					// abort transmission if the error limit is exceeded
-					if (state.fileTransfer.transmissionErrors > NACK_ERROR_LIMIT)
-						endPassMode();
-
-					// resend the message
-					error = transceiverSendFrame(txMessage, txMessageSize, &txSlotsRemaining);
-
-					// prepare to receive ACK/NACK
-					if (error == 0)
-						state.telecommand.transmitReady = responseStateIdle;
-				}
-			}
-		}
-
-		// increase Task delay time when the Transmitter's buffer is full to give it time to transmit
-		if (txSlotsRemaining > 0)
-			vTaskDelay(COMMUNICATION_TX_TASK_SHORT_DELAY_MS);
-		else
-			vTaskDelay(COMMUNICATION_TX_TASK_LONG_DELAY_MS);
-	}
-}
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-/**
- * Indicate if the Satellite is currently in a communications mode.
- *
- * @returns 1 (true) if Satellite is uplinking or downlinking; 0 (false) otherwise.
- */
-uint8_t communicationPassModeActive(void) {
-	return (state.mode > commModeIdle);
-}
-
-
-/***************************************************************************************************
-                                         PRIVATE FUNCTIONS
-***************************************************************************************************/
-
-/**
- * Starts a timer for the max-length pass timeout.
- */
-static void startPassMode(void) {
-
-	// reset any previous communication state, to ensure a fresh start
-	resetState();
-
-	// set the mode (telecommand communications are first during a pass)
-	state.mode = commModeTelecommand;
-
-	// if the timer was not created yet, create it
-	if (passTimer == NULL) {
-		// create the timer; connect it to the callback
-		passTimer = xTimerCreate((const signed char *)"passTimer",
-								 MAX_PASS_MODE_DURATION,
-								 pdFALSE,
-								 NULL,
-								 endPassModeCallback);
-
-		// start the timer immediately
-		xTimerStart(passTimer, 0);
-	}
-
-	// otherwise simply restart it
-	else {
-		xTimerReset(passTimer, 0);
-	}
-}
-
-
-/**
- * End the pass mode by resetting local variables and temporarily entering quiet mode.
- *
- * Signals the end of a pass, temporarily disabling all transmissions. Use with caution.
- */
-void endPassMode(void) {
-
-	// reset the local communication state
-	resetState();
-
-	// enter quiet mode (with a timer to exit it)
-	startQuietMode();
-}
-
-
-/**
- * Callback function for the pass timer that ends the pass mode.
- *
- * @param timer A handle for a timer.
- */
-static void endPassModeCallback(xTimerHandle xTimer) {
-	(void)xTimer;
-	endPassMode();
-}
-
-
-/**
- * Starts a timer for the max-length pass timeout.
- */
-static void startQuietMode(void) {
-
-	// enter quiet mode
-	state.mode = commModeQuiet;
-
-	// if the timer was not created yet, create it
-	if (quietTimer == NULL) {
-		// create the timer; connect it to the callback
-		quietTimer = xTimerCreate((const signed char *)"quietTimer",
-								  QUIET_MODE_DURATION,
-								  pdFALSE,
-								  NULL,
-								  endQuietModeCallback);
-
-		// start the timer immediately
-		xTimerStart(quietTimer, 0);
-	}
-
-	// otherwise simply restart it
-	else {
-		xTimerReset(quietTimer, 0);
-	}
-}
-
-
-/**
- * Callback function for the quiet timer that resets comms to a neutral state.
- *
- * @param timer A handle for a timer.
- */
-static void endQuietModeCallback(xTimerHandle xTimer) {
-	(void)xTimer;
-	resetState();
-}
-
-
-/**
- * reset_t the structure for coordinating downlinking and uplinking.
- */
-static void resetState(void) {
-	memset(&state, 0, sizeof(communication_state_t));
-}
-
-
-/**
- * Forcefully puts the communication Tasks into quiet mode, without an automatic way out.
- *
- * Should only be put here via Telecommand from Ground Station. Only way out is through a
- * subsequent telecommand from the Ground Station (see @sa resumeTransmission).
- */
-static void ceaseTransmission(void) {
-
-	// reset the local communication state
-	resetState();
-
-	// cancel any communication mode timers that may be running
-	xTimerStop(passTimer, 0);
-	xTimerStop(quietTimer, 0);
-
-	// enter quiet mode
-	state.mode = commModeQuiet;
-}
-
-
-/**
- * Forcefully puts the communication Tasks back into idle mode, ready to continue normal operations.
- *
- * Should only be called via Telecommand from the Ground Station, following a previous Telecommand
- * that had the Satellite cease transmissions (see @sa ceaseTransmission).
- */
-static void resumeTransmission(void) {
-
-	// reset the local communication state
-	resetState();
-
-	// start a pass mode (clearly are in one if we received this command)
-	startPassMode();
-}
-
+/**
+ * @file RCommunicationTasks.c
+ * @date January 30, 2022
+ * @author Tyrel Kostyk (tck290) and Matthew Buglass (mab839)
+ */
+
+#include <RCommunicationTasks.h>
+#include <RTransceiver.h>
+#include <RProtocolService.h>
+#include <RTelecommandService.h>
+#include <RFileTransferService.h>
+#include <RMessage.h>
+#include <RReedSolomon.h>
+#include <RCommon.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/timers.h>
+
+#include <string.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** Maximum possible duration of a pass is 15 minutes; value set in ms. */
+#define MAX_PASS_MODE_DURATION	((portTickType)(15*60*1000))
+
+/** Typical duration of quiet mode is 15 minutes; value set in ms. */
+#define QUIET_MODE_DURATION		((portTickType)(15*60*1000))
+
+
+/** Communication Receive Task delay (in ms) during a pass. */
+#define COMMUNICATION_RX_TASK_PASS_DELAY_MS		((portTickType)1)
+
+/**
+ * Communication Receive Task delay (in ms) outside of a pass.
+ *
+ * The receiver holds up to 40 frames, so nothing is lost while polling slowly; the first frame of
+ * a pass is simply picked up a little later.
+ */
+#define COMMUNICATION_RX_TASK_IDLE_DELAY_MS		((portTickType)100)
+
+/** Communication Transmit Task delay (in ms) during typical operation. */
+#define COMMUNICATION_TX_TASK_SHORT_DELAY_MS	((portTickType)1)
+
+/**
+ * Communication Transmit Task delay (in ms) when the transmitter rejects a frame.
+ *
+ * Transmission speed: 9600 bps => roughly 1 byte per ms; This delay should long enough to transmit
+ * one full frame.
+ */
+#define COMMUNICATION_TX_TASK_LONG_DELAY_MS		((portTickType)TRANCEIVER_TX_MAX_FRAME_SIZE)
+
+/** Communication Transmit Task delay (in ms) outside of a pass (nothing is transmitted then). */
+#define COMMUNICATION_TX_TASK_IDLE_DELAY_MS		((portTickType)100)
+
+/**
+ * Number of frames kept in the transmitter's buffer during the File Transfer.
+ *
+ * Enough air time (roughly 0.85 s) to cover the Transmit Task's wake-up jitter, while keeping
+ * retransmissions from waiting behind a full buffer (40 frames take roughly 8.5 s to send).
+ */
+#define COMMUNICATION_TX_TARGET_DEPTH			((uint8_t)4)
+
+/** Time (in ms) the transmitter takes to send a frame of the given size (in bytes). */
+#define TX_FRAME_AIRTIME_MS(size)	((portTickType)((((size) + TRANCEIVER_TX_FRAME_OVERHEAD) * 8 * 1000) / TRANCEIVER_TX_BITRATE))
+
+
+/** Maximum number of unacknowledged File Transfer frames in flight (windowed downlink). */
+#define FILE_TRANSFER_WINDOW_MAX		((uint8_t)TRANCEIVER_TX_MAX_FRAME_COUNT)
+
+/**
+ * Time (in ms) without any newly received frame before all frames in flight are resent (windowed downlink).
+ *
+ * Allows for a full transmitter buffer to be emptied twice over before assuming the worst.
+ */
+#define FILE_TRANSFER_WINDOW_TIMEOUT_MS	((portTickType)(2 * TRANCEIVER_TX_MAX_FRAME_COUNT * COMMUNICATION_TX_TASK_LONG_DELAY_MS))
+
+
+/** Abstraction of the response states */
+typedef enum _response_state_t {
+	responseStateIdle	= 0,	///> Awaiting response from Ground Station
+	responseStateReady	= 1,	///> Ready to transmit to Ground Station
+} response_state_t;
+
+
+/** Abstraction of the ACK/NACK return types */
+typedef enum _response_t {
+	responseAck		= protocol_message_Ack_tag,	///> Acknowledge (the message was received properly)
+	responseNack	= protocol_message_Nack_tag,	///> Negative Acknowledge (the message was NOT received properly)
+	responseSelectiveAck	= protocol_message_SelectiveAck_tag,	///> Selective Acknowledge (windowed downlink)
+} response_t;
+
+
+/** Abstraction of the communication modes */
+typedef enum _comm_mode_t {
+	commModeQuiet			= -1,	///> Prevent downlink transmissions and automatic state changes
+	commModeIdle			= 0,	///> Not in a pass
+	commModeTelecommand		= 1,	///> Receiving Telecommands from Ground Station
+	commModeFileTransfer	= 2,	///> Transmitting data to the Ground Station
+} comm_mode_t;
+
+
+/** Co-ordinates tasks during the telecommand phase */
+typedef struct _telecommand_state_t {
+	response_state_t transmitReady;	///> Whether the Satellite is ready to transmit a response (ACK, NACK, etc.)
+	response_t responseToSend;		///> What response to send, when ready
+	uint8_t batchCount;				///> Number of telecommands in the batch being answered (0 for a single telecommand)
+	uint32_t batchExecuted;			///> Bitmap of the batched telecommands that were executed
+} telecommand_state_t;
+
+
+/** Tracks a single File Transfer frame in flight (windowed downlink) */
+typedef struct _window_frame_t {
+	uint16_t transmission;	///> Stamp of the latest transmission of this frame (ordering of transmissions)
+	uint8_t received;		///> Whether the Ground Station has selectively acknowledged this frame
+	uint8_t resend;			///> Whether this frame must be resent
+} window_frame_t;
+
+
+/** Co-ordinates the windowed (selective-repeat) downlink during the file transfer phase */
+typedef struct _file_transfer_window_t {
+	uint8_t active;									///> Whether the Ground Station has opted into the windowed downlink
+	uint8_t size;									///> Max number of frames in flight, as requested by the Ground Station
+	uint8_t base;									///> Sequence number of the oldest unacknowledged frame
+	uint8_t count;									///> Number of frames currently in flight
+	uint16_t transmissions;							///> Running transmission stamp counter
+	portTickType lastProgressTime;					///> Time the Ground Station last reported receiving a new frame
+	window_frame_t frames[FILE_TRANSFER_WINDOW_MAX];	///> Frames in flight, oldest first
+} file_transfer_window_t;
+
+
+/** Co-ordinates tasks during the file transfer phase */
+typedef struct _file_transfer_state_t {
+	response_state_t transmitReady;		///> Whether the Satellite is ready to transmit another Frame (telemetry, etc.)
+	response_t responseReceived;		///> What response was received (ACK, NACK, etc.) regarding the previous message
+	selective_ack selectiveAck;			///> The contents of the last Selective ACK received
+	portTickType responseTime;			///> Time at which the last response was received
+	uint8_t latencyPending;				///> Whether the frame sent in reaction to the last response is yet to be timed
+	uint8_t transmissionErrors;			///> Error counter for recording consecutive NACKs
+	file_transfer_window_t window;		///> The state of the windowed downlink
+} file_transfer_state_t;
+
+
+/** Model of the transmitter's buffer, predicting when queued frames leave it */
+typedef struct _tx_pacing_t {
+	uint8_t depth;										///> Number of frames predicted to be in the transmitter's buffer
+	uint8_t head;										///> Index of the oldest frame in the buffer
+	portTickType done[TRANCEIVER_TX_MAX_FRAME_COUNT];	///> Predicted time at which each frame is fully sent
+	portTickType airFreeTime;							///> Predicted time at which the buffer is empty
+	portTickType lastUpdate;							///> Time at which the model was last brought up to date
+	uint8_t rejected;									///> Whether the last frame was rejected by the transmitter
+} tx_pacing_t;
+
+
+/** Wrapper structure for communications co-ordination */
+typedef struct _communication_state_t {
+	comm_mode_t mode;					///> The current state of the Communications Tasks
+	telecommand_state_t telecommand;	///> The state during the Telecommand mode
+	file_transfer_state_t fileTransfer;	///> The state during the File Transfer mode
+} communication_state_t;
+
+
+/** Timer for pass mode */
+static xTimerHandle passTimer;
+
+/** Timer for quiet mode */
+static xTimerHandle quietTimer;
+
+/** Communication co-orditation structure */
+static communication_state_t state = { 0 };
+
+/** Receive Task (I2C bus usage) statistics */
+static communication_rx_stats_t rxStats = { 0 };
+
+/** Histogram of the time between receiving an ACK/NACK and sending the next File Transfer frame */
+static communication_tx_latency_t txLatency = { 0 };
+
+/** Model of the transmitter's buffer (kept across passes; the buffer itself is not cleared) */
+static tx_pacing_t pacing = { 0 };
+
+/** Transmit Task (pacing) statistics */
+static communication_tx_stats_t txStats = { 0 };
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static void startPassMode(void);
+static void endPassMode(void);
+static void endPassModeCallback(xTimerHandle timer);
+
+static void startQuietMode(void);
+static void endQuietModeCallback(xTimerHandle timer);
+
+static void resetState(void);
+
+static void ceaseTransmission(void);
+static void resumeTransmission(void);
+
+static void receiveFrame(uint8_t* frame, uint16_t size);
+static void receiveTelecommand(uint8_t telecommand);
+static uint8_t receiveReady(void);
+static void recordRxOperation(portTickType start);
+static void recordTxLatency(void);
+static void recordTransmissionError(void);
+
+static int sendFrame(uint8_t* frame, uint8_t size);
+static void pacingUpdate(portTickType now);
+static uint8_t pacingRoom(void);
+static portTickType pacingDelay(portTickType now);
+
+static void windowStart(const selective_ack* selectiveAck);
+static void windowHandleResponse(response_t response, const selective_ack* selectiveAck);
+static void windowResendAll(void);
+static void windowTransmit(void);
+static int windowSendFrame(uint8_t offset);
+
+
+/***************************************************************************************************
+                                           FREERTOS TASKS
+***************************************************************************************************/
+
+/**
+ * Receive and process frames received by the Transceiver's receiver buffer (when available).
+ *
+ * Constantly checks for the existence of received frames within the Transceiver; if they exist,
+ * this task will retrieve and process them. If they are telecommands, they are immediately sent off
+ * to another module for further processing. If the received message is an ACK/NACK, this task
+ * updates the proper flags (local and private to this module) to continue communication operations
+ * as guided by our protocol (single ACK-NACK responses per message, or cumulative Selective ACKs
+ * covering several frames when the Ground Station has opted into the windowed downlink).
+ *
+ * Every check of the receiver's buffer is an I2C transaction shared with the other subsystems, so
+ * the buffer is only checked rapidly during a pass, and all frames found are drained at once.
+ *
+ * @note	This is a high priority task, and must never be disabled for extented periods of time.
+ * @note	When an operational error occurs (e.g. a call to the transceiver module failed), this
+ * 			Task will simply ignore the operation and try again next time. Lower level modules
+ * 			(e.g. the Transceiver) are responsible for reporting those errors to the system.
+ * @param	parameters Unused.
+ */
+void CommunicationRxTask(void* parameters) {
+
+	// ignore the input parameter
+	(void)parameters;
+
+	int error = 0;				// error detection
+	uint16_t rxFrameCount = 0;	// number of frames currently in the receiver's buffer
+	uint16_t rxMessageSize = 0;	// size (in bytes) of a received frame
+	uint8_t rxMessage[TRANCEIVER_RX_MAX_FRAME_SIZE] = { 0 };	// input buffer for received frames
+	portTickType i2cStart = 0;	// start time of a transceiver (I2C) operation
+
+	while (1) {
+
+		// get the number of frames currently in the receive buffer
+		rxFrameCount = 0;
+		i2cStart = xTaskGetTickCount();
+		error = transceiverRxFrameCount(&rxFrameCount);
+		recordRxOperation(i2cStart);
+
+		rxStats.polls++;
+		if (rxFrameCount == 0 || error != 0)
+			rxStats.emptyPolls++;
+
+		// drain all frames present (unless an earlier frame must be responded to first)
+		for (uint16_t i = 0; i < rxFrameCount && error == 0 && receiveReady(); i++) {
+
+			// obtain new frame from the transceiver
+			rxMessageSize = 0;
+			memset(rxMessage, 0, sizeof(rxMessage));
+			i2cStart = xTaskGetTickCount();
+			error = transceiverGetFrame(rxMessage, &rxMessageSize);
+			recordRxOperation(i2cStart);
+
+			// handle valid frames once obtained
+			if (rxMessageSize > 0 && error == 0) {
+				rxStats.framesDrained++;
+				receiveFrame(rxMessage, rxMessageSize);
+			}
+		}
+
+		// poll rapidly during a pass only; otherwise leave the I2C bus to the other subsystems
+		if (communicationPassModeActive())
+			vTaskDelay(COMMUNICATION_RX_TASK_PASS_DELAY_MS);
+		else
+			vTaskDelay(COMMUNICATION_RX_TASK_IDLE_DELAY_MS);
+	}
+}
+
+
+/**
+ * Transmits outgoing frames to the Transceiver's transmitter buffer.
+ *
+ * When NOT in a pass mode, this task does nothing. When in a pass and in the telecommand mode
+ * (i.e. receiving telecommands), this task is responsible for transmitting the appropriate ACKs
+ * (or NACKs) and updating the flags (that are local and private to this module). When in a pass
+ * and in the File Transfer mode, this task is responsible for transmitting frames that are ready
+ * for downlink transmission. Preperation of downlink messages is done by another module prior to
+ * the pass duration.
+ *
+ * By default, File Transfer frames are sent one at a time, each awaiting an ACK/NACK. If the Ground
+ * Station responds with a Selective ACK instead, the windowed downlink is used for the rest of the
+ * pass: up to the requested number of frames are kept in flight, each prefixed with a one byte
+ * sequence number, and only the frames the Ground Station reports missing are resent. Either way,
+ * the Ground Station may ask for parity bytes on every frame, so that it can repair damaged frames
+ * instead of having them resent.
+ *
+ * The transmitter's buffer is modelled from the frames sent (and the open slots it reports back),
+ * so that the task can keep just enough File Transfer frames queued to keep the air busy, and sleep
+ * exactly until the next frame is predicted to leave the buffer.
+ *
+ * @note	This is a high priority task.
+ * @note	When an operational error occurs (e.g. a call to the transceiver module failed), this
+ * 			Task will simply ignore the operation and try again next time. Lower level modules
+ * 			(e.g. the Transceiver) are responsible for reporting these errors to the system.
+ * @param	parameters Unused.
+ */
+void CommunicationTxTask(void* parameters) {
+
+	// ignore the input parameter
+	(void)parameters;
+
+	int error = 0;												// error detection
+	uint8_t txMessageSize = 0;									// size (in bytes) of an outgoing frame
+	uint8_t txMessage[TRANCEIVER_TX_MAX_FRAME_SIZE] = { 0 };	// output buffer for messages to be transmitted
+	uint32_t framesSent = 0;									// number of frames sent before this wake-up
+
+	while (1) {
+
+		// bring the model of the transmitter's buffer up to date
+		pacingUpdate(xTaskGetTickCount());
+
+		// pass mode is active
+		if (communicationPassModeActive()) {
+
+			txStats.wakeups++;
+			framesSent = txStats.framesSent;
+
+			// ready to send ACK/NACK to the Ground Station
+			if (state.telecommand.transmitReady) {
+
+				// serialize the ACK/NACK response to be sent (with the header asked for by the Ground Station);
+				// a batch of telecommands is answered with the outcome of each
+				if (state.telecommand.batchCount > 0)
+					txMessageSize = protocolGenerateBatchAck(state.telecommand.batchCount, state.telecommand.batchExecuted, txMessage);
+				else
+					txMessageSize = protocolGenerate(state.telecommand.responseToSend, txMessage);
+				txMessageSize = messageCompact(txMessage, txMessageSize);
+
+				// send the message
+				if (txMessageSize > 0)
+					error = sendFrame(txMessage, txMessageSize);
+
+				// prepare to receive next message
+				if (error == 0 && txMessageSize > 0)
+					state.telecommand.transmitReady = responseStateIdle;
+			}
+
+			// file transfer mode, windowed downlink
+			else if (state.mode == commModeFileTransfer && state.fileTransfer.window.active) {
+
+				// process the latest acknowledgement from the Ground Station
+				if (state.fileTransfer.transmitReady) {
+					selective_ack selectiveAck = { 0 };
+					response_t response = 0;
+
+					taskENTER_CRITICAL();
+					selectiveAck = state.fileTransfer.selectiveAck;
+					response = state.fileTransfer.responseReceived;
+					state.fileTransfer.transmitReady = responseStateIdle;
+					state.fileTransfer.latencyPending = 1;
+					taskEXIT_CRITICAL();
+
+					windowHandleResponse(response, &selectiveAck);
+				}
+
+				// resend frames after a prolonged silence from the Ground Station
+				else if (state.fileTransfer.window.count > 0
+				&& (xTaskGetTickCount() - state.fileTransfer.window.lastProgressTime) > FILE_TRANSFER_WINDOW_TIMEOUT_MS)
+				{
+					windowResendAll();
+					recordTransmissionError();
+					state.fileTransfer.window.lastProgressTime = xTaskGetTickCount();
+				}
+
+				// fill the window with missing and new frames
+				if (state.mode == commModeFileTransfer)
+					windowTransmit();
+			}
+
+			// file transfer mode, ready to transmit a message
+			else if (state.mode == commModeFileTransfer && state.fileTransfer.transmitReady) {
+
+				// Selective ACK received from the Ground Station; switch to the windowed downlink
+				if (state.fileTransfer.responseReceived == responseSelectiveAck) {
+					windowStart(&state.fileTransfer.selectiveAck);
+					state.fileTransfer.transmitReady = responseStateIdle;
+				}
+
+				// ACK received from ground Station; obtain next message and send it
+				else if (state.fileTransfer.responseReceived == responseAck) {
+
+					// time the reaction to this ACK
+					state.fileTransfer.latencyPending = 1;
+
+					// clear transmission error counter
+					state.fileTransfer.transmissionErrors = 0;
+
+					// obtain new message and size from File Transfer Service (staged in RAM ahead of time)
+					txMessageSize = fileTransferNextFrame(txMessage);
+					if (txMessageSize > 0)
+						txMessageSize = messageCompact(txMessage, txMessageSize);
+
+					// send the message if one exists
+					if (txMessageSize > 0) {
+						error = sendFrame(txMessage, txMessageSize);
+
+						// prepare to receive ACK/NACK
+						if (error == 0)
+							state.fileTransfer.transmitReady = responseStateIdle;
+
+						// force NACK in order to resend the packet
+						else
+							state.fileTransfer.responseReceived = responseNack;
+					}
+				}
+
+				// NACK received from ground Station; re-send the previous message
+				else {
+
+					// time the reaction to this NACK
+					state.fileTransfer.latencyPending = 1;
+
+					// record the NACK (aborting transmission if the error limit is exceeded)
+					txStats.nacksReceived++;
+					recordTransmissionError();
+
+					// resend the message
+					error = sendFrame(txMessage, txMessageSize);
+
+					// prepare to receive ACK/NACK
+					if (error == 0) {
+						txStats.framesResent++;
+						state.fileTransfer.transmitReady = responseStateIdle;
+					}
+				}
+			}
+
+			// use the time until the next response to prepare upcoming frames (keeps FRAM off the hot path)
+			if (state.mode == commModeFileTransfer && !state.fileTransfer.transmitReady) {
+				if (state.fileTransfer.window.active)
+					fileTransferPrefetch(state.fileTransfer.window.count + 1);
+				else
+					fileTransferPrefetch(1);
+			}
+
+			// only time responses that are immediately followed by a frame (not those that wait on a full window)
+			state.fileTransfer.latencyPending = 0;
+
+			if (txStats.framesSent == framesSent)
+				txStats.idleWakeups++;
+
+			// sleep until the transmitter is predicted to have room again (or check for responses shortly)
+			vTaskDelay(pacingDelay(xTaskGetTickCount()));
+		}
+
+		// nothing is transmitted outside of a pass
+		else
+			vTaskDelay(COMMUNICATION_TX_TASK_IDLE_DELAY_MS);
+	}
+}
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+/**
+ * Indicate if the Satellite is currently in a communications mode.
+ *
+ * @returns 1 (true) if Satellite is uplinking or downlinking; 0 (false) otherwise.
+ */
+uint8_t communicationPassModeActive(void) {
+	return (state.mode > commModeIdle);
+}
+
+
+/**
+ * Provide the Receive Task statistics, used to measure its I2C bus usage.
+ *
+ * @param stats Buffer for the statistics. Set by function.
+ * @param reset Whether to reset the statistics after providing them.
+ */
+void communicationRxStats(communication_rx_stats_t* stats, uint8_t reset) {
+	if (stats == 0)
+		return;
+
+	taskENTER_CRITICAL();
+	*stats = rxStats;
+	if (reset)
+		memset(&rxStats, 0, sizeof(rxStats));
+	taskEXIT_CRITICAL();
+}
+
+
+/**
+ * Provide the histogram of the time between receiving an ACK/NACK and sending the next frame.
+ *
+ * @param latency Buffer for the histogram. Set by function.
+ * @param reset Whether to reset the histogram after providing it.
+ */
+void communicationTxLatency(communication_tx_latency_t* latency, uint8_t reset) {
+	if (latency == 0)
+		return;
+
+	taskENTER_CRITICAL();
+	*latency = txLatency;
+	if (reset)
+		memset(&txLatency, 0, sizeof(txLatency));
+	taskEXIT_CRITICAL();
+}
+
+
+/**
+ * Provide the Transmit Task statistics, used to measure how well the transmitter is kept busy.
+ *
+ * @param stats Buffer for the statistics. Set by function.
+ * @param reset Whether to reset the statistics after providing them.
+ */
+void communicationTxStats(communication_tx_stats_t* stats, uint8_t reset) {
+	if (stats == 0)
+		return;
+
+	taskENTER_CRITICAL();
+	*stats = txStats;
+	if (reset)
+		memset(&txStats, 0, sizeof(txStats));
+	taskEXIT_CRITICAL();
+}
+
+
+/**
+ * Forcefully end the current pass, temporarily entering quiet mode.
+ *
+ * Any frames still unacknowledged remain stored for the next pass.
+ */
+void communicationEndPass(void) {
+	endPassMode();
+}
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Starts a timer for the max-length pass timeout.
+ */
+static void startPassMode(void) {
+
+	// reset any previous communication state, to ensure a fresh start
+	resetState();
+
+	// set the mode (telecommand communications are first during a pass)
+	state.mode = commModeTelecommand;
+
+	// a pass may begin from quiet mode (see @sa resumeTransmission); it must not end it prematurely
+	if (quietTimer != NULL)
+		xTimerStop(quietTimer, 0);
+
+	// if the timer was not created yet, create it
+	if (passTimer == NULL) {
+		// create the timer; connect it to the callback
+		passTimer = xTimerCreate((const signed char *)"passTimer",
+								 MAX_PASS_MODE_DURATION,
+								 pdFALSE,
+								 NULL,
+								 endPassModeCallback);
+
+		// start the timer immediately
+		xTimerStart(passTimer, 0);
+	}
+
+	// otherwise simply restart it
+	else {
+		xTimerReset(passTimer, 0);
+	}
+}
+
+
+/**
+ * End the pass mode by resetting local variables and temporarily entering quiet mode.
+ *
+ * Signals the end of a pass, temporarily disabling all transmissions. Use with caution.
+ */
+void endPassMode(void) {
+
+	// reset the local communication state
+	resetState();
+
+	// enter quiet mode (with a timer to exit it)
+	startQuietMode();
+}
+
+
+/**
+ * Callback function for the pass timer that ends the pass mode.
+ *
+ * @param timer A handle for a timer.
+ */
+static void endPassModeCallback(xTimerHandle xTimer) {
+	(void)xTimer;
+	endPassMode();
+}
+
+
+/**
+ * Starts a timer for the max-length pass timeout.
+ */
+static void startQuietMode(void) {
+
+	// enter quiet mode
+	state.mode = commModeQuiet;
+
+	// if the timer was not created yet, create it
+	if (quietTimer == NULL) {
+		// create the timer; connect it to the callback
+		quietTimer = xTimerCreate((const signed char *)"quietTimer",
+								  QUIET_MODE_DURATION,
+								  pdFALSE,
+								  NULL,
+								  endQuietModeCallback);
+
+		// start the timer immediately
+		xTimerStart(quietTimer, 0);
+	}
+
+	// otherwise simply restart it
+	else {
+		xTimerReset(quietTimer, 0);
+	}
+}
+
+
+/**
+ * Callback function for the quiet timer that resets comms to a neutral state.
+ *
+ * @param timer A handle for a timer.
+ */
+static void endQuietModeCallback(xTimerHandle xTimer) {
+	(void)xTimer;
+	resetState();
+}
+
+
+/**
+ * reset_t the structure for coordinating downlinking and uplinking.
+ */
+static void resetState(void) {
+	memset(&state, 0, sizeof(communication_state_t));
+
+	// full headers without parity bytes until the Ground Station asks otherwise (at the beginning of the next pass)
+	messageCompactHeaders(0, 0);
+	rsConfigure(0);
+}
+
+
+/**
+ * Forcefully puts the communication Tasks into quiet mode, without an automatic way out.
+ *
+ * Should only be put here via Telecommand from Ground Station. Only way out is through a
+ * subsequent telecommand from the Ground Station (see @sa resumeTransmission).
+ */
+static void ceaseTransmission(void) {
+
+	// reset the local communication state
+	resetState();
+
+	// cancel any communication mode timers that may be running
+	xTimerStop(passTimer, 0);
+	xTimerStop(quietTimer, 0);
+
+	// enter quiet mode
+	state.mode = commModeQuiet;
+}
+
+
+/**
+ * Forcefully puts the communication Tasks back into idle mode, ready to continue normal operations.
+ *
+ * Should only be called via Telecommand from the Ground Station, following a previous Telecommand
+ * that had the Satellite cease transmissions (see @sa ceaseTransmission).
+ */
+static void resumeTransmission(void) {
+
+	// reset the local communication state
+	resetState();
+
+	// start a pass mode (clearly are in one if we received this command)
+	startPassMode();
+}
+
+
+/**
+ * Switch the file transfer phase over to the windowed (selective-repeat) downlink.
+ *
+ * The frame currently held by the File Transfer Service is considered delivered; the Ground Station
+ * dictates the sequence number of the first windowed frame as well as the window size.
+ *
+ * @param selectiveAck The Selective ACK that the Ground Station opted in with.
+ */
+static void windowStart(const selective_ack* selectiveAck) {
+
+	file_transfer_window_t* window = &state.fileTransfer.window;
+	memset(window, 0, sizeof(file_transfer_window_t));
+
+	// limit the window to the capacity of the transmitter
+	window->size = FILE_TRANSFER_WINDOW_MAX;
+	if (selectiveAck->window > 0 && selectiveAck->window < FILE_TRANSFER_WINDOW_MAX)
+		window->size = (uint8_t)selectiveAck->window;
+
+	window->base = (uint8_t)selectiveAck->sequence;
+	window->lastProgressTime = xTaskGetTickCount();
+	window->active = 1;
+
+	state.fileTransfer.transmissionErrors = 0;
+}
+
+
+/**
+ * Apply an acknowledgement from the Ground Station to the frames in flight.
+ *
+ * Frames cumulatively acknowledged are released from the File Transfer Service. A frame reported
+ * missing is only resent once a frame transmitted after it has been received, so that frames still
+ * propagating through the transmitter's buffer are not needlessly sent twice.
+ *
+ * @param response The type of response received.
+ * @param selectiveAck The contents of the response, if it was a Selective ACK.
+ */
+static void windowHandleResponse(response_t response, const selective_ack* selectiveAck) {
+
+	file_transfer_window_t* window = &state.fileTransfer.window;
+	uint8_t progress = 0;
+
+	// plain ACK; everything in flight was received
+	if (response == responseAck) {
+		progress = window->count;
+	}
+
+	// plain NACK; resend everything in flight
+	else if (response != responseSelectiveAck) {
+		txStats.nacksReceived++;
+		windowResendAll();
+		recordTransmissionError();
+		return;
+	}
+
+	// Selective ACK; determine how far the oldest missing frame has moved (ignore stale responses)
+	else {
+		progress = (uint8_t)(selectiveAck->sequence - window->base);
+		if (progress > window->count)
+			return;
+	}
+
+	// release all cumulatively acknowledged frames
+	if (progress > 0) {
+		if (fileTransferConsumeFrames(progress) != SUCCESS)
+			return;
+
+		window->count -= progress;
+		window->base += progress;
+		memmove(&window->frames[0], &window->frames[progress], window->count * sizeof(window_frame_t));
+		state.fileTransfer.transmissionErrors = 0;
+		window->lastProgressTime = xTaskGetTickCount();
+	}
+
+	if (response != responseSelectiveAck)
+		return;
+
+	// record the frames received beyond the oldest missing frame, along with the latest of them
+	int8_t highest = -1;
+	for (uint8_t i = 1; i < window->count; i++) {
+		if ((selectiveAck->received >> (i - 1)) & 1) {
+			if (!window->frames[i].received)
+				window->lastProgressTime = xTaskGetTickCount();
+
+			window->frames[i].received = 1;
+			window->frames[i].resend = 0;
+			highest = (int8_t)i;
+		}
+	}
+
+	// nothing received out of order; the missing frame may simply still be on its way
+	if (highest < 0)
+		return;
+
+	// any missing frame transmitted before the latest received frame must have been lost
+	uint8_t lost = 0;
+	uint16_t latestTransmission = window->frames[highest].transmission;
+	for (uint8_t i = 0; i < (uint8_t)highest; i++) {
+		if (!window->frames[i].received && !window->frames[i].resend
+		&& (int16_t)(latestTransmission - window->frames[i].transmission) > 0)
+		{
+			window->frames[i].resend = 1;
+			lost = 1;
+		}
+	}
+
+	// lost frames without any forward progress count towards the error limit
+	if (lost && progress == 0)
+		recordTransmissionError();
+}
+
+
+/**
+ * Mark all frames in flight that were not yet received for retransmission.
+ */
+static void windowResendAll(void) {
+	file_transfer_window_t* window = &state.fileTransfer.window;
+
+	for (uint8_t i = 0; i < window->count; i++) {
+		if (!window->frames[i].received)
+			window->frames[i].resend = 1;
+	}
+}
+
+
+/**
+ * Transmit frames marked for retransmission, then fill the window with new frames.
+ *
+ * Stops as soon as the transmitter holds enough frames (or rejects a frame); the remaining frames
+ * are sent on a later call.
+ */
+static void windowTransmit(void) {
+	file_transfer_window_t* window = &state.fileTransfer.window;
+
+	// resend missing frames first; the Ground Station cannot advance without them
+	for (uint8_t i = 0; i < window->count; i++) {
+		if (!window->frames[i].resend)
+			continue;
+
+		if (!pacingRoom() || windowSendFrame(i) != SUCCESS)
+			return;
+	}
+
+	// send new frames while there is room in the window
+	while (window->count < window->size && pacingRoom()) {
+		if (windowSendFrame(window->count) != SUCCESS)
+			return;
+
+		window->count++;
+	}
+}
+
+
+/**
+ * Send a single File Transfer frame of the window, prefixed with its sequence number.
+ *
+ * @param offset The position of the frame within the window (0 is the oldest frame in flight).
+ * @return 0 on success, otherwise an error (or no frame to send).
+ */
+static int windowSendFrame(uint8_t offset) {
+	file_transfer_window_t* window = &state.fileTransfer.window;
+	uint8_t frame[TRANCEIVER_TX_MAX_FRAME_SIZE + 1] = { 0 };
+
+	// obtain the frame from the File Transfer Service, leaving room for the sequence number
+	uint8_t frameSize = fileTransferPeekFrame(offset + 1, &frame[1]);
+	if (frameSize > 0)
+		frameSize = messageCompact(&frame[1], frameSize);
+	if (frameSize == 0 || frameSize + FILE_TRANSFER_FRAME_RESERVED_SIZE > TRANCEIVER_TX_MAX_FRAME_SIZE)
+		return E_GENERIC;
+
+	frame[0] = (uint8_t)(window->base + offset);
+
+	int error = sendFrame(frame, frameSize + 1);
+	if (error != 0)
+		return error;
+
+	// frames within the window have been sent before
+	if (offset < window->count)
+		txStats.framesResent++;
+
+	// stamp the transmission; a new frame is initialized here, a resent frame is updated
+	window->transmissions++;
+	window->frames[offset].transmission = window->transmissions;
+	window->frames[offset].received = 0;
+	window->frames[offset].resend = 0;
+
+	return SUCCESS;
+}
+
+
+/**
+ * Process a single frame received from the Ground Station.
+ *
+ * Telecommands are sent off to the Telecommand Service (and then responded to by the Transmit
+ * Task); ACKs/NACKs are recorded for the Transmit Task to act upon.
+ *
+ * @param frame The received frame.
+ * @param size The size of the received frame (in bytes).
+ */
+static void receiveFrame(uint8_t* frame, uint16_t size) {
+
+	// transition out of idle mode and into pass mode (if not already done)
+	if (state.mode == commModeIdle)
+		startPassMode();
+
+	// telecommand (or quiet) mode, awaiting the next telecommand(s) from the Ground Station
+	if (state.mode == commModeTelecommand || state.mode == commModeQuiet)
+	{
+		// extract the telecommand(s) sent to the Telecommand Service
+		telecommand_batch telecommands;
+		uint8_t batched = 0;
+		uint8_t count = telecommandUnwrap(frame, size, &telecommands, &batched);
+
+		// a single telecommand (or an unreadable frame) is answered on its own
+		if (!batched) {
+			uint8_t telecommand = (count > 0) ? telecommandExecute(&telecommands.Telecommands[0]) : 0;
+
+			// a valid telecommand was received and executed
+			if (telecommand > 0)
+				state.telecommand.responseToSend = responseAck;
+
+			// no valid telecommand could be extracted
+			else
+				state.telecommand.responseToSend = responseNack;
+
+			// prepare to send ACK/NACK response
+			state.telecommand.batchCount = 0;
+			state.telecommand.transmitReady = responseStateReady;
+
+			// handle additional (communication-related) telecommand actions if necessary
+			receiveTelecommand(telecommand);
+			return;
+		}
+
+		// a batch of telecommands, executed in order
+		uint32_t executed = 0;
+		for (uint8_t i = 0; i < count; i++) {
+			uint8_t telecommand = telecommandExecute(&telecommands.Telecommands[i]);
+			if (telecommand > 0)
+				executed |= (1UL << i);
+
+			receiveTelecommand(telecommand);
+		}
+
+		// prepare to send a single ACK, with the outcome of each telecommand (unless asked to cease all downlink)
+		if (state.mode != commModeQuiet) {
+			state.telecommand.responseToSend = responseAck;
+			state.telecommand.batchCount = count;
+			state.telecommand.batchExecuted = executed;
+			state.telecommand.transmitReady = responseStateReady;
+		}
+	}
+
+	// file transfer mode, awaiting ACK/NACK from the Ground Station
+	else if (state.mode == commModeFileTransfer)
+	{
+		// forward message to the Protocol Service and extract the received ACK/NACK response
+		selective_ack selectiveAck = { 0 };
+		response_t response = protocolHandle(frame, size, &selectiveAck);
+
+		// prepare to send subsequent (or resend previous) file transfer frame(s); windowed frames
+		// are acknowledged cumulatively, so unreadable responses are simply dropped there
+		if (!state.fileTransfer.window.active || response > 0) {
+			taskENTER_CRITICAL();
+			state.fileTransfer.responseReceived = response;
+			state.fileTransfer.selectiveAck = selectiveAck;
+			state.fileTransfer.responseTime = xTaskGetTickCount();
+			state.fileTransfer.transmitReady = responseStateReady;
+			taskEXIT_CRITICAL();
+		}
+	}
+}
+
+
+/**
+ * Handle the communication-related actions of an executed telecommand.
+ *
+ * @param telecommand The tag of the executed telecommand (0 if it failed).
+ */
+static void receiveTelecommand(uint8_t telecommand) {
+
+	switch (telecommand) {
+
+		// indicates that a telecommands are done; ready for file transfers
+		case (telecommand_message_BeginFileTransfer_tag):
+			// include the most recent (partially packed) frame in the downlink
+			fileTransferFlush();
+			// prepare for File Transfer Mode
+			state.mode = commModeFileTransfer;
+			break;
+
+		// indicates that all downlink activities shall be ceased
+		case (telecommand_message_CeaseTransmission_tag):
+			// immediately cease all downlink communications
+			ceaseTransmission();
+			break;
+
+		// indicates that downlink activities may be resumed
+		case (telecommand_message_ResumeTransmission_tag):
+			// immediately resume all downlink communications
+			resumeTransmission();
+			break;
+
+		default:
+			// do nothing; all other responsibilities are managed within the Telecommand Service
+			break;
+	}
+}
+
+
+/**
+ * Indicate whether a received frame can be processed right away.
+ *
+ * Frames are left in the receiver's buffer while the response to a previous frame is still to be
+ * acted upon by the Transmit Task, so that they are not processed (and lost) out of turn.
+ *
+ * @return 1 (true) if a frame can be processed; 0 (false) otherwise.
+ */
+static uint8_t receiveReady(void) {
+
+	// the response to the previous telecommand has not been sent yet
+	if (state.mode == commModeTelecommand && state.telecommand.transmitReady)
+		return 0;
+
+	// the previous (stop-and-wait) ACK/NACK has not been acted upon yet
+	if (state.mode == commModeFileTransfer && !state.fileTransfer.window.active && state.fileTransfer.transmitReady)
+		return 0;
+
+	return 1;
+}
+
+
+/**
+ * Record a File Transfer transmission error, aborting the pass if the error limit is exceeded.
+ */
+static void recordTransmissionError(void) {
+	state.fileTransfer.transmissionErrors++;
+
+	if (state.fileTransfer.transmissionErrors > txStats.errorStreakMax)
+		txStats.errorStreakMax = state.fileTransfer.transmissionErrors;
+
+	if (state.fileTransfer.transmissionErrors > NACK_ERROR_LIMIT) {
+		txStats.passesAborted++;
+		endPassMode();
+	}
+}
+
+
+/**
+ * Record the duration of a transceiver (I2C) operation of the Receive Task.
+ *
+ * @param start The time at which the operation started.
+ */
+static void recordRxOperation(portTickType start) {
+	rxStats.i2cTransactions++;
+	rxStats.i2cTimeMs += (xTaskGetTickCount() - start) * portTICK_RATE_MS;
+}
+
+
+/**
+ * Record the time between the last ACK/NACK and the frame sent in reaction to it (once per response).
+ */
+static void recordTxLatency(void) {
+	if (!state.fileTransfer.latencyPending)
+		return;
+
+	state.fileTransfer.latencyPending = 0;
+	uint32_t latency = (xTaskGetTickCount() - state.fileTransfer.responseTime) * portTICK_RATE_MS;
+
+	// bucket 0 holds 0 ms, bucket 1 holds 1 ms, and each subsequent bucket doubles the range
+	uint8_t bucket = 0;
+	uint32_t limit = 0;
+	while (latency > limit && bucket < COMMUNICATION_TX_LATENCY_BUCKETS - 1) {
+		bucket++;
+		limit = (limit == 0) ? 1 : (limit * 2);
+	}
+
+	txLatency.buckets[bucket]++;
+	txLatency.samples++;
+	if (latency > txLatency.maxMs)
+		txLatency.maxMs = latency;
+}
+
+
+/**
+ * Send a frame to the transmitter, keeping the model of its buffer in step.
+ *
+ * The model predicts when each frame leaves the buffer from its airtime; the number of open slots
+ * reported by the transmitter is used to correct the prediction after every frame.
+ *
+ * Parity bytes are appended to the frame if the Ground Station asked for them (see RReedSolomon.c).
+ *
+ * @param frame The frame to send; must have room for the parity bytes after it. Modified by function.
+ * @param size The size of the frame (in bytes), without any parity bytes.
+ * @return 0 on success, otherwise see hal/errors.h.
+ */
+static int sendFrame(uint8_t* frame, uint8_t size) {
+	uint8_t slotsRemaining = 0;
+
+	// every frame leaves room for the parity bytes (see FILE_TRANSFER_FRAME_RESERVED_SIZE)
+	if (size + rsParitySize() > TRANCEIVER_TX_MAX_FRAME_SIZE)
+		return E_PARAM_OUTOFBOUNDS;
+
+	size = rsEncode(frame, size);
+
+	int error = transceiverSendFrame(frame, size, &slotsRemaining);
+	if (error != 0) {
+		pacing.rejected = 1;
+		txStats.framesRejected++;
+		return error;
+	}
+
+	portTickType now = xTaskGetTickCount();
+	pacingUpdate(now);
+	pacing.rejected = 0;
+
+	// the frame is sent once all frames ahead of it are
+	if ((int32_t)(pacing.airFreeTime - now) < 0)
+		pacing.airFreeTime = now;
+	pacing.airFreeTime += TX_FRAME_AIRTIME_MS(size) / portTICK_RATE_MS;
+
+	if (pacing.depth < TRANCEIVER_TX_MAX_FRAME_COUNT) {
+		pacing.done[(pacing.head + pacing.depth) % TRANCEIVER_TX_MAX_FRAME_COUNT] = pacing.airFreeTime;
+		pacing.depth++;
+	}
+
+	// the transmitter is ahead of the prediction; the oldest frames are already gone
+	uint8_t depth = TRANCEIVER_TX_MAX_FRAME_COUNT - slotsRemaining;
+	while (pacing.depth > depth) {
+		portTickType early = pacing.done[pacing.head] - now;
+		pacing.head = (pacing.head + 1) % TRANCEIVER_TX_MAX_FRAME_COUNT;
+		pacing.depth--;
+
+		if ((int32_t)early > 0) {
+			for (uint8_t i = 0; i < pacing.depth; i++)
+				pacing.done[(pacing.head + i) % TRANCEIVER_TX_MAX_FRAME_COUNT] -= early;
+			pacing.airFreeTime -= early;
+		}
+	}
+
+	// the transmitter is behind the prediction (or holds frames unknown to the model); assume full frames
+	while (pacing.depth < depth) {
+		pacing.airFreeTime += TX_FRAME_AIRTIME_MS(TRANCEIVER_TX_MAX_FRAME_SIZE) / portTICK_RATE_MS;
+		pacing.done[(pacing.head + pacing.depth) % TRANCEIVER_TX_MAX_FRAME_COUNT] = pacing.airFreeTime;
+		pacing.depth++;
+	}
+
+	recordTxLatency();
+
+	txStats.framesSent++;
+	txStats.depthSum += pacing.depth;
+	if (pacing.depth > txStats.depthMax)
+		txStats.depthMax = pacing.depth;
+
+	return SUCCESS;
+}
+
+
+/**
+ * Bring the model of the transmitter's buffer up to date, releasing the frames already sent.
+ *
+ * Also accounts the time the transmitter was (predicted to be) busy or idle since the last update;
+ * idle time only counts during the File Transfer, when the air is supposed to be kept busy.
+ *
+ * @param now The current time.
+ */
+static void pacingUpdate(portTickType now) {
+
+	while (pacing.depth > 0 && (int32_t)(pacing.done[pacing.head] - now) <= 0) {
+		pacing.head = (pacing.head + 1) % TRANCEIVER_TX_MAX_FRAME_COUNT;
+		pacing.depth--;
+	}
+
+	portTickType busyUntil = pacing.airFreeTime;
+	if ((int32_t)(busyUntil - pacing.lastUpdate) < 0)
+		busyUntil = pacing.lastUpdate;
+	if ((int32_t)(busyUntil - now) > 0)
+		busyUntil = now;
+
+	txStats.airBusyMs += (busyUntil - pacing.lastUpdate) * portTICK_RATE_MS;
+	if (state.mode == commModeFileTransfer)
+		txStats.airIdleMs += (now - busyUntil) * portTICK_RATE_MS;
+
+	pacing.lastUpdate = now;
+}
+
+
+/**
+ * Indicate whether another File Transfer frame should be sent to the transmitter now.
+ *
+ * @return 1 (true) if the transmitter holds fewer frames than needed to keep the air busy; 0 (false) otherwise.
+ */
+static uint8_t pacingRoom(void) {
+	return (pacing.depth < COMMUNICATION_TX_TARGET_DEPTH);
+}
+
+
+/**
+ * Determine how long the Transmit Task may sleep before it has something to do.
+ *
+ * With the transmitter topped up, nothing is gained by waking before its oldest frames are sent:
+ * any frame sent earlier would only wait behind them. Otherwise, responses are checked for shortly.
+ *
+ * @param now The current time.
+ * @return The delay (in ticks).
+ */
+static portTickType pacingDelay(portTickType now) {
+
+	// the transmitter refused the last frame; give it time to send one
+	if (pacing.rejected)
+		return COMMUNICATION_TX_TASK_LONG_DELAY_MS / portTICK_RATE_MS;
+
+	// a stop-and-wait response cannot arrive before the frame it responds to has been sent
+	if (state.mode == commModeFileTransfer && !state.fileTransfer.window.active
+	&& !state.fileTransfer.transmitReady && (int32_t)(pacing.airFreeTime - now) > 0)
+		return pacing.airFreeTime - now;
+
+	if (pacingRoom())
+		return COMMUNICATION_TX_TASK_SHORT_DELAY_MS / portTICK_RATE_MS;
+
+	// wake when the buffer drops below the target depth
+	uint8_t index = (pacing.head + pacing.depth - COMMUNICATION_TX_TARGET_DEPTH) % TRANCEIVER_TX_MAX_FRAME_COUNT;
+	portTickType delay = pacing.done[index] - now;
+	if ((int32_t)delay <= 0)
+		delay = 1;
+
+	return delay;
+}
@@ -10,6 +10,52 @@
 #include <stdint.h>
 
 
+/***************************************************************************************************
+                                            DEFINITIONS
+***************************************************************************************************/
+
+/** Maximum amount of consecutive NACKs (or windowed transmission errors) before transmission is aborted. */
+#define NACK_ERROR_LIMIT		((uint8_t)15)
+
+
+/** Receive Task statistics; measure the I2C bus usage of polling the Transceiver. */
+typedef struct _communication_rx_stats_t {
+	uint32_t polls;				///< Number of times the receiver's buffer was checked for frames
+	uint32_t emptyPolls;		///< Number of checks that found no frames
+	uint32_t framesDrained;		///< Number of frames obtained from the receiver's buffer
+	uint32_t i2cTransactions;	///< Number of Transceiver operations (each is an I2C write-read)
+	uint32_t i2cTimeMs;			///< Time spent in Transceiver operations (ms; limited to tick resolution)
+} communication_rx_stats_t;
+
+
+/** Number of buckets in the ACK-to-send latency histogram. */
+#define COMMUNICATION_TX_LATENCY_BUCKETS	(8)
+
+/** Histogram of the time between receiving an ACK/NACK and sending the next File Transfer frame. */
+typedef struct _communication_tx_latency_t {
+	uint32_t buckets[COMMUNICATION_TX_LATENCY_BUCKETS];	///< Counts for 0, 1, 2, 3-4, 5-8, 9-16, 17-32 and 33+ ms
+	uint32_t samples;									///< Total number of measurements
+	uint32_t maxMs;										///< Longest measurement (ms)
+} communication_tx_latency_t;
+
+
+/** Transmit Task statistics; measure how well the transmitter is kept busy (and the task asleep). */
+typedef struct _communication_tx_stats_t {
+	uint32_t wakeups;			///< Number of times the Transmit Task woke up during a pass
+	uint32_t idleWakeups;		///< Number of wake-ups during which nothing was sent
+	uint32_t framesSent;		///< Number of frames accepted by the transmitter
+	uint32_t framesRejected;	///< Number of frames refused by the transmitter (e.g. its buffer was full)
+	uint32_t depthSum;			///< Sum of the transmitter's buffer depth after every frame sent (see framesSent)
+	uint32_t depthMax;			///< Deepest the transmitter's buffer was after a frame was sent
+	uint32_t airBusyMs;			///< Time the transmitter was predicted to be sending (ms)
+	uint32_t airIdleMs;			///< Time the transmitter was predicted to be idle during the File Transfer (ms)
+	uint32_t framesResent;		///< Number of File Transfer frames sent again (after a NACK, timeout or loss)
+	uint32_t nacksReceived;		///< Number of NACKs received (including unreadable stop-and-wait responses)
+	uint32_t errorStreakMax;	///< Most consecutive transmission errors; the pass is aborted beyond NACK_ERROR_LIMIT
+	uint32_t passesAborted;		///< Number of passes aborted for exceeding NACK_ERROR_LIMIT
+} communication_tx_stats_t;
+
+
 /***************************************************************************************************
                                            FREERTOS TASKS
 ***************************************************************************************************/
@@ -23,6 +69,10 @@ void CommunicationTxTask(void* parameters);
 ***************************************************************************************************/
 
 uint8_t communicationPassModeActive(void);
+void communicationRxStats(communication_rx_stats_t* stats, uint8_t reset);
+void communicationTxLatency(communication_tx_latency_t* latency, uint8_t reset);
+void communicationTxStats(communication_tx_stats_t* stats, uint8_t reset);
+void communicationEndPass(void);
 
 
 #endif /* RCOMMUNICATIONTASKS_H_ */
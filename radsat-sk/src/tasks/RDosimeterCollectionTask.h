@@ -1,19 +1,19 @@
-/**
- * @file RDosimeterCollectionTask.h
- * @date December 28, 2021
- * @author Tyrel Kostyk (tck290) and Isaac Poirier (iap992)
- */
-
-
-#ifndef RPAYLOADCOLLECTIONTASK_H_
-#define RPAYLOADCOLLECTIONTASK_H_
-
-
-/***************************************************************************************************
-                                           FREERTOS TASKS
-***************************************************************************************************/
-
-void DosimeterCollectionTask(void* parameters);
-
-
-#endif /* RPAYLOADCOLLECTIONTASK_H_ */
+/**
+ * @file RDosimeterCollectionTask.h
+ * @date December 28, 2021
+ * @author Tyrel Kostyk (tck290) and Isaac Poirier (iap992)
+ */
+
+
+#ifndef RPAYLOADCOLLECTIONTASK_H_
+#define RPAYLOADCOLLECTIONTASK_H_
+
+
+/***************************************************************************************************
+                                           FREERTOS TASKS
+***************************************************************************************************/
+
+void DosimeterCollectionTask(void* parameters);
+
+
+#endif /* RPAYLOADCOLLECTIONTASK_H_ */
@@ -1,18 +1,18 @@
-/**
- * @file RImageCaptureTask.h
- * @date February 27, 2022
- * @author Tyrel Kostyk (tck290)
- */
-
-#ifndef RIMAGECAPTURETASK_H_
-#define RIMAGECAPTURETASK_H_
-
-
-/***************************************************************************************************
-                                           FREERTOS TASKS
-***************************************************************************************************/
-
-void ImageCaptureTask(void* parameters);
-
-
-#endif /* RIMAGECAPTURETASK_H_ */
+/**
+ * @file RImageCaptureTask.h
+ * @date February 27, 2022
+ * @author Tyrel Kostyk (tck290)
+ */
+
+#ifndef RIMAGECAPTURETASK_H_
+#define RIMAGECAPTURETASK_H_
+
+
+/***************************************************************************************************
+                                           FREERTOS TASKS
+***************************************************************************************************/
+
+void ImageCaptureTask(void* parameters);
+
+
+#endif /* RIMAGECAPTURETASK_H_ */
@@ -1,18 +1,18 @@
-/**
- * @file RSatelliteWatchdog.h
- * @date February 27, 2022
- * @author Tyrel Kostyk (tck290)
- */
-
-#ifndef RSATELLITEWATCHDOGTASK_H_
-#define RSATELLITEWATCHDOGTASK_H_
-
-
-/***************************************************************************************************
-                                           FREERTOS TASKS
-***************************************************************************************************/
-
-void SatelliteWatchdogTask(void* parameters);
-
-
-#endif /* RSATELLITEWATCHDOGTASK_H_ */
+/**
+ * @file RSatelliteWatchdog.h
+ * @date February 27, 2022
+ * @author Tyrel Kostyk (tck290)
+ */
+
+#ifndef RSATELLITEWATCHDOGTASK_H_
+#define RSATELLITEWATCHDOGTASK_H_
+
+
+/***************************************************************************************************
+                                           FREERTOS TASKS
+***************************************************************************************************/
+
+void SatelliteWatchdogTask(void* parameters);
+
+
+#endif /* RSATELLITEWATCHDOGTASK_H_ */
@@ -1,18 +1,18 @@
-/**
- * @file RTelemetryCollectionTask.h
- * @date February 27, 2022
- * @author Tyrel Kostyk (tck290)
- */
-
-#ifndef RTELEMETRYCOLLECTIONTASK_H_
-#define RTELEMETRYCOLLECTIONTASK_H_
-
-
-/***************************************************************************************************
-                                           FREERTOS TASKS
-***************************************************************************************************/
-
-void TelemetryCollectionTask(void* parameters);
-
-
-#endif /* RTELEMETRYCOLLECTIONTASK_H_ */
+/**
+ * @file RTelemetryCollectionTask.h
+ * @date February 27, 2022
+ * @author Tyrel Kostyk (tck290)
+ */
+
+#ifndef RTELEMETRYCOLLECTIONTASK_H_
+#define RTELEMETRYCOLLECTIONTASK_H_
+
+
+/***************************************************************************************************
+                                           FREERTOS TASKS
+***************************************************************************************************/
+
+void TelemetryCollectionTask(void* parameters);
+
+
+#endif /* RTELEMETRYCOLLECTIONTASK_H_ */
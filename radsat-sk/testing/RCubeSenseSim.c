@@ -0,0 +1,442 @@
+/**
+ * @file RCubeSenseSim.c
+ * @date October 17, 2026
+ * @author
+ *
+ * Stand-in for the UART module (see RUart.c) that models the CubeSense camera on the other end of
+ * the camera bus, so that image downloads can be exercised (and timed) without a camera.
+ *
+ * Every byte occupies the bus for its time at the configured baud rate, in both directions. The
+ * camera answers telecommands and telemetry requests in its framing (escaped, between start and
+ * end identifiers), and takes the configured time to load each image frame once it is requested
+ * (TC 64 and TC 65); until then, the frame info (TLM 65) still names the previous frame. Image
+ * frames hold a known pattern (see @sa cubeSenseSimImageByte), which includes escape characters.
+ *
+ * Enabled by defining CUBESENSE_SIMULATION in the Test build configuration, which also removes
+ * the actual UART module from the build.
+ */
+
+#ifdef CUBESENSE_SIMULATION
+
+#include <RCubeSenseSim.h>
+#include <RCameraCommon.h>
+#include <RCommon.h>
+#include <hal/errors.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <string.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** Default baud rate of the camera bus (bps); as configured in RUart.c. */
+#define SIM_DEFAULT_BAUD_RATE	((uint32_t)57600)
+
+/** Bits sent on the bus per byte (start bit, 8 data bits, stop bit). */
+#define SIM_BITS_PER_BYTE		((uint64_t)10)
+
+/** Bytes of the image held in each image frame. */
+#define SIM_FRAME_BYTES			(128)
+
+/** Largest message handled in either direction, once escaped (bytes). */
+#define SIM_MESSAGE_MAX_SIZE	(2 * SIM_FRAME_BYTES + 8)
+
+/** Size of the buffer of replies waiting to be read (bytes). */
+#define SIM_RX_BUFFER_SIZE		(1024)
+
+/** Frame number reported before any image frame has been loaded. */
+#define SIM_NO_FRAME			((uint16_t)0xFFFF)
+
+/** Telecommand and telemetry IDs modelled by the simulation. */
+#define SIM_TC_IMAGE_CAPTURE	((uint8_t)0x15)		///< TC 21
+#define SIM_TC_INIT_DOWNLOAD	((uint8_t)0x40)		///< TC 64
+#define SIM_TC_ADVANCE_DOWNLOAD	((uint8_t)0x41)		///< TC 65
+#define SIM_TLM_ACKNOWLEDGE		((uint8_t)0x83)		///< TLM 3
+#define SIM_TLM_IMAGE_FRAME		((uint8_t)0xC0)		///< TLM 64
+#define SIM_TLM_IMAGE_FRAME_INFO	((uint8_t)0xC1)	///< TLM 65
+
+/** IDs from here on are telemetry requests; telecommands below. */
+#define SIM_TLM_FIRST_ID		((uint8_t)0x80)
+
+
+/** State of the simulated camera. */
+typedef struct _sim_camera_t {
+	uint16_t framesCount;		///< Number of frames in the image being downloaded; 0 if none
+	uint16_t loadedFrame;		///< Frame held in the camera's buffer; SIM_NO_FRAME if none
+	uint16_t loadingFrame;		///< Frame being loaded into the camera's buffer; SIM_NO_FRAME if none
+	portTickType readyTime;		///< Time at which the frame being loaded is ready
+	uint8_t lastTelecommand;	///< ID of the last telecommand received
+	uint8_t lastError;			///< Error flag of the last telecommand received
+} sim_camera_t;
+
+
+/** Current camera and bus settings */
+static cubesense_sim_config_t config = { 0 };
+
+/** Current statistics */
+static cubesense_sim_stats_t stats = { 0 };
+
+/** Current camera state */
+static sim_camera_t camera = { 0 };
+
+/** Replies waiting to be read from the bus */
+static uint8_t rxBuffer[SIM_RX_BUFFER_SIZE];
+static uint16_t rxHead = 0;
+static uint16_t rxCount = 0;
+
+/** Time (in microseconds) at which the bus finishes carrying the bytes given to it */
+static uint64_t busFreeUs = 0;
+
+/** Whether the camera bus has been initialized */
+static uint8_t initialized = 0;
+
+/** State of the jitter generator */
+static uint32_t randomState = 1;
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static void simBusTransfer(uint16_t size);
+static uint32_t simRandom(void);
+static void simUpdate(void);
+static void simRequestFrame(uint16_t frame);
+static void simHandleMessage(const uint8_t* message, uint16_t size);
+static void simReply(const uint8_t* data, uint16_t size);
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+/**
+ * Reset the simulated camera and bus, applying new settings.
+ *
+ * @param newConfig The new settings. NULL resets to a 57600 baud bus and frames loaded instantly.
+ */
+void cubeSenseSimConfigure(const cubesense_sim_config_t* newConfig) {
+	memset(&config, 0, sizeof(config));
+	if (newConfig != 0)
+		config = *newConfig;
+	if (config.baudRate == 0)
+		config.baudRate = SIM_DEFAULT_BAUD_RATE;
+
+	memset(&stats, 0, sizeof(stats));
+	memset(&camera, 0, sizeof(camera));
+	camera.loadedFrame = SIM_NO_FRAME;
+	camera.loadingFrame = SIM_NO_FRAME;
+	rxHead = 0;
+	rxCount = 0;
+	busFreeUs = (uint64_t)xTaskGetTickCount() * 1000;
+	randomState = (config.seed != 0) ? config.seed : 1;
+}
+
+
+/**
+ * Provide the statistics gathered since the last configuration.
+ *
+ * @param statsOut Buffer for the statistics. Set by function.
+ */
+void cubeSenseSimStats(cubesense_sim_stats_t* statsOut) {
+	if (statsOut == 0)
+		return;
+
+	*statsOut = stats;
+}
+
+
+/**
+ * Provide a byte of the simulated image; every image holds the same pattern.
+ *
+ * @param frame The index of the image frame.
+ * @param offset The offset of the byte within the frame.
+ * @return The byte.
+ */
+uint8_t cubeSenseSimImageByte(uint16_t frame, uint8_t offset) {
+	return (uint8_t)(frame * 31 + offset * 7);
+}
+
+
+/**
+ * Queue a reply to be read from the bus, as if the camera had sent it (i.e. telemetry it does not
+ * model, or contents chosen by a test).
+ *
+ * @param data The contents of the reply; escaped and framed as the camera would.
+ * @param size The size of the contents (in bytes).
+ */
+void cubeSenseSimQueueReply(const uint8_t* data, uint16_t size) {
+	if (data == 0)
+		return;
+
+	simReply(data, size);
+}
+
+
+/**
+ * Initializes the camera bus (stands in for the UART module).
+ *
+ * @param bus The bus to initialize; only the camera bus is modelled.
+ * @return 0 for success, non-zero for failure.
+ */
+int uartInit(UARTbus bus) {
+	if (bus != UART_CAMERA_BUS)
+		return E_GENERIC;
+
+	initialized = 1;
+	return SUCCESS;
+}
+
+
+/**
+ * Sends a message to the simulated camera, taking its time on the bus. Each call holds a single
+ * message, as sent by the camera drivers.
+ *
+ * @param bus The bus to send over; only the camera bus is modelled.
+ * @param data The message.
+ * @param size The size of the message (in bytes).
+ * @return 0 for success, non-zero for failure.
+ */
+int uartTransmit(UARTbus bus, const uint8_t* data, uint16_t size) {
+	if (bus != UART_CAMERA_BUS || !initialized)
+		return E_NOT_INITIALIZED;
+
+	if (data == 0)
+		return E_INPUT_POINTER_NULL;
+
+	simBusTransfer(size);
+	simHandleMessage(data, size);
+
+	return SUCCESS;
+}
+
+
+/**
+ * Receives the replies of the simulated camera, taking their time on the bus. Bytes the camera
+ * never sent read as zero, as a bus that timed out would leave them.
+ *
+ * @param bus The bus to receive from; only the camera bus is modelled.
+ * @param data A buffer to store the received data in.
+ * @param size The number of bytes to receive.
+ * @return 0 for success, non-zero for failure.
+ */
+int uartReceive(UARTbus bus, uint8_t* data, uint16_t size) {
+	if (bus != UART_CAMERA_BUS || !initialized)
+		return E_NOT_INITIALIZED;
+
+	if (data == 0)
+		return E_INPUT_POINTER_NULL;
+
+	for (uint16_t i = 0; i < size; i++) {
+		if (rxCount == 0) {
+			data[i] = 0;
+			continue;
+		}
+		data[i] = rxBuffer[rxHead];
+		rxHead = (rxHead + 1) % SIM_RX_BUFFER_SIZE;
+		rxCount--;
+	}
+
+	stats.receiveCalls++;
+	simBusTransfer(size);
+
+	return SUCCESS;
+}
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Occupy the bus with bytes, blocking the calling Task until they have been carried.
+ *
+ * @param size The number of bytes.
+ */
+static void simBusTransfer(uint16_t size) {
+	uint64_t nowUs = (uint64_t)xTaskGetTickCount() * 1000;
+	if (busFreeUs < nowUs)
+		busFreeUs = nowUs;
+
+	busFreeUs += (size * SIM_BITS_PER_BYTE * 1000000) / config.baudRate;
+	stats.bytesTransferred += size;
+
+	// wait (in whole ticks) until the bus is done with the bytes
+	portTickType doneTime = (portTickType)((busFreeUs + 999) / 1000);
+	portTickType now = xTaskGetTickCount();
+	if (doneTime > now)
+		vTaskDelay(doneTime - now);
+}
+
+
+/**
+ * Provide a random number.
+ *
+ * @return The next number of the jitter generator.
+ */
+static uint32_t simRandom(void) {
+
+	// xorshift32
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+
+	return randomState;
+}
+
+
+/**
+ * Bring the camera up to the current time; a frame being loaded lands in the buffer once ready.
+ */
+static void simUpdate(void) {
+	if (camera.loadingFrame == SIM_NO_FRAME)
+		return;
+
+	if ((int32_t)(xTaskGetTickCount() - camera.readyTime) < 0)
+		return;
+
+	camera.loadedFrame = camera.loadingFrame;
+	camera.loadingFrame = SIM_NO_FRAME;
+	stats.framesLoaded++;
+}
+
+
+/**
+ * Start loading an image frame into the camera's buffer.
+ *
+ * @param frame The index of the frame.
+ */
+static void simRequestFrame(uint16_t frame) {
+	uint16_t jitter = (config.frameJitterMs > 0) ? (uint16_t)(simRandom() % (config.frameJitterMs + 1)) : 0;
+
+	camera.loadingFrame = frame;
+	camera.readyTime = xTaskGetTickCount() + config.frameLatencyMs + jitter;
+	simUpdate();
+}
+
+
+/**
+ * Act on a message received by the camera, and queue its reply.
+ *
+ * @param message The message, as sent (escaped, with its start and end identifiers).
+ * @param size The size of the message (in bytes).
+ */
+static void simHandleMessage(const uint8_t* message, uint16_t size) {
+	uint8_t data[SIM_MESSAGE_MAX_SIZE];
+	uint16_t dataSize = 0;
+
+	if (size < BASE_MESSAGE_LEN + 1 || message[0] != ESCAPE_CHARACTER || message[1] != START_IDENTIFIER)
+		return;
+
+	// remove the escape characters between the start and end identifiers
+	for (uint16_t i = MESSAGE_ID_OFFSET; i < size - 2 && dataSize < sizeof(data); i++) {
+		data[dataSize++] = message[i];
+		if (message[i] == ESCAPE_CHARACTER && i + 1 < size - 2 && message[i + 1] == ESCAPE_CHARACTER)
+			i++;
+	}
+
+	uint8_t id = data[0];
+	simUpdate();
+
+	// telemetry requests are answered with their telemetry
+	if (id >= SIM_TLM_FIRST_ID) {
+		stats.telemetryRequests++;
+
+		uint8_t reply[SIM_FRAME_BYTES] = { 0 };
+		uint16_t replySize = 0;
+
+		if (id == SIM_TLM_IMAGE_FRAME_INFO) {
+			stats.frameInfoRequests++;
+
+			uint8_t checksum = 0;
+			for (uint8_t i = 0; i < SIM_FRAME_BYTES && camera.loadedFrame != SIM_NO_FRAME; i++)
+				checksum += cubeSenseSimImageByte(camera.loadedFrame, i);
+
+			memcpy(&reply[0], &camera.loadedFrame, sizeof(camera.loadedFrame));
+			reply[2] = checksum;
+			replySize = 3;
+		}
+		else if (id == SIM_TLM_IMAGE_FRAME) {
+			for (uint8_t i = 0; i < SIM_FRAME_BYTES && camera.loadedFrame != SIM_NO_FRAME; i++)
+				reply[i] = cubeSenseSimImageByte(camera.loadedFrame, i);
+
+			replySize = SIM_FRAME_BYTES;
+			if (camera.loadedFrame != SIM_NO_FRAME)
+				stats.framesSent++;
+		}
+		else if (id == SIM_TLM_ACKNOWLEDGE) {
+			reply[0] = camera.lastTelecommand;
+			reply[1] = 1;
+			reply[2] = camera.lastError;
+			replySize = 3;
+		}
+
+		// other telemetry is not modelled; it is never answered
+		if (replySize > 0)
+			simReply(reply, replySize);
+		return;
+	}
+
+	// telecommands are acted on, then answered with their error flag
+	stats.telecommands++;
+	uint8_t error = 0;
+
+	if (id == SIM_TC_INIT_DOWNLOAD && dataSize >= 4) {
+		uint8_t imageSize = data[3];
+		if (imageSize > 4) {
+			error = 1;
+		}
+		else {
+			uint32_t side = 1024 >> imageSize;
+			camera.framesCount = (uint16_t)((side * side) / SIM_FRAME_BYTES);
+			camera.loadedFrame = SIM_NO_FRAME;
+			simRequestFrame(0);
+		}
+	}
+	else if (id == SIM_TC_ADVANCE_DOWNLOAD && dataSize >= 3) {
+		uint16_t frame = 0;
+		memcpy(&frame, &data[1], sizeof(frame));
+		if (frame >= camera.framesCount)
+			error = 1;
+		else
+			simRequestFrame(frame);
+	}
+
+	camera.lastTelecommand = id;
+	camera.lastError = error;
+	simReply(&error, 1);
+}
+
+
+/**
+ * Queue a reply to be read from the bus, in the camera's framing (escaped).
+ *
+ * @param data The contents of the reply.
+ * @param size The size of the contents (in bytes).
+ */
+static void simReply(const uint8_t* data, uint16_t size) {
+	uint8_t reply[SIM_MESSAGE_MAX_SIZE];
+	uint16_t replySize = 0;
+
+	reply[replySize++] = ESCAPE_CHARACTER;
+	reply[replySize++] = START_IDENTIFIER;
+	for (uint16_t i = 0; i < size && replySize < sizeof(reply) - 3; i++) {
+		reply[replySize++] = data[i];
+		if (data[i] == ESCAPE_CHARACTER)
+			reply[replySize++] = ESCAPE_CHARACTER;
+	}
+	reply[replySize++] = ESCAPE_CHARACTER;
+	reply[replySize++] = END_IDENTIFIER;
+
+	for (uint16_t i = 0; i < replySize && rxCount < SIM_RX_BUFFER_SIZE; i++) {
+		rxBuffer[(rxHead + rxCount) % SIM_RX_BUFFER_SIZE] = reply[i];
+		rxCount++;
+	}
+}
+
+
+#endif /* CUBESENSE_SIMULATION */
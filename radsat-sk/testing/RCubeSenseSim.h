@@ -0,0 +1,50 @@
+/**
+ * @file RCubeSenseSim.h
+ * @date October 17, 2026
+ * @author
+ */
+
+#ifndef RCUBESENSESIM_H_
+#define RCUBESENSESIM_H_
+
+#include <stdint.h>
+#include <RUart.h>
+
+
+/***************************************************************************************************
+                                            DEFINITIONS
+***************************************************************************************************/
+
+/** Camera and bus settings of the simulated CubeSense. */
+typedef struct _cubesense_sim_config_t {
+	uint32_t baudRate;			///< Baud rate of the camera bus (bps); 57600 when set to 0
+	uint16_t frameLatencyMs;	///< Time taken by the camera to load a requested image frame (ms)
+	uint16_t frameJitterMs;		///< Up to this much more time, at random, taken to load each image frame (ms)
+	uint32_t seed;				///< Seed of the jitter generator; runs with the same seed load frames alike
+} cubesense_sim_config_t;
+
+
+/** Statistics gathered by the simulated CubeSense. */
+typedef struct _cubesense_sim_stats_t {
+	uint32_t telecommands;		///< Telecommands received
+	uint32_t telemetryRequests;	///< Telemetry requests received (including frame info requests)
+	uint32_t frameInfoRequests;	///< Image frame info requests (TLM 65) received
+	uint32_t framesLoaded;		///< Image frames loaded into the camera's buffer
+	uint32_t framesSent;		///< Image frames sent (TLM 64)
+	uint32_t bytesTransferred;	///< Bytes carried by the bus, both ways (including escape characters)
+	uint32_t receiveCalls;		///< Reads made from the bus (calls to uartReceive)
+} cubesense_sim_stats_t;
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+void cubeSenseSimConfigure(const cubesense_sim_config_t* config);
+void cubeSenseSimStats(cubesense_sim_stats_t* stats);
+
+uint8_t cubeSenseSimImageByte(uint16_t frame, uint8_t offset);
+void cubeSenseSimQueueReply(const uint8_t* data, uint16_t size);
+
+
+#endif /* RCUBESENSESIM_H_ */
@@ -1,20 +1,20 @@
-/**
- * @file RTestSuite.h
- * @date December 29, 2021
- * @author Tyrel Kostyk (tck290) and Austin Hruska (jah385)
- */
-
-#ifndef RTESTSUITE_H_
-#define RTESTSUITE_H_
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-int testSuiteRunAll(void);
-
-int selectAndExecuteTests(void);
-
-
-#endif /* RTESTSUITE_H_ */
+/**
+ * @file RTestSuite.h
+ * @date December 29, 2021
+ * @author Tyrel Kostyk (tck290) and Austin Hruska (jah385)
+ */
+
+#ifndef RTESTSUITE_H_
+#define RTESTSUITE_H_
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+int testSuiteRunAll(void);
+
+int selectAndExecuteTests(void);
+
+
+#endif /* RTESTSUITE_H_ */
@@ -0,0 +1,897 @@
+/**
+ * @file RTransceiverSim.c
+ * @date October 16, 2026
+ * @author
+ *
+ * Stand-in for the Transceiver module (see RTransceiver.c) that models the radio link and a Ground
+ * Station entirely on the OBC, so that the communication Tasks can be exercised without a radio.
+ *
+ * Downlink frames occupy the transmitter's buffer for their airtime at the configured bitrate,
+ * reach the Ground Station after the configured latency, and may be lost (or corrupted) along the
+ * way. The Ground
+ * Station answers File Transfer frames exactly as described by the protocol (ACK/NACK per frame,
+ * or Selective ACKs when windowed), with its responses subject to the same latency, loss and
+ * corruption. Damaged frames are repaired from their parity bytes when they carry any (see
+ * RReedSolomon.c). Responses to telecommands are counted, so that telecommand exchanges can be timed.
+ *
+ * Enabled by defining TRANSCEIVER_SIMULATION in the Test build configuration, which also removes
+ * the actual Transceiver module from the build.
+ */
+
+#ifdef TRANSCEIVER_SIMULATION
+
+#include <RTransceiverSim.h>
+#include <RMessage.h>
+#include <RTelecommandService.h>
+#include <RReedSolomon.h>
+#include <RXorCipher.h>
+#include <RCommon.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+#include <string.h>
+#include <hal/Timing/Time.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** Default downlink bitrate (bps). */
+#define SIM_DEFAULT_BITRATE		((uint16_t)TRANCEIVER_TX_BITRATE)
+
+/** Bytes added to every downlink frame by the AX.25 framing (addresses, control, FCS, flags). */
+#define SIM_AX25_OVERHEAD		((uint32_t)TRANCEIVER_TX_FRAME_OVERHEAD)
+
+/** Number of downlink frames that can be tracked at once (in the transmitter's buffer or in the air). */
+#define SIM_TX_QUEUE_SIZE		((uint16_t)128)
+
+/** Time (in ms) the Ground Station waits for a downlink frame before repeating its last response. */
+#define SIM_GROUND_TIMEOUT_MS	((uint32_t)3000)
+
+
+/** A single frame on its way through the simulated link. */
+typedef struct _sim_frame_t {
+	uint8_t size;								///< Size of the frame (in bytes)
+	uint8_t data[TRANCEIVER_TX_MAX_FRAME_SIZE];	///< Contents of the frame
+	portTickType time;							///< Time at which the frame leaves the transmitter (downlink) or arrives (uplink)
+} sim_frame_t;
+
+
+/** State of the simulated Ground Station. */
+typedef struct _sim_ground_t {
+	uint8_t active;				///< Whether the File Transfer has been started by the Ground Station
+	uint8_t expected;			///< Sequence number of the oldest frame not yet received (windowed)
+	uint64_t received;			///< Frames received beyond the expected frame (windowed); see selective_ack
+	portTickType lastActivity;	///< Time of the last downlink frame (or response) of the Ground Station
+	uint8_t lastFrameSize;		///< Size of the last frame received (stop-and-wait duplicate detection)
+	uint8_t lastFrame[TRANCEIVER_TX_MAX_FRAME_SIZE];	///< Last frame received (stop-and-wait duplicate detection)
+} sim_ground_t;
+
+
+/** Current link and Ground Station settings */
+static transceiver_sim_config_t config = { 0 };
+
+/** Current statistics */
+static transceiver_sim_stats_t stats = { 0 };
+
+/** Current Ground Station state */
+static sim_ground_t ground = { 0 };
+
+/** Downlink frames; ordered by the time they leave the transmitter */
+static sim_frame_t txQueue[SIM_TX_QUEUE_SIZE];
+static uint16_t txHead = 0;
+static uint16_t txCount = 0;
+
+/** Time at which the transmitter finishes sending all frames in its buffer */
+static portTickType txBusyUntil = 0;
+
+/** Uplink frames; ordered by the time they arrive in the receiver's buffer */
+static sim_frame_t rxQueue[TRANCEIVER_RX_MAX_FRAME_COUNT];
+static uint16_t rxHead = 0;
+static uint16_t rxCount = 0;
+
+/** State of the loss generator */
+static uint32_t randomState = 1;
+
+/** Guards the simulated link; it is shared by the communication Tasks and the test */
+static xSemaphoreHandle simMutex = NULL;
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static void simLock(void);
+static void simUnlock(void);
+static void simUpdate(void);
+static uint32_t simRandom(void);
+static uint8_t simChance(uint8_t percent);
+static void simCorrupt(uint8_t* frame, uint8_t size);
+static uint8_t simBitErrors(uint8_t* frame, uint8_t size);
+static uint8_t simTxSlotsRemaining(portTickType now);
+static int simQueueUplink(uint8_t* frame, uint8_t size);
+static void simFillTelecommand(uint16_t telecommandTag, telecommand_message* telecommand);
+static int simUplinkMessage(radsat_message* rawMessage);
+
+static void groundReceive(uint8_t* frame, uint8_t size);
+static void groundReceiveResponse(uint8_t* frame, uint8_t size);
+static uint8_t groundValidFrame(uint8_t* frame, uint8_t size);
+static void groundRespond(void);
+static int groundSendProtocol(uint16_t messageTag, uint8_t lossy);
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+/**
+ * Reset the simulated link and Ground Station, applying new settings.
+ *
+ * @param newConfig The new settings. NULL resets to a lossless 9600 bps link using stop-and-wait.
+ */
+void transceiverSimConfigure(const transceiver_sim_config_t* newConfig) {
+	if (simMutex == NULL)
+		simMutex = xSemaphoreCreateMutex();
+
+	simLock();
+
+	memset(&config, 0, sizeof(config));
+	if (newConfig != 0)
+		config = *newConfig;
+	if (config.bitrate == 0)
+		config.bitrate = SIM_DEFAULT_BITRATE;
+	if (config.windowSize > TRANCEIVER_TX_MAX_FRAME_COUNT)
+		config.windowSize = TRANCEIVER_TX_MAX_FRAME_COUNT;
+
+	memset(&stats, 0, sizeof(stats));
+	memset(&ground, 0, sizeof(ground));
+	txHead = 0;
+	txCount = 0;
+	rxHead = 0;
+	rxCount = 0;
+	txBusyUntil = xTaskGetTickCount();
+	randomState = (config.seed != 0) ? config.seed : 1;
+
+	simUnlock();
+}
+
+
+/**
+ * Provide the statistics gathered since the last configuration.
+ *
+ * @param statsOut Buffer for the statistics. Set by function.
+ */
+void transceiverSimStats(transceiver_sim_stats_t* statsOut) {
+	if (statsOut == 0)
+		return;
+
+	simLock();
+	simUpdate();
+	*statsOut = stats;
+	simUnlock();
+}
+
+
+/**
+ * Send a raw frame from the Ground Station; it arrives after the configured latency, without loss.
+ *
+ * @param frame The (already wrapped and encrypted) frame.
+ * @param size The size of the frame (in bytes).
+ * @return 0 on success, otherwise an error.
+ */
+int transceiverSimUplink(uint8_t* frame, uint8_t size) {
+	simLock();
+	int error = simQueueUplink(frame, size);
+	simUnlock();
+
+	return error;
+}
+
+
+/**
+ * Send a telecommand from the Ground Station, without loss.
+ *
+ * Telecommands carry no arguments, except for Begin Pass, which asks for compact headers and parity
+ * bytes if configured to, and Update Time, which carries the current time.
+ *
+ * @param telecommandTag The tag of the telecommand to send.
+ * @return 0 on success, otherwise an error.
+ */
+int transceiverSimUplinkTelecommand(uint16_t telecommandTag) {
+	radsat_message rawMessage = { 0 };
+	rawMessage.which_service = radsat_message_TelecommandMessage_tag;
+	simFillTelecommand(telecommandTag, &rawMessage.TelecommandMessage);
+
+	return simUplinkMessage(&rawMessage);
+}
+
+
+/**
+ * Send several telecommands from the Ground Station in a single frame, without loss.
+ *
+ * @param telecommandTags The tags of the telecommands to send, in order of execution.
+ * @param count The number of telecommands (at most TELECOMMAND_BATCH_MAX).
+ * @return 0 on success, otherwise an error.
+ */
+int transceiverSimUplinkTelecommands(const uint16_t* telecommandTags, uint8_t count) {
+	if (telecommandTags == 0)
+		return E_INPUT_POINTER_NULL;
+
+	if (count == 0 || count > TELECOMMAND_BATCH_MAX)
+		return E_PARAM_OUTOFBOUNDS;
+
+	radsat_message rawMessage = { 0 };
+	rawMessage.which_service = radsat_message_TelecommandBatch_tag;
+	rawMessage.TelecommandBatch.Telecommands_count = count;
+	for (uint8_t i = 0; i < count; i++)
+		simFillTelecommand(telecommandTags[i], &rawMessage.TelecommandBatch.Telecommands[i]);
+
+	return simUplinkMessage(&rawMessage);
+}
+
+
+/**
+ * Have the Ground Station start receiving File Transfer frames.
+ *
+ * Sends the first response of the File Transfer phase: a Selective ACK (carrying the window size)
+ * when windowed, otherwise an ACK. The Satellite must already be in its File Transfer mode.
+ *
+ * @return 0 on success, otherwise an error.
+ */
+int transceiverSimStartFileTransfer(void) {
+	simLock();
+
+	ground.active = 1;
+	ground.expected = 0;
+	ground.received = 0;
+	ground.lastFrameSize = 0;
+	ground.lastActivity = xTaskGetTickCount();
+
+	// the first response is delivered reliably; the Satellite has nothing to resend yet
+	int error = groundSendProtocol((config.windowSize > 0) ? protocol_message_SelectiveAck_tag : protocol_message_Ack_tag, 0);
+
+	simUnlock();
+
+	return error;
+}
+
+
+/***************************************************************************************************
+                                    TRANSCEIVER MODULE REPLACEMENT
+***************************************************************************************************/
+
+/**
+ * Initializes the simulated Transceiver.
+ *
+ * @return	Error code; always 0.
+ */
+int transceiverInit(void) {
+	return SUCCESS;
+}
+
+
+/**
+ * Gets the number of frames that have arrived in the simulated receiver's buffer.
+ *
+ * @param	numberOfFrames The number of frames available in the receiver's buffer. Set by function.
+ * @return	Error code; 0 for success, otherwise see hal/errors.h.
+ */
+int transceiverRxFrameCount(uint16_t* numberOfFrames) {
+	if (numberOfFrames == 0)
+		return E_INPUT_POINTER_NULL;
+
+	simLock();
+	simUpdate();
+
+	portTickType now = xTaskGetTickCount();
+	uint16_t frames = 0;
+	while (frames < rxCount && (int32_t)(now - rxQueue[(rxHead + frames) % TRANCEIVER_RX_MAX_FRAME_COUNT].time) >= 0)
+		frames++;
+
+	*numberOfFrames = frames;
+	simUnlock();
+
+	return SUCCESS;
+}
+
+
+/**
+ * Gets next frame from the simulated receiver's buffer.
+ *
+ * @param	messageBuffer A byte array to copy the message into; must accept up to 200 bytes.
+ * @param	sizeOfMessage The size of the frame received (0 on failure or empty buffer). Set by function.
+ * @return	Error code; 0 for success, otherwise see hal/errors.h.
+ */
+int transceiverGetFrame(uint8_t* messageBuffer, uint16_t* sizeOfMessage) {
+	if (messageBuffer == 0 || sizeOfMessage == 0)
+		return E_INPUT_POINTER_NULL;
+
+	*sizeOfMessage = 0;
+
+	simLock();
+	simUpdate();
+
+	sim_frame_t* frame = &rxQueue[rxHead];
+	if (rxCount > 0 && (int32_t)(xTaskGetTickCount() - frame->time) >= 0) {
+		memcpy(messageBuffer, frame->data, frame->size);
+		*sizeOfMessage = frame->size;
+		rxHead = (rxHead + 1) % TRANCEIVER_RX_MAX_FRAME_COUNT;
+		rxCount--;
+	}
+
+	simUnlock();
+
+	return SUCCESS;
+}
+
+
+/**
+ * Sends a data frame to the simulated transmitter's buffer.
+ *
+ * @param	message Buffer that is to be transmitted; must be no longer than 235 bytes long.
+ * @param	messageSize The length of the outgoing message in bytes.
+ * @param	slotsRemaining Remaining slots in the transmitter's buffer. Set by function. Optional; set NULL to skip.
+ * @return	Error code; 0 for success, otherwise an error (e.g. the buffer is full).
+ */
+int transceiverSendFrame(uint8_t* message, uint8_t messageSize, uint8_t* slotsRemaining) {
+	if (message == 0)
+		return E_INPUT_POINTER_NULL;
+
+	if (messageSize == 0 || messageSize > TRANCEIVER_TX_MAX_FRAME_SIZE)
+		return E_PARAM_OUTOFBOUNDS;
+
+	simLock();
+	simUpdate();
+
+	portTickType now = xTaskGetTickCount();
+	int error = E_GENERIC;
+
+	// frames are only accepted while the transmitter's buffer has room
+	if (simTxSlotsRemaining(now) > 0 && txCount < SIM_TX_QUEUE_SIZE) {
+
+		// the frame is sent once all frames ahead of it are, taking its airtime at the bitrate
+		if ((int32_t)(txBusyUntil - now) < 0)
+			txBusyUntil = now;
+		uint32_t airtimeMs = ((messageSize + SIM_AX25_OVERHEAD) * 8 * 1000) / config.bitrate;
+		txBusyUntil += (portTickType)(airtimeMs / portTICK_RATE_MS);
+
+		sim_frame_t* frame = &txQueue[(txHead + txCount) % SIM_TX_QUEUE_SIZE];
+		memcpy(frame->data, message, messageSize);
+		frame->size = messageSize;
+		frame->time = txBusyUntil;
+		txCount++;
+
+		stats.framesSent++;
+		error = SUCCESS;
+	}
+
+	if (slotsRemaining != 0)
+		*slotsRemaining = simTxSlotsRemaining(now);
+
+	simUnlock();
+
+	return error;
+}
+
+
+/**
+ * Power cycles the simulated Transceiver, dropping all frames in its buffers.
+ *
+ * @return	Error code; always 0.
+ */
+int transceiverPowerCycle(void) {
+	simLock();
+	txCount = 0;
+	rxCount = 0;
+	simUnlock();
+
+	return SUCCESS;
+}
+
+
+/**
+ * Resets the simulated Transceiver, dropping all frames in its buffers.
+ *
+ * @return	Error code; always 0.
+ */
+int transceiverSoftReset(void) {
+	return transceiverPowerCycle();
+}
+
+
+/**
+ * Provides (empty) telemetry of the simulated Transceiver.
+ *
+ * @param telemetry A struct to hold the telemetry. Set by function.
+ * @return	Error code; 0 for success, otherwise see hal/errors.h.
+ */
+int transceiverTelemetry(transceiver_telemetry_t* telemetry) {
+	if (telemetry == 0)
+		return E_INPUT_POINTER_NULL;
+
+	memset(telemetry, 0, sizeof(transceiver_telemetry_t));
+	telemetry->rx.frames = rxCount;
+
+	return SUCCESS;
+}
+
+
+/**
+ * Resets the watchdogs of the simulated Transceiver.
+ *
+ * @return	Error code; always 0.
+ */
+int transceiverResetWatchDogs(void) {
+	return SUCCESS;
+}
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Obtain exclusive access to the simulated link.
+ */
+static void simLock(void) {
+	if (simMutex != NULL)
+		xSemaphoreTake(simMutex, portMAX_DELAY);
+}
+
+
+/**
+ * Release exclusive access to the simulated link.
+ */
+static void simUnlock(void) {
+	if (simMutex != NULL)
+		xSemaphoreGive(simMutex);
+}
+
+
+/**
+ * Advance the simulated link to the current time.
+ *
+ * Delivers all downlink frames that have reached the Ground Station, and lets the Ground Station
+ * repeat its last response if it has not heard from the Satellite in a while.
+ *
+ * @pre The simulated link must be locked by the caller.
+ */
+static void simUpdate(void) {
+	portTickType now = xTaskGetTickCount();
+	portTickType latency = (portTickType)(config.latencyMs / portTICK_RATE_MS);
+
+	// deliver downlink frames that have been sent and have propagated to the Ground Station
+	while (txCount > 0 && (int32_t)(now - (txQueue[txHead].time + latency)) >= 0) {
+		sim_frame_t* frame = &txQueue[txHead];
+
+		if (simChance(config.lossPercent)) {
+			stats.framesLost++;
+		}
+		else {
+			uint8_t corrupted = simChance(config.corruptPercent);
+			if (corrupted)
+				simCorrupt(frame->data, frame->size);
+			if (simBitErrors(frame->data, frame->size))
+				corrupted = 1;
+			if (corrupted)
+				stats.framesCorrupted++;
+
+			groundReceive(frame->data, frame->size);
+		}
+
+		txHead = (txHead + 1) % SIM_TX_QUEUE_SIZE;
+		txCount--;
+	}
+
+	// repeat the last response when the Satellite seems to have missed it
+	if (ground.active && (int32_t)(now - ground.lastActivity) > (int32_t)(SIM_GROUND_TIMEOUT_MS / portTICK_RATE_MS))
+		groundRespond();
+}
+
+
+/**
+ * Draw the next number of the (seeded) generator behind the impairments of the link.
+ *
+ * @return A pseudo-random number.
+ */
+static uint32_t simRandom(void) {
+
+	// xorshift32
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+
+	return randomState;
+}
+
+
+/**
+ * Decide whether a frame is affected by an impairment of the link (e.g. lost), at random.
+ *
+ * @param percent The chance of the impairment (0-100).
+ * @return 1 (true) if the frame is affected; 0 (false) otherwise.
+ */
+static uint8_t simChance(uint8_t percent) {
+	if (percent == 0)
+		return 0;
+
+	return ((simRandom() % 100) < percent);
+}
+
+
+/**
+ * Flip a single (random) bit of a frame.
+ *
+ * @param frame The frame to corrupt. Modified by function.
+ * @param size The size of the frame (in bytes).
+ */
+static void simCorrupt(uint8_t* frame, uint8_t size) {
+	uint32_t bit = simRandom() % ((uint32_t)size * 8);
+	frame[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+}
+
+
+/**
+ * Flip each bit of a frame independently, at the configured bit error rate.
+ *
+ * @param frame The frame to corrupt. Modified by function.
+ * @param size The size of the frame (in bytes).
+ * @return 1 (true) if any bit was flipped; 0 (false) otherwise.
+ */
+static uint8_t simBitErrors(uint8_t* frame, uint8_t size) {
+	if (config.bitErrorPpm == 0)
+		return 0;
+
+	uint8_t flipped = 0;
+	for (uint16_t bit = 0; bit < (uint16_t)size * 8; bit++) {
+		if ((simRandom() % 1000000) < config.bitErrorPpm) {
+			frame[bit / 8] ^= (uint8_t)(1 << (bit % 8));
+			flipped = 1;
+		}
+	}
+
+	return flipped;
+}
+
+
+/**
+ * Count the open slots of the transmitter's buffer (frames not yet fully sent occupy a slot).
+ *
+ * @param now The current time.
+ * @return The number of open slots.
+ */
+static uint8_t simTxSlotsRemaining(portTickType now) {
+	uint16_t occupied = 0;
+
+	for (uint16_t i = 0; i < txCount; i++) {
+		if ((int32_t)(txQueue[(txHead + i) % SIM_TX_QUEUE_SIZE].time - now) > 0)
+			occupied++;
+	}
+
+	if (occupied >= TRANCEIVER_TX_MAX_FRAME_COUNT)
+		return 0;
+
+	return (uint8_t)(TRANCEIVER_TX_MAX_FRAME_COUNT - occupied);
+}
+
+
+/**
+ * Place a frame into the receiver's buffer, arriving after the configured latency.
+ *
+ * @pre The simulated link must be locked by the caller.
+ * @param frame The frame to place.
+ * @param size The size of the frame (in bytes).
+ * @return 0 on success, otherwise an error.
+ */
+static int simQueueUplink(uint8_t* frame, uint8_t size) {
+	if (frame == 0)
+		return E_INPUT_POINTER_NULL;
+
+	if (size == 0 || size > TRANCEIVER_RX_MAX_FRAME_SIZE)
+		return E_PARAM_OUTOFBOUNDS;
+
+	// a full receiver drops incoming frames
+	if (rxCount >= TRANCEIVER_RX_MAX_FRAME_COUNT)
+		return E_GENERIC;
+
+	sim_frame_t* slot = &rxQueue[(rxHead + rxCount) % TRANCEIVER_RX_MAX_FRAME_COUNT];
+	memcpy(slot->data, frame, size);
+	slot->size = size;
+	slot->time = xTaskGetTickCount() + (portTickType)(config.latencyMs / portTICK_RATE_MS);
+	rxCount++;
+
+	return SUCCESS;
+}
+
+
+/**
+ * Fill in a telecommand as the Ground Station would send it (see @sa transceiverSimUplinkTelecommand).
+ *
+ * @param telecommandTag The tag of the telecommand.
+ * @param telecommand The telecommand. Set by function.
+ */
+static void simFillTelecommand(uint16_t telecommandTag, telecommand_message* telecommand) {
+	telecommand->which_message = telecommandTag;
+
+	// the Ground Station asks for compact headers and parity bytes when beginning a pass
+	if (telecommandTag == telecommand_message_BeginPass_tag) {
+		if (config.compactHeaders) {
+			unsigned int now = 0;
+			Time_getUnixEpoch(&now);
+			telecommand->BeginPass.compactHeaders = 1;
+			telecommand->BeginPass.compactBaseTime = now;
+		}
+		telecommand->BeginPass.fecParity = config.fecParity;
+	}
+
+	// the Ground Station's clock is the Satellite's own
+	if (telecommandTag == telecommand_message_UpdateTime_tag) {
+		unsigned int now = 0;
+		Time_getUnixEpoch(&now);
+		telecommand->UpdateTime.unixTime = now;
+	}
+}
+
+
+/**
+ * Wrap, encrypt and send a message from the Ground Station, without loss.
+ *
+ * @param rawMessage The message.
+ * @return 0 on success, otherwise an error.
+ */
+static int simUplinkMessage(radsat_message* rawMessage) {
+	uint8_t frame[TRANCEIVER_TX_MAX_FRAME_SIZE] = { 0 };
+	uint8_t size = messageWrap(rawMessage, frame);
+	if (size == 0)
+		return E_GENERIC;
+
+	// the cipher is symmetric; decrypting a plain message encrypts it
+	xorDecrypt(frame, size);
+
+	return transceiverSimUplink(frame, size);
+}
+
+
+/**
+ * Process a downlink frame at the Ground Station, responding as required by the protocol.
+ *
+ * @pre The simulated link must be locked by the caller.
+ * @param frame The downlink frame.
+ * @param size The size of the frame (in bytes).
+ */
+static void groundReceive(uint8_t* frame, uint8_t size) {
+
+	// repair the frame from its parity bytes; beyond repair, it is rejected by its CRC below
+	if (config.fecParity > 0) {
+		if (size <= config.fecParity)
+			return;
+
+		if (rsDecode(frame, size, config.fecParity) > 0 && ground.active)
+			stats.framesRepaired++;
+
+		size -= config.fecParity;
+	}
+
+	// frames sent before the File Transfer started are responses to telecommands
+	if (!ground.active) {
+		groundReceiveResponse(frame, size);
+		return;
+	}
+
+	ground.lastActivity = xTaskGetTickCount();
+
+	// stop-and-wait; one frame at a time, identical frames are repeats
+	if (config.windowSize == 0) {
+		uint8_t headerSize = groundValidFrame(frame, size);
+		if (headerSize == 0) {
+			groundSendProtocol(protocol_message_Nack_tag, 1);
+			return;
+		}
+
+		if (size == ground.lastFrameSize && memcmp(frame, ground.lastFrame, size) == 0) {
+			stats.framesDuplicate++;
+		}
+		else {
+			stats.framesDelivered++;
+			stats.bytesDelivered += size;
+			stats.payloadDelivered += size - headerSize;
+			memcpy(ground.lastFrame, frame, size);
+			ground.lastFrameSize = size;
+		}
+
+		groundSendProtocol(protocol_message_Ack_tag, 1);
+		return;
+	}
+
+	// windowed; frames are prefixed with their sequence number
+	uint8_t headerSize = (size < 2) ? 0 : groundValidFrame(&frame[1], size - 1);
+	if (headerSize == 0)
+		return;
+
+	uint8_t distance = (uint8_t)(frame[0] - ground.expected);
+
+	// the oldest missing frame; accept it along with all subsequent frames already received
+	if (distance == 0) {
+		stats.framesDelivered++;
+		stats.bytesDelivered += size - 1;
+		stats.payloadDelivered += size - 1 - headerSize;
+		ground.expected++;
+
+		while (ground.received & 1) {
+			ground.received >>= 1;
+			ground.expected++;
+		}
+		ground.received >>= 1;
+	}
+
+	// a frame ahead of the oldest missing frame
+	else if (distance <= TRANCEIVER_TX_MAX_FRAME_COUNT) {
+		uint64_t bit = ((uint64_t)1) << (distance - 1);
+
+		if (ground.received & bit) {
+			stats.framesDuplicate++;
+		}
+		else {
+			ground.received |= bit;
+			stats.framesDelivered++;
+			stats.bytesDelivered += size - 1;
+			stats.payloadDelivered += size - 1 - headerSize;
+		}
+	}
+
+	// a frame that was already accepted
+	else {
+		stats.framesDuplicate++;
+	}
+
+	groundRespond();
+}
+
+
+/**
+ * Record the response of the Satellite to a telecommand (or to a batch of them).
+ *
+ * @pre The simulated link must be locked by the caller.
+ * @param frame The downlink frame (without parity bytes).
+ * @param size The size of the frame (in bytes).
+ */
+static void groundReceiveResponse(uint8_t* frame, uint8_t size) {
+	uint8_t headerSize = groundValidFrame(frame, size);
+	if (headerSize == 0)
+		return;
+
+	radsat_message rawMessage = { 0 };
+	if (protoDecode(&frame[headerSize], size - headerSize, &rawMessage) != 0)
+		return;
+
+	if (rawMessage.which_service != radsat_message_ProtocolMessage_tag)
+		return;
+
+	stats.telecommandResponses++;
+
+	// an ACK of a batch reports each telecommand; any other ACK reports a single one
+	if (rawMessage.ProtocolMessage.which_message == protocol_message_Ack_tag) {
+		const ack* response = &rawMessage.ProtocolMessage.Ack;
+		if (response->count == 0) {
+			stats.telecommandsExecuted++;
+		}
+		else {
+			for (uint8_t i = 0; i < response->count && i < 32; i++)
+				stats.telecommandsExecuted += (response->executed >> i) & 1;
+		}
+	}
+}
+
+
+/**
+ * Validate the header (preamble and CRC) of a downlink message.
+ *
+ * @param frame The wrapped message.
+ * @param size The size of the wrapped message (in bytes).
+ * @return The size of its header (full or compact) if the message is intact; 0 otherwise.
+ */
+static uint8_t groundValidFrame(uint8_t* frame, uint8_t size) {
+
+	// compact header; its size depends on its timestamp (a varint)
+	if (size > sizeof(radsat_sk_compact_header_t) && frame[0] == RADSAT_SK_COMPACT_HEADER_TYPE) {
+		radsat_sk_compact_header_t* compact = (radsat_sk_compact_header_t*)frame;
+		uint8_t headerSize = sizeof(radsat_sk_compact_header_t);
+		while (headerSize < size && headerSize < RADSAT_SK_COMPACT_HEADER_MAX_SIZE && (frame[headerSize] & 0x80))
+			headerSize++;
+		headerSize++;
+
+		if (compact->size + headerSize != size)
+			return 0;
+
+		if (compact->crc != crcFast(&frame[RADSAT_SK_COMPACT_HEADER_CRC_OFFSET], (int)(size - RADSAT_SK_COMPACT_HEADER_CRC_OFFSET)))
+			return 0;
+
+		return headerSize;
+	}
+
+	if (size <= RADSAT_SK_HEADER_SIZE)
+		return 0;
+
+	radsat_sk_header_t* header = (radsat_sk_header_t*)frame;
+	if (header->preamble != RADSAT_SK_MESSAGE_PREAMBLE)
+		return 0;
+
+	if (header->size + RADSAT_SK_HEADER_SIZE != size)
+		return 0;
+
+	if (header->crc != crcFast(&frame[RADSAT_SK_HEADER_CRC_OFFSET], (int)(size - RADSAT_SK_HEADER_CRC_OFFSET)))
+		return 0;
+
+	return RADSAT_SK_HEADER_SIZE;
+}
+
+
+/**
+ * Send the current Ground Station response: the latest Selective ACK when windowed, otherwise a
+ * NACK (the Satellite's last frame, or the Ground Station's last ACK, has gone missing).
+ *
+ * @pre The simulated link must be locked by the caller.
+ */
+static void groundRespond(void) {
+	ground.lastActivity = xTaskGetTickCount();
+
+	if (config.windowSize == 0)
+		groundSendProtocol(protocol_message_Nack_tag, 1);
+	else
+		groundSendProtocol(protocol_message_SelectiveAck_tag, 1);
+}
+
+
+/**
+ * Wrap, encrypt and send a Protocol message from the Ground Station.
+ *
+ * @pre The simulated link must be locked by the caller.
+ * @param messageTag The tag of the Protocol message to send.
+ * @param lossy Whether the message is subject to the configured loss.
+ * @return 0 on success, otherwise an error.
+ */
+static int groundSendProtocol(uint16_t messageTag, uint8_t lossy) {
+	radsat_message rawMessage = { 0 };
+	rawMessage.which_service = radsat_message_ProtocolMessage_tag;
+	rawMessage.ProtocolMessage.which_message = messageTag;
+
+	if (messageTag == protocol_message_SelectiveAck_tag) {
+		rawMessage.ProtocolMessage.SelectiveAck.sequence = ground.expected;
+		rawMessage.ProtocolMessage.SelectiveAck.received = ground.received;
+		rawMessage.ProtocolMessage.SelectiveAck.window = config.windowSize;
+	}
+
+	uint8_t frame[TRANCEIVER_TX_MAX_FRAME_SIZE] = { 0 };
+	uint8_t size = messageWrap(&rawMessage, frame);
+	if (size == 0)
+		return E_GENERIC;
+
+	// the cipher is symmetric; decrypting a plain message encrypts it
+	xorDecrypt(frame, size);
+
+	stats.responsesSent++;
+	if (messageTag == protocol_message_Nack_tag)
+		stats.nacksSent++;
+
+	if (lossy && simChance(config.lossPercent)) {
+		stats.responsesLost++;
+		return SUCCESS;
+	}
+
+	if (lossy) {
+		uint8_t corrupted = simChance(config.corruptPercent);
+		if (corrupted)
+			simCorrupt(frame, size);
+		if (simBitErrors(frame, size))
+			corrupted = 1;
+		if (corrupted)
+			stats.responsesCorrupted++;
+	}
+
+	return simQueueUplink(frame, size);
+}
+
+#endif /* TRANSCEIVER_SIMULATION */
@@ -0,0 +1,64 @@
+/**
+ * @file RTransceiverSim.h
+ * @date October 16, 2026
+ * @author
+ */
+
+#ifndef RTRANSCEIVERSIM_H_
+#define RTRANSCEIVERSIM_H_
+
+#include <stdint.h>
+#include <RTransceiver.h>
+
+
+/***************************************************************************************************
+                                            DEFINITIONS
+***************************************************************************************************/
+
+/** Link and Ground Station settings of the simulated Transceiver. */
+typedef struct _transceiver_sim_config_t {
+	uint16_t bitrate;		///< Downlink bitrate (bps); 9600 when set to 0
+	uint16_t latencyMs;		///< One-way propagation (and processing) delay (ms)
+	uint8_t lossPercent;	///< Chance of any single frame being lost, in either direction (0-100)
+	uint8_t corruptPercent;	///< Chance of any single frame that is not lost arriving with a flipped bit (0-100)
+	uint16_t bitErrorPpm;	///< Chance of any single bit of a frame that is not lost being flipped, in either direction (per million)
+	uint32_t seed;			///< Seed of the loss generator; runs with the same seed lose the same frames
+	uint8_t windowSize;		///< Ground Station window; 0 uses single ACK/NACK responses (stop-and-wait)
+	uint8_t compactHeaders;	///< Whether the Ground Station asks for compact headers when beginning a pass
+	uint8_t fecParity;		///< Parity bytes on every downlink frame, as asked for when beginning a pass (0 for none)
+} transceiver_sim_config_t;
+
+
+/** Statistics gathered by the simulated Transceiver and Ground Station. */
+typedef struct _transceiver_sim_stats_t {
+	uint32_t framesSent;		///< Downlink frames accepted by the transmitter
+	uint32_t framesLost;		///< Downlink frames lost on their way to the Ground Station
+	uint32_t framesCorrupted;	///< Downlink frames that reached the Ground Station with flipped bits
+	uint32_t framesRepaired;	///< Downlink frames repaired by the Ground Station from their parity bytes
+	uint32_t framesDelivered;	///< Unique File Transfer frames received in order by the Ground Station
+	uint32_t framesDuplicate;	///< File Transfer frames received more than once
+	uint32_t bytesDelivered;	///< Bytes of the unique File Transfer frames
+	uint32_t payloadDelivered;	///< Message bytes of the unique File Transfer frames (without headers)
+	uint32_t responsesSent;		///< ACKs, NACKs and Selective ACKs sent by the Ground Station
+	uint32_t nacksSent;			///< NACKs sent by the Ground Station (stop-and-wait)
+	uint32_t responsesLost;		///< Ground Station responses lost on their way to the Satellite
+	uint32_t responsesCorrupted;	///< Ground Station responses that reached the Satellite with flipped bits
+	uint32_t telecommandResponses;	///< ACKs and NACKs of telecommands (single or batched) received by the Ground Station
+	uint32_t telecommandsExecuted;	///< Telecommands acknowledged as executed by the Satellite
+} transceiver_sim_stats_t;
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+void transceiverSimConfigure(const transceiver_sim_config_t* config);
+void transceiverSimStats(transceiver_sim_stats_t* stats);
+
+int transceiverSimUplink(uint8_t* frame, uint8_t size);
+int transceiverSimUplinkTelecommand(uint16_t telecommandTag);
+int transceiverSimUplinkTelecommands(const uint16_t* telecommandTags, uint8_t count);
+int transceiverSimStartFileTransfer(void);
+
+
+#endif /* RTRANSCEIVERSIM_H_ */
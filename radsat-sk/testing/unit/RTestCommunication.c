@@ -0,0 +1,679 @@
+/**
+ * @file RTestCommunication.c
+ * @date October 16, 2026
+ * @author
+ *
+ * Exercises the communication Tasks over the simulated Transceiver (see RTransceiverSim.c), which
+ * must be enabled by defining TRANSCEIVER_SIMULATION in the Test build configuration.
+ */
+
+#ifdef TRANSCEIVER_SIMULATION
+
+#include <RCommunicationTasks.h>
+#include <RFileTransferService.h>
+#include <RTransceiverSim.h>
+#include <RMessage.h>
+#include <RFram.h>
+#include <RCommon.h>
+#include <RTestUtils.h>
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <hal/Timing/Time.h>
+
+#include <stdint.h>
+#include <stdio.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** Number of File Transfer frames downlinked during each test. */
+#define TEST_FRAME_COUNT		((uint16_t)100)
+
+/** One-way latency (in ms) of the simulated link. */
+#define TEST_LATENCY_MS			((uint16_t)250)
+
+/** Longest time (in ms) any single test may take. */
+#define TEST_TIMEOUT_MS			((portTickType)(10*60*1000))
+
+/** Time (in ms) spent measuring the Receive Task outside of a pass. */
+#define TEST_IDLE_DURATION_MS	((uint32_t)5000)
+
+/** Maximum Receive Task transactions per second outside of a pass. */
+#define TEST_IDLE_TRANSACTION_LIMIT	((uint32_t)20)
+
+/** Number of (small) messages added during the frame packing test. */
+#define TEST_PACKED_MESSAGE_COUNT	((uint16_t)100)
+
+/** Number of health frames (and image frames) added during the downlink priority test. */
+#define TEST_HEALTH_FRAME_COUNT	((uint16_t)50)
+#define TEST_BULK_FRAME_COUNT	((uint16_t)20)
+
+/** Number of frames checked for a fair share during the downlink priority test. */
+#define TEST_PRIORITY_FRAME_COUNT	((uint16_t)8)
+
+/** Time (in ms) given to the Satellite to process (and respond to) a telecommand. */
+#define TEST_TELECOMMAND_DELAY	((portTickType)(2*TEST_LATENCY_MS + 1000))
+
+
+/** Communication Task handles; the Tasks are only started once. */
+static xTaskHandle communicationRxTaskHandle = NULL;
+static xTaskHandle communicationTxTaskHandle = NULL;
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static void printRxStats(const communication_rx_stats_t* stats, uint32_t duration);
+static int runFileTransfer(const char* name, const transceiver_sim_config_t* config, portTickType* duration);
+static int prepareCommunication(void);
+static int prepareFrames(uint16_t count);
+static int unpackFrame(uint8_t* frame, uint8_t size, uint16_t firstIndex);
+static uint16_t firstMessageTag(uint8_t* frame, uint8_t size);
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Downlink all frames over a lossless link, one frame at a time.
+ */
+static int testStopAndWait(unsigned int autoSelection) {
+	(void) autoSelection;
+
+	transceiver_sim_config_t config = { .latencyMs = TEST_LATENCY_MS, .windowSize = 0 };
+	return runFileTransfer("Stop-and-wait, no loss", &config, NULL);
+}
+
+
+/**
+ * Downlink all frames over a lossless link, with a full window of frames in flight.
+ */
+static int testWindowed(unsigned int autoSelection) {
+	(void) autoSelection;
+
+	transceiver_sim_config_t config = { .latencyMs = TEST_LATENCY_MS, .windowSize = TRANCEIVER_TX_MAX_FRAME_COUNT };
+	return runFileTransfer("Windowed, no loss", &config, NULL);
+}
+
+
+/**
+ * Downlink all frames over a link that loses 10% of all frames (in both directions).
+ */
+static int testWindowedLossy(unsigned int autoSelection) {
+	(void) autoSelection;
+
+	transceiver_sim_config_t config = {
+		.latencyMs = TEST_LATENCY_MS,
+		.lossPercent = 10,
+		.seed = 0x2018,
+		.windowSize = TRANCEIVER_TX_MAX_FRAME_COUNT
+	};
+	return runFileTransfer("Windowed, 10% loss", &config, NULL);
+}
+
+
+/**
+ * Compare both downlink modes over the same (slightly lossy) link; the windowed mode must be faster.
+ */
+static int testCompareModes(unsigned int autoSelection) {
+	(void) autoSelection;
+
+	transceiver_sim_config_t config = { .latencyMs = TEST_LATENCY_MS, .lossPercent = 5, .seed = 0x2018 };
+	portTickType stopAndWaitDuration = 0;
+	portTickType windowedDuration = 0;
+
+	config.windowSize = 0;
+	int error = runFileTransfer("Stop-and-wait, 5% loss", &config, &stopAndWaitDuration);
+	if (error)
+		return error;
+
+	config.windowSize = TRANCEIVER_TX_MAX_FRAME_COUNT;
+	error = runFileTransfer("Windowed, 5% loss", &config, &windowedDuration);
+	if (error)
+		return error;
+
+	printf("\t Windowed downlink took %lu%% of the stop-and-wait duration \n\r",
+		   (unsigned long)((100 * windowedDuration) / stopAndWaitDuration));
+
+	return (windowedDuration < stopAndWaitDuration) ? SUCCESS : E_GENERIC;
+}
+
+
+/**
+ * Measure how often the Receive Task uses the I2C bus, both outside of and during a pass.
+ */
+static int testReceiveBusUsage(unsigned int autoSelection) {
+	(void) autoSelection;
+
+	int error = prepareCommunication();
+	if (error)
+		return error;
+
+	transceiverSimConfigure(NULL);
+	if (communicationPassModeActive())
+		communicationEndPass();
+
+	// outside of a pass
+	communication_rx_stats_t stats = { 0 };
+	communicationRxStats(&stats, 1);
+	vTaskDelay(TEST_IDLE_DURATION_MS / portTICK_RATE_MS);
+	communicationRxStats(&stats, 1);
+
+	printf("\n\r Outside of a pass (%lu ms) \n\r", (unsigned long)TEST_IDLE_DURATION_MS);
+	printRxStats(&stats, TEST_IDLE_DURATION_MS);
+	uint32_t idleTransactions = stats.i2cTransactions;
+
+	// during a pass
+	transceiver_sim_config_t config = { .latencyMs = TEST_LATENCY_MS, .windowSize = TRANCEIVER_TX_MAX_FRAME_COUNT };
+	portTickType start = xTaskGetTickCount();
+	error = runFileTransfer("Windowed, no loss", &config, NULL);
+	uint32_t duration = (xTaskGetTickCount() - start) * portTICK_RATE_MS;
+	communicationRxStats(&stats, 1);
+
+	printf("\n\r During a pass (%lu ms, including telecommands) \n\r", (unsigned long)duration);
+	printRxStats(&stats, duration);
+
+	// outside of a pass, the bus must be left (nearly) alone
+	if (idleTransactions * 1000 > TEST_IDLE_TRANSACTION_LIMIT * TEST_IDLE_DURATION_MS)
+		return E_GENERIC;
+
+	return error;
+}
+
+
+/**
+ * Print Receive Task statistics.
+ *
+ * @param stats The statistics to print.
+ * @param duration The duration (in ms) they were gathered over; 0 to skip the rates.
+ */
+static void printRxStats(const communication_rx_stats_t* stats, uint32_t duration) {
+	printf("\t Polls:        %lu (%lu empty) \n\r", (unsigned long)stats->polls, (unsigned long)stats->emptyPolls);
+	printf("\t Frames:       %lu \n\r", (unsigned long)stats->framesDrained);
+	printf("\t Transactions: %lu (%lu ms) \n\r", (unsigned long)stats->i2cTransactions, (unsigned long)stats->i2cTimeMs);
+
+	if (duration > 0)
+		printf("\t Rate:         %lu transactions/s \n\r", (unsigned long)((1000 * stats->i2cTransactions) / duration));
+}
+
+
+/**
+ * Add many small messages, and confirm that they are packed into few frames without losing any.
+ */
+static int testFramePacking(unsigned int autoSelection) {
+	(void) autoSelection;
+
+	printf("\n\r Frame packing (%u OBC telemetry messages) \n\r", TEST_PACKED_MESSAGE_COUNT);
+
+	int error = prepareCommunication();
+	if (error)
+		return error;
+
+	fileTransferReset();
+
+	// (error reports are not packed; each is added to the FIFO straight away)
+	for (uint16_t i = 0; i < TEST_PACKED_MESSAGE_COUNT; i++) {
+		obc_telemetry telemetry = { .mode = i, .uptime = i };
+		error = fileTransferAddMessage(&telemetry, sizeof(telemetry), file_transfer_message_ObcTelemetry_tag);
+		if (error) {
+			printf("\t Failed to add message %u: error = %d \n\r", i, error);
+			return error;
+		}
+	}
+
+	error = fileTransferFlush();
+	if (error) {
+		printf("\t Failed to flush: error = %d \n\r", error);
+		return error;
+	}
+
+	// unpack all stored frames, confirming every message arrives intact and in order
+	uint8_t frame[TRANCEIVER_TX_MAX_FRAME_SIZE] = { 0 };
+	uint8_t frameSize = 0;
+	uint16_t frameCount = 0;
+	uint16_t messageCount = 0;
+	uint32_t totalSize = 0;
+
+	while ((frameSize = fileTransferPeekFrame(frameCount + 1, frame)) > 0) {
+		int count = unpackFrame(frame, frameSize, messageCount);
+		if (count <= 0) {
+			printf("\t Frame %u is invalid \n\r", frameCount + 1);
+			break;
+		}
+
+		frameCount++;
+		messageCount += count;
+		totalSize += frameSize;
+	}
+
+	fileTransferReset();
+
+	printf("\t Frames:   %u (%lu bytes on average) \n\r", frameCount, (unsigned long)((frameCount > 0) ? (totalSize / frameCount) : 0));
+	printf("\t Messages: %u / %u \n\r", messageCount, TEST_PACKED_MESSAGE_COUNT);
+
+	// many small messages must share frames
+	if (messageCount != TEST_PACKED_MESSAGE_COUNT || frameCount * 4 > TEST_PACKED_MESSAGE_COUNT) {
+		printf("\t FAILED \n\r");
+		return E_GENERIC;
+	}
+
+	printf("\t PASSED \n\r");
+	return SUCCESS;
+}
+
+
+/**
+ * Fill the health and bulk queues, and confirm that both receive their share of the downlink, and
+ * that each queue applies its overflow policy (the health queue drops its oldest frames, the bulk
+ * queue rejects new ones).
+ */
+static int testDownlinkPriority(unsigned int autoSelection) {
+	(void) autoSelection;
+
+	printf("\n\r Downlink priority (%u health frames, %u image frames) \n\r", TEST_HEALTH_FRAME_COUNT, TEST_BULK_FRAME_COUNT);
+
+	int error = prepareCommunication();
+	if (error)
+		return error;
+
+	error = prepareFrames(TEST_BULK_FRAME_COUNT);
+	if (error) {
+		printf("\t Failed to prepare frames: error = %d \n\r", error);
+		return error;
+	}
+
+	// one error report per frame; more than the health queue holds
+	for (uint16_t i = 0; i < TEST_HEALTH_FRAME_COUNT; i++) {
+		module_error_report report = { .module = i, .error = -(int32_t)i };
+		error = fileTransferAddMessage(&report, sizeof(report), file_transfer_message_ModuleErrorReport_tag);
+		if (!error)
+			error = fileTransferFlush();
+		if (error) {
+			printf("\t Failed to add health frame %u: error = %d \n\r", i, error);
+			return error;
+		}
+	}
+
+	file_transfer_queue_status_t health = { 0 };
+	fileTransferQueueStatus(fileTransferQueueHealth, &health);
+	printf("\t Health queue: %u / %u frames (%lu dropped) \n\r", health.frames, health.capacity, (unsigned long)health.dropped);
+
+	// the oldest health frames make room for the newest ones
+	uint16_t nextHealth = TEST_HEALTH_FRAME_COUNT - health.capacity;
+	uint8_t passed = (health.frames == health.capacity && health.dropped >= nextHealth);
+
+	// both queues share the first frames; the health frames arrive oldest first
+	uint8_t frame[TRANCEIVER_TX_MAX_FRAME_SIZE] = { 0 };
+	uint16_t healthCount = 0;
+	uint16_t bulkCount = 0;
+
+	for (uint16_t offset = 1; offset <= TEST_PRIORITY_FRAME_COUNT; offset++) {
+		uint8_t frameSize = fileTransferPeekFrame(offset, frame);
+		uint16_t tag = (frameSize > 0) ? firstMessageTag(frame, frameSize) : 0;
+
+		if (tag == file_transfer_message_ModuleErrorReport_tag && unpackFrame(frame, frameSize, nextHealth) == 1) {
+			healthCount++;
+			nextHealth++;
+		}
+		else if (tag == file_transfer_message_ImagePacket_tag)
+			bulkCount++;
+		else
+			passed = 0;
+	}
+
+	printf("\t First %u frames: %u health, %u image \n\r", TEST_PRIORITY_FRAME_COUNT, healthCount, bulkCount);
+	passed &= (healthCount > bulkCount && bulkCount > 0);
+
+	// the bulk queue keeps its stored frames once full
+	file_transfer_queue_status_t bulk = { 0 };
+	fileTransferQueueStatus(fileTransferQueueBulk, &bulk);
+
+	for (uint16_t i = 0; i < bulk.capacity; i++) {
+		image_packet packet = { .id = i, .type = image_type_t_Thumbnail };
+		packet.data.size = sizeof(packet.data.bytes);
+		fileTransferAddMessage(&packet, sizeof(packet), file_transfer_message_ImagePacket_tag);
+	}
+	fileTransferFlush();
+
+	fileTransferQueueStatus(fileTransferQueueBulk, &bulk);
+	printf("\t Bulk queue:   %u / %u frames (%lu rejected) \n\r", bulk.frames, bulk.capacity, (unsigned long)bulk.rejected);
+	passed &= (bulk.frames == bulk.capacity && bulk.rejected > 0);
+
+	fileTransferReset();
+
+	if (!passed) {
+		printf("\t FAILED \n\r");
+		return E_GENERIC;
+	}
+
+	printf("\t PASSED \n\r");
+	return SUCCESS;
+}
+
+
+/**
+ * Measure the FRAM traffic of resetting the File Transfer FIFO, and confirm the stored frames are gone.
+ */
+static int testResetCost(unsigned int autoSelection) {
+	(void) autoSelection;
+
+	printf("\n\r FIFO reset cost (%u stored frames) \n\r", TEST_FRAME_COUNT);
+
+	int error = prepareCommunication();
+	if (!error)
+		error = prepareFrames(TEST_FRAME_COUNT);
+	if (error) {
+		printf("\t Failed to prepare frames: error = %d \n\r", error);
+		return error;
+	}
+
+	fram_stats_t usage = { 0 };
+	framStats(&usage, 1);
+
+	fileTransferReset();
+
+	framStats(&usage, 0);
+	printf("\t FRAM: %lu writes (%lu bytes), %lu reads (%lu bytes) \n\r",
+			(unsigned long)usage.writes, (unsigned long)usage.bytesWritten, (unsigned long)usage.reads, (unsigned long)usage.bytesRead);
+
+	// nothing may be left to downlink, and the reset must not touch the stored frames
+	uint8_t frame[TRANCEIVER_TX_MAX_FRAME_SIZE] = { 0 };
+	if (fileTransferPeekFrame(1, frame) != 0 || fileTransferCurrentFrame(frame) != 0 || usage.bytesWritten >= FRAM_DATA_FRAME_SIZE) {
+		printf("\t FAILED \n\r");
+		return E_GENERIC;
+	}
+
+	printf("\t PASSED \n\r");
+	return SUCCESS;
+}
+
+
+/**
+ * Run a full File Transfer phase through the simulated link, confirming all frames are delivered.
+ *
+ * @param name Description of the test, for printing.
+ * @param config Settings of the simulated link and Ground Station.
+ * @param duration Time taken to deliver all frames (in ms). Set by function. Optional; set NULL to skip.
+ * @return 0 on success, otherwise an error.
+ */
+static int runFileTransfer(const char* name, const transceiver_sim_config_t* config, portTickType* duration) {
+
+	printf("\n\r %s (%u frames, %u ms latency) \n\r", name, TEST_FRAME_COUNT, config->latencyMs);
+
+	int error = prepareCommunication();
+	if (error)
+		return error;
+
+	transceiverSimConfigure(config);
+
+	error = prepareFrames(TEST_FRAME_COUNT);
+	if (error) {
+		printf("\t Failed to prepare frames: error = %d \n\r", error);
+		return error;
+	}
+
+	// start a fresh pass, and move on to the File Transfer phase
+	if (communicationPassModeActive())
+		communicationEndPass();
+
+	transceiverSimUplinkTelecommand(telecommand_message_ResumeTransmission_tag);
+	vTaskDelay(TEST_TELECOMMAND_DELAY / portTICK_RATE_MS);
+	transceiverSimUplinkTelecommand(telecommand_message_BeginFileTransfer_tag);
+	vTaskDelay(TEST_TELECOMMAND_DELAY / portTICK_RATE_MS);
+
+	// have the Ground Station start receiving; wait until all frames have arrived
+	transceiver_sim_stats_t stats = { 0 };
+	portTickType start = xTaskGetTickCount();
+	portTickType elapsed = 0;
+
+	communication_tx_latency_t latency = { 0 };
+	communicationTxLatency(&latency, 1);
+	communication_tx_stats_t txStats = { 0 };
+	communicationTxStats(&txStats, 1);
+
+	transceiverSimStartFileTransfer();
+
+	while (stats.framesDelivered < TEST_FRAME_COUNT && elapsed < TEST_TIMEOUT_MS && communicationPassModeActive()) {
+		vTaskDelay(100 / portTICK_RATE_MS);
+		transceiverSimStats(&stats);
+		elapsed = (xTaskGetTickCount() - start) * portTICK_RATE_MS;
+	}
+
+	communicationEndPass();
+
+	printf("\t Delivered:  %lu / %u frames (%lu duplicates) \n\r", (unsigned long)stats.framesDelivered, TEST_FRAME_COUNT, (unsigned long)stats.framesDuplicate);
+	printf("\t Downlinked: %lu frames (%lu lost) \n\r", (unsigned long)stats.framesSent, (unsigned long)stats.framesLost);
+	printf("\t Responses:  %lu (%lu lost) \n\r", (unsigned long)stats.responsesSent, (unsigned long)stats.responsesLost);
+	printf("\t Duration:   %lu ms (%lu bytes/s) \n\r", (unsigned long)elapsed,
+		   (unsigned long)((elapsed > 0) ? ((1000 * stats.bytesDelivered) / elapsed) : 0));
+
+	communicationTxLatency(&latency, 1);
+	printf("\t ACK-to-send latency (ms; %lu samples, max %lu): \n\r\t   ", (unsigned long)latency.samples, (unsigned long)latency.maxMs);
+	const char* bucketNames[COMMUNICATION_TX_LATENCY_BUCKETS] = { "0", "1", "2", "3-4", "5-8", "9-16", "17-32", "33+" };
+	for (uint8_t i = 0; i < COMMUNICATION_TX_LATENCY_BUCKETS; i++)
+		printf("%s: %lu  ", bucketNames[i], (unsigned long)latency.buckets[i]);
+	printf("\n\r");
+
+	communicationTxStats(&txStats, 1);
+	printf("\t Transmitter: %lu frames (%lu rejected), depth avg %lu max %lu, air busy %lu ms, idle %lu ms \n\r",
+		   (unsigned long)txStats.framesSent, (unsigned long)txStats.framesRejected,
+		   (unsigned long)((txStats.framesSent > 0) ? (txStats.depthSum / txStats.framesSent) : 0),
+		   (unsigned long)txStats.depthMax, (unsigned long)txStats.airBusyMs, (unsigned long)txStats.airIdleMs);
+	printf("\t Wake-ups:    %lu (%lu without a frame sent) \n\r", (unsigned long)txStats.wakeups, (unsigned long)txStats.idleWakeups);
+
+	if (duration != NULL)
+		*duration = elapsed;
+
+	if (stats.framesDelivered < TEST_FRAME_COUNT) {
+		printf("\t FAILED \n\r");
+		return E_GENERIC;
+	}
+
+	printf("\t PASSED \n\r");
+	return SUCCESS;
+}
+
+
+/**
+ * Start the communication Tasks (if not yet started), and the time (if not yet set).
+ *
+ * @return 0 on success, otherwise an error.
+ */
+static int prepareCommunication(void) {
+
+	// messages are timestamped; the time must be running
+	unsigned int epoch = 0;
+	if (Time_getUnixEpoch(&epoch) != SUCCESS) {
+		Time time = { .year = 22, .month = 8, .date = 1, .day = 2, .hours = 12 };
+		int error = Time_start(&time, 120);
+		if (error) {
+			printf("\t Failed to start time: error = %d \n\r", error);
+			return error;
+		}
+	}
+
+	if (communicationRxTaskHandle == NULL) {
+		int error = xTaskCreate(CommunicationRxTask,
+								(const signed char*)"Communication Receive Task",
+								4096,
+								NULL,
+								configMAX_PRIORITIES - 2,
+								&communicationRxTaskHandle);
+
+		if (error != pdPASS) {
+			printf("\t Failed to create CommunicationRxTask \n\r");
+			return E_GENERIC;
+		}
+	}
+
+	if (communicationTxTaskHandle == NULL) {
+		int error = xTaskCreate(CommunicationTxTask,
+								(const signed char*)"Communication Transmit Task",
+								4096,
+								NULL,
+								configMAX_PRIORITIES - 1,
+								&communicationTxTaskHandle);
+
+		if (error != pdPASS) {
+			printf("\t Failed to create CommunicationTxTask \n\r");
+			return E_GENERIC;
+		}
+	}
+
+	return SUCCESS;
+}
+
+
+/**
+ * Replace all stored File Transfer frames with the given number of (image packet) frames.
+ *
+ * Image packets are large enough that each fills a frame on its own (they are never packed together).
+ *
+ * @param count The number of frames to store.
+ * @return 0 on success, otherwise an error.
+ */
+static int prepareFrames(uint16_t count) {
+
+	fileTransferReset();
+
+	for (uint16_t i = 0; i < count; i++) {
+		image_packet packet = { 0 };
+		packet.id = i;
+		packet.type = image_type_t_Thumbnail;
+		packet.data.size = sizeof(packet.data.bytes);
+		for (uint16_t j = 0; j < packet.data.size; j++)
+			packet.data.bytes[j] = (uint8_t)(i + j);
+
+		int error = fileTransferAddMessage(&packet, sizeof(packet), file_transfer_message_ImagePacket_tag);
+		if (error)
+			return error;
+	}
+
+	return fileTransferFlush();
+}
+
+
+/**
+ * Unpack and check all (error report or OBC telemetry) messages packed into a frame.
+ *
+ * @param frame The frame, as stored by the File Transfer Service.
+ * @param size The size of the frame (in bytes).
+ * @param firstIndex The index of the first message expected in the frame (see @sa testFramePacking).
+ * @return The number of messages in the frame; -1 if the frame (or any message) is invalid.
+ */
+static int unpackFrame(uint8_t* frame, uint8_t size, uint16_t firstIndex) {
+
+	// confirm the header
+	radsat_sk_header_t* header = (radsat_sk_header_t*)frame;
+	if (header->preamble != RADSAT_SK_MESSAGE_PREAMBLE || header->size + RADSAT_SK_HEADER_SIZE != size)
+		return -1;
+
+	if (header->crc != crcFast(&frame[RADSAT_SK_HEADER_CRC_OFFSET], (int)(size - RADSAT_SK_HEADER_CRC_OFFSET)))
+		return -1;
+
+	// the messages are encoded radsat_messages placed back to back (see file_transfer_batch)
+	pb_istream_t stream = pb_istream_from_buffer(&frame[RADSAT_SK_HEADER_SIZE], header->size);
+	int count = 0;
+
+	while (stream.bytes_left > 0) {
+		pb_wire_type_t wireType = 0;
+		uint32_t tag = 0;
+		bool eof = 0;
+		if (!pb_decode_tag(&stream, &wireType, &tag, &eof) || tag != radsat_message_FileTransferMessage_tag)
+			return -1;
+
+		file_transfer_message message = { 0 };
+		if (!pb_decode_delimited(&stream, file_transfer_message_fields, &message))
+			return -1;
+
+		uint16_t index = firstIndex + count;
+		uint8_t valid = (message.which_message == file_transfer_message_ModuleErrorReport_tag
+						&& message.ModuleErrorReport.module == index && message.ModuleErrorReport.error == -(int32_t)index)
+					 || (message.which_message == file_transfer_message_ObcTelemetry_tag
+						&& message.ObcTelemetry.mode == index && message.ObcTelemetry.uptime == index);
+		if (!valid)
+			return -1;
+
+		count++;
+	}
+
+	return count;
+}
+
+
+/**
+ * Provide the kind of the first message packed into a frame.
+ *
+ * @param frame The frame, as stored by the File Transfer Service.
+ * @param size The size of the frame (in bytes).
+ * @return The File Transfer message tag of the first message; 0 if it is invalid.
+ */
+static uint16_t firstMessageTag(uint8_t* frame, uint8_t size) {
+
+	if (size <= RADSAT_SK_HEADER_SIZE)
+		return 0;
+
+	pb_istream_t stream = pb_istream_from_buffer(&frame[RADSAT_SK_HEADER_SIZE], size - RADSAT_SK_HEADER_SIZE);
+	pb_wire_type_t wireType = 0;
+	uint32_t tag = 0;
+	bool eof = 0;
+	if (!pb_decode_tag(&stream, &wireType, &tag, &eof) || tag != radsat_message_FileTransferMessage_tag)
+		return 0;
+
+	file_transfer_message message = { 0 };
+	if (!pb_decode_delimited(&stream, file_transfer_message_fields, &message))
+		return 0;
+
+	return message.which_message;
+}
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+int testCommunicationAll(unsigned int autoSelection) {
+	int error = 0;
+	error |= testStopAndWait(autoSelection);
+	error |= testWindowed(autoSelection);
+	error |= testWindowedLossy(autoSelection);
+	error |= testFramePacking(autoSelection);
+	error |= testDownlinkPriority(autoSelection);
+	error |= testResetCost(autoSelection);
+	return error;
+}
+
+int testSelectCommunication(unsigned int autoSelection) {
+	char* menuTitles[] = {
+		"Run all tests",
+		"Stop-and-wait Downlink",
+		"Windowed Downlink",
+		"Windowed Downlink (lossy link)",
+		"Compare Downlink Modes",
+		"Receive Bus Usage",
+		"Frame Packing",
+		"Downlink Priority",
+		"FIFO Reset Cost"
+	};
+
+	TestMenuFunction menuFunctions[] = {
+		testCommunicationAll,
+		testStopAndWait,
+		testWindowed,
+		testWindowedLossy,
+		testCompareModes,
+		testReceiveBusUsage,
+		testFramePacking,
+		testDownlinkPriority,
+		testResetCost
+	};
+
+	return testingMenu(autoSelection, menuFunctions, menuTitles, 9);
+}
+
+#endif /* TRANSCEIVER_SIMULATION */
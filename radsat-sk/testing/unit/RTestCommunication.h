@@ -0,0 +1,19 @@
+/**
+ * @file RTestCommunication.h
+ * @date October 16, 2026
+ * @author
+ */
+
+#ifndef RTESTCOMMUNICATION_H_
+#define RTESTCOMMUNICATION_H_
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+int testSelectCommunication(unsigned int autoSelection);
+int testCommunicationAll(unsigned int autoSelection);
+
+
+#endif /* RTESTCOMMUNICATION_H_ */
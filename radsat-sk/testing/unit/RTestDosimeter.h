@@ -1,21 +1,21 @@
-/**
- * @file RTestDosimeter.h
- * @date December 29, 2021
- * @author Tyrel Kostyk and Austin Hruska (jah385)
- */
-
-#ifndef RTESTDOSIMETER_H_
-#define RTESTDOSIMETER_H_
-
-
-
-/***************************************************************************************************
-                                             PUBLIC API
-***************************************************************************************************/
-
-int testSelectDosimeter(unsigned int autoSelection);
-int checkDosimeter(void);
-int testDosimeterAll(void);
-
-
-#endif /* RTESTDOSIMETER_H_ */
+/**
+ * @file RTestDosimeter.h
+ * @date December 29, 2021
+ * @author Tyrel Kostyk and Austin Hruska (jah385)
+ */
+
+#ifndef RTESTDOSIMETER_H_
+#define RTESTDOSIMETER_H_
+
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+int testSelectDosimeter(unsigned int autoSelection);
+int checkDosimeter(void);
+int testDosimeterAll(void);
+
+
+#endif /* RTESTDOSIMETER_H_ */
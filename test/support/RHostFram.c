@@ -0,0 +1,83 @@
+/**
+ * @file RHostFram.c
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the ISIS HAL FRAM driver: an in-memory copy of the 256 KB FRAM.
+ *
+ * Like the FRAM chip, which ignores the address bits above its size, addresses wrap around.
+ */
+
+#include <hal/Storage/FRAM.h>
+#include <hal/errors.h>
+#include <string.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** Size of the FRAM on the iOBC (bytes). */
+#define HOST_FRAM_SIZE	(0x40000)
+
+/** Address bits decoded by the FRAM. */
+#define HOST_FRAM_ADDRESS_MASK	(HOST_FRAM_SIZE - 1)
+
+/** Contents of the FRAM. */
+static unsigned char hostFram[HOST_FRAM_SIZE];
+
+/** Whether the FRAM has been started. */
+static int hostFramStarted = 0;
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+int FRAM_start(void) {
+	hostFramStarted = 1;
+	return E_NO_SS_ERR;
+}
+
+
+void FRAM_stop(void) {
+	hostFramStarted = 0;
+}
+
+
+int FRAM_read(unsigned char* data, unsigned int address, unsigned int size) {
+	if (data == 0)
+		return E_INPUT_POINTER_NULL;
+	if (!hostFramStarted)
+		return E_NOT_INITIALIZED;
+	address &= HOST_FRAM_ADDRESS_MASK;
+	if (size > HOST_FRAM_SIZE - address)
+		return E_PARAM_OUTOFBOUNDS;
+
+	memcpy(data, &hostFram[address], size);
+	return E_NO_SS_ERR;
+}
+
+
+int FRAM_write(const unsigned char* data, unsigned int address, unsigned int size) {
+	if (data == 0)
+		return E_INPUT_POINTER_NULL;
+	if (!hostFramStarted)
+		return E_NOT_INITIALIZED;
+	address &= HOST_FRAM_ADDRESS_MASK;
+	if (size > HOST_FRAM_SIZE - address)
+		return E_PARAM_OUTOFBOUNDS;
+
+	memcpy(&hostFram[address], data, size);
+	return E_NO_SS_ERR;
+}
+
+
+int FRAM_writeAndVerify(const unsigned char* data, unsigned int address, unsigned int size) {
+	return FRAM_write(data, address, size);
+}
+
+
+unsigned int FRAM_getMaxAddress(void) {
+	return HOST_FRAM_SIZE - 1;
+}
@@ -0,0 +1,484 @@
+/**
+ * @file RHostFreeRtos.c
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the FreeRTOS kernel.
+ *
+ * Tasks run as POSIX threads, but only one at a time (as on the single-core iOBC), handing over
+ * whenever the running Task blocks. Time is virtual: a tick is one millisecond, and the clock jumps
+ * straight to the next Task wake-up (or timer expiry) once every Task is blocked. Runs are therefore
+ * repeatable, and a 15 minute pass is simulated in as long as its Tasks take to compute.
+ *
+ * The thread that first calls into the kernel (e.g. the test itself) becomes a Task of the highest
+ * priority. Timer callbacks run on the Task that advances the clock past their expiry. Nothing is
+ * preempted, so critical sections and scheduler suspension need no locking.
+ */
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#include <freertos/timers.h>
+#include <pthread.h>
+#include <stdlib.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** Maximum number of Tasks (including the thread that started the kernel). */
+#define HOST_TASK_MAX	(16)
+
+/** Maximum number of software timers. */
+#define HOST_TIMER_MAX	(16)
+
+/** Index of no Task. */
+#define HOST_NO_TASK	(-1)
+
+
+/** A Task, and the thread running it. */
+typedef struct _host_task_t {
+	pdTASK_CODE code;			///> Task function
+	void* parameters;			///> Task parameters
+	unsigned priority;			///> Priority; breaks ties between Tasks ready at the same time
+	portTickType wake;			///> Time from which the Task is ready to run
+	uint32_t lastRun;			///> Stamp of the last time the Task was given the CPU (round-robin)
+	uint8_t used;				///> Whether the slot holds a Task
+	uint8_t deleted;			///> Whether the Task has been deleted
+	pthread_cond_t turn;		///> Signalled when the Task is given the CPU
+} host_task_t;
+
+
+/** A software timer. */
+typedef struct _host_timer_t {
+	tmrTIMER_CALLBACK callback;	///> Function called on expiry
+	void* timerId;				///> Identifier given on creation
+	portTickType period;		///> Period (ticks)
+	portTickType expiry;		///> Time of the next expiry
+	uint8_t autoReload;			///> Whether the timer restarts on expiry
+	uint8_t active;				///> Whether the timer is running
+} host_timer_t;
+
+
+/** A mutex; owned by at most one Task. */
+typedef struct _host_mutex_t {
+	int owner;					///> Index of the owning Task; HOST_NO_TASK when free
+} host_mutex_t;
+
+
+/** Guards the kernel state; held by a thread only while it changes the state or waits for its turn. */
+static pthread_mutex_t hostKernelLock = PTHREAD_MUTEX_INITIALIZER;
+
+/** All Tasks. */
+static host_task_t hostTasks[HOST_TASK_MAX];
+
+/** All software timers. */
+static host_timer_t hostTimers[HOST_TIMER_MAX];
+
+/** Number of software timers created. */
+static uint8_t hostTimerCount = 0;
+
+/** The current (virtual) time. */
+static portTickType hostNow = 0;
+
+/** Index of the Task holding the CPU. */
+static int hostRunning = HOST_NO_TASK;
+
+/** Running count of CPU hand-overs. */
+static uint32_t hostRuns = 0;
+
+/** Index of the Task of the calling thread. */
+static __thread int hostSelf = HOST_NO_TASK;
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static int hostCurrentTask(void);
+static int hostNewTask(pdTASK_CODE code, void* parameters, unsigned priority);
+static void hostBlockUntil(int self, portTickType wake);
+static void hostSchedule(void);
+static void* hostTaskThread(void* argument);
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+portBASE_TYPE xTaskCreate(pdTASK_CODE code, const signed char* const name, unsigned short stackDepth,
+						  void* parameters, unsigned portBASE_TYPE priority, xTaskHandle* createdTask) {
+	(void)name;
+	(void)stackDepth;
+
+	pthread_mutex_lock(&hostKernelLock);
+	hostCurrentTask();
+
+	int task = hostNewTask(code, parameters, (unsigned)priority);
+	if (task == HOST_NO_TASK) {
+		pthread_mutex_unlock(&hostKernelLock);
+		return pdFAIL;
+	}
+
+	// the new thread waits for its turn; the creator keeps the CPU until it blocks
+	pthread_t thread;
+	if (pthread_create(&thread, 0, hostTaskThread, (void*)(intptr_t)task) != 0) {
+		hostTasks[task].used = 0;
+		pthread_mutex_unlock(&hostKernelLock);
+		return pdFAIL;
+	}
+	pthread_detach(thread);
+
+	if (createdTask != 0)
+		*createdTask = (xTaskHandle)&hostTasks[task];
+
+	pthread_mutex_unlock(&hostKernelLock);
+	return pdPASS;
+}
+
+
+void vTaskDelete(xTaskHandle task) {
+	pthread_mutex_lock(&hostKernelLock);
+	int self = hostCurrentTask();
+
+	int target = (task == 0) ? self : (int)((host_task_t*)task - hostTasks);
+	hostTasks[target].deleted = 1;
+
+	// a Task deleting itself hands over the CPU for good
+	if (target == self) {
+		hostSchedule();
+		pthread_mutex_unlock(&hostKernelLock);
+		pthread_exit(0);
+	}
+
+	pthread_mutex_unlock(&hostKernelLock);
+}
+
+
+void vTaskDelay(portTickType ticks) {
+	pthread_mutex_lock(&hostKernelLock);
+	int self = hostCurrentTask();
+	hostBlockUntil(self, hostNow + ticks);
+	pthread_mutex_unlock(&hostKernelLock);
+}
+
+
+void vTaskDelayUntil(portTickType* previousWakeTime, portTickType period) {
+	pthread_mutex_lock(&hostKernelLock);
+	int self = hostCurrentTask();
+
+	*previousWakeTime += period;
+	portTickType wake = ((int32_t)(*previousWakeTime - hostNow) > 0) ? *previousWakeTime : hostNow;
+	hostBlockUntil(self, wake);
+
+	pthread_mutex_unlock(&hostKernelLock);
+}
+
+
+portTickType xTaskGetTickCount(void) {
+	pthread_mutex_lock(&hostKernelLock);
+	portTickType now = hostNow;
+	pthread_mutex_unlock(&hostKernelLock);
+
+	return now;
+}
+
+
+void vTaskSuspendAll(void) {
+}
+
+
+portBASE_TYPE xTaskResumeAll(void) {
+	return pdFALSE;
+}
+
+
+void vPortEnterCritical(void) {
+}
+
+
+void vPortExitCritical(void) {
+}
+
+
+void* pvPortMalloc(size_t size) {
+	return malloc(size);
+}
+
+
+void vPortFree(void* pointer) {
+	free(pointer);
+}
+
+
+xSemaphoreHandle xSemaphoreCreateMutex(void) {
+	host_mutex_t* mutex = malloc(sizeof(host_mutex_t));
+	if (mutex == 0)
+		return 0;
+
+	mutex->owner = HOST_NO_TASK;
+	return (xSemaphoreHandle)mutex;
+}
+
+
+portBASE_TYPE xSemaphoreTake(xSemaphoreHandle semaphore, portTickType blockTime) {
+	host_mutex_t* mutex = (host_mutex_t*)semaphore;
+
+	pthread_mutex_lock(&hostKernelLock);
+	int self = hostCurrentTask();
+	portTickType deadline = hostNow + blockTime;
+
+	// retry every tick until the owner gives the mutex up (or the block time runs out)
+	while (mutex->owner != HOST_NO_TASK) {
+		if (blockTime != portMAX_DELAY && (int32_t)(hostNow - deadline) >= 0) {
+			pthread_mutex_unlock(&hostKernelLock);
+			return pdFALSE;
+		}
+		hostBlockUntil(self, hostNow + 1);
+	}
+
+	mutex->owner = self;
+	pthread_mutex_unlock(&hostKernelLock);
+	return pdTRUE;
+}
+
+
+portBASE_TYPE xSemaphoreGive(xSemaphoreHandle semaphore) {
+	host_mutex_t* mutex = (host_mutex_t*)semaphore;
+
+	pthread_mutex_lock(&hostKernelLock);
+	int self = hostCurrentTask();
+
+	portBASE_TYPE given = pdFALSE;
+	if (mutex->owner == self) {
+		mutex->owner = HOST_NO_TASK;
+		given = pdTRUE;
+	}
+
+	pthread_mutex_unlock(&hostKernelLock);
+	return given;
+}
+
+
+xTimerHandle xTimerCreate(const signed char* const name, portTickType period, unsigned portBASE_TYPE autoReload,
+						  void* timerId, tmrTIMER_CALLBACK callback) {
+	(void)name;
+
+	pthread_mutex_lock(&hostKernelLock);
+
+	host_timer_t* timer = 0;
+	if (hostTimerCount < HOST_TIMER_MAX) {
+		timer = &hostTimers[hostTimerCount++];
+		timer->callback = callback;
+		timer->timerId = timerId;
+		timer->period = period;
+		timer->autoReload = (uint8_t)autoReload;
+		timer->active = 0;
+	}
+
+	pthread_mutex_unlock(&hostKernelLock);
+	return (xTimerHandle)timer;
+}
+
+
+portBASE_TYPE xTimerStart(xTimerHandle timer, portTickType blockTime) {
+	(void)blockTime;
+
+	if (timer == 0)
+		return pdFAIL;
+
+	pthread_mutex_lock(&hostKernelLock);
+	((host_timer_t*)timer)->expiry = hostNow + ((host_timer_t*)timer)->period;
+	((host_timer_t*)timer)->active = 1;
+	pthread_mutex_unlock(&hostKernelLock);
+
+	return pdPASS;
+}
+
+
+portBASE_TYPE xTimerStop(xTimerHandle timer, portTickType blockTime) {
+	(void)blockTime;
+
+	if (timer == 0)
+		return pdFAIL;
+
+	pthread_mutex_lock(&hostKernelLock);
+	((host_timer_t*)timer)->active = 0;
+	pthread_mutex_unlock(&hostKernelLock);
+
+	return pdPASS;
+}
+
+
+portBASE_TYPE xTimerReset(xTimerHandle timer, portTickType blockTime) {
+	return xTimerStart(timer, blockTime);
+}
+
+
+void* pvTimerGetTimerID(xTimerHandle timer) {
+	return (timer != 0) ? ((host_timer_t*)timer)->timerId : 0;
+}
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Provides the Task of the calling thread, making it a Task (holding the CPU) if it is not one yet.
+ *
+ * @pre The kernel must be locked by the caller.
+ * @return The index of the Task.
+ */
+static int hostCurrentTask(void) {
+	if (hostSelf != HOST_NO_TASK)
+		return hostSelf;
+
+	hostSelf = hostNewTask(0, 0, configMAX_PRIORITIES - 1);
+	if (hostSelf == HOST_NO_TASK)
+		abort();
+
+	if (hostRunning == HOST_NO_TASK)
+		hostRunning = hostSelf;
+
+	// a foreign thread arriving while a Task runs waits for its turn like any other Task
+	while (hostRunning != hostSelf)
+		pthread_cond_wait(&hostTasks[hostSelf].turn, &hostKernelLock);
+
+	return hostSelf;
+}
+
+
+/**
+ * Claims a free Task slot; the Task is ready to run immediately.
+ *
+ * @pre The kernel must be locked by the caller.
+ * @param code The Task function (NULL for a thread that is already running).
+ * @param parameters The Task parameters.
+ * @param priority The Task priority.
+ * @return The index of the Task; HOST_NO_TASK when all slots are used.
+ */
+static int hostNewTask(pdTASK_CODE code, void* parameters, unsigned priority) {
+	for (int i = 0; i < HOST_TASK_MAX; i++) {
+		if (hostTasks[i].used)
+			continue;
+
+		hostTasks[i].code = code;
+		hostTasks[i].parameters = parameters;
+		hostTasks[i].priority = priority;
+		hostTasks[i].wake = hostNow;
+		hostTasks[i].lastRun = hostRuns;
+		hostTasks[i].deleted = 0;
+		hostTasks[i].used = 1;
+		pthread_cond_init(&hostTasks[i].turn, 0);
+		return i;
+	}
+
+	return HOST_NO_TASK;
+}
+
+
+/**
+ * Blocks the calling Task until the given time, handing over the CPU in the meantime.
+ *
+ * @pre The kernel must be locked by the caller, who must be the running Task.
+ * @param self The index of the calling Task.
+ * @param wake The time from which the Task is ready to run again.
+ */
+static void hostBlockUntil(int self, portTickType wake) {
+	hostTasks[self].wake = wake;
+	hostSchedule();
+
+	while (hostRunning != self)
+		pthread_cond_wait(&hostTasks[self].turn, &hostKernelLock);
+}
+
+
+/**
+ * Hands the CPU to the next Task, advancing the time (and firing timers) as required.
+ *
+ * The next Task is the one ready soonest; among those ready at the same time, the highest priority
+ * wins, and Tasks of equal priority take turns.
+ *
+ * @pre The kernel must be locked by the caller.
+ */
+static void hostSchedule(void) {
+	while (1) {
+		int next = HOST_NO_TASK;
+		for (int i = 0; i < HOST_TASK_MAX; i++) {
+			host_task_t* task = &hostTasks[i];
+			if (!task->used || task->deleted)
+				continue;
+
+			if (next == HOST_NO_TASK) {
+				next = i;
+				continue;
+			}
+
+			host_task_t* best = &hostTasks[next];
+			int32_t sooner = (int32_t)(best->wake - task->wake);
+			if (sooner > 0
+			|| (sooner == 0 && task->priority > best->priority)
+			|| (sooner == 0 && task->priority == best->priority && (int32_t)(best->lastRun - task->lastRun) > 0))
+				next = i;
+		}
+
+		// fire the first timer that expires before the next Task wakes up
+		host_timer_t* timer = 0;
+		for (uint8_t i = 0; i < hostTimerCount; i++) {
+			if (hostTimers[i].active && (timer == 0 || (int32_t)(timer->expiry - hostTimers[i].expiry) > 0))
+				timer = &hostTimers[i];
+		}
+
+		if (timer != 0 && (next == HOST_NO_TASK || (int32_t)(hostTasks[next].wake - timer->expiry) >= 0)) {
+			if ((int32_t)(timer->expiry - hostNow) > 0)
+				hostNow = timer->expiry;
+
+			timer->active = timer->autoReload;
+			timer->expiry += timer->period;
+
+			// the callback may use the timer API itself
+			pthread_mutex_unlock(&hostKernelLock);
+			timer->callback((xTimerHandle)timer);
+			pthread_mutex_lock(&hostKernelLock);
+			continue;
+		}
+
+		// nothing left to run
+		if (next == HOST_NO_TASK) {
+			hostRunning = HOST_NO_TASK;
+			return;
+		}
+
+		if ((int32_t)(hostTasks[next].wake - hostNow) > 0)
+			hostNow = hostTasks[next].wake;
+
+		hostTasks[next].lastRun = ++hostRuns;
+		hostRunning = next;
+		pthread_cond_signal(&hostTasks[next].turn);
+		return;
+	}
+}
+
+
+/**
+ * Runs a Task's function on its thread, once the Task is first given the CPU.
+ *
+ * @param argument The index of the Task.
+ * @return Never returns; a Task that returns is deleted.
+ */
+static void* hostTaskThread(void* argument) {
+	int self = (int)(intptr_t)argument;
+
+	pthread_mutex_lock(&hostKernelLock);
+	hostSelf = self;
+	while (hostRunning != self)
+		pthread_cond_wait(&hostTasks[self].turn, &hostKernelLock);
+	pthread_mutex_unlock(&hostKernelLock);
+
+	hostTasks[self].code(hostTasks[self].parameters);
+
+	vTaskDelete(0);
+	return 0;
+}
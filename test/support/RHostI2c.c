@@ -0,0 +1,94 @@
+/**
+ * @file RHostI2c.c
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the ISIS HAL I2C driver: every slave echoes back the last data written to it.
+ */
+
+#include <hal/Drivers/I2C.h>
+#include <hal/errors.h>
+#include <string.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** Number of 7-bit I2C addresses. */
+#define HOST_I2C_SLAVE_COUNT	(128)
+
+/** Largest write remembered per slave (bytes). */
+#define HOST_I2C_BUFFER_SIZE	(256)
+
+/** Last data written to each slave. */
+static struct {
+	unsigned char data[HOST_I2C_BUFFER_SIZE];	///> Data written
+	unsigned int size;							///> Bytes written
+} hostI2cSlaves[HOST_I2C_SLAVE_COUNT];
+
+/** Whether the bus has been started. */
+static int hostI2cStarted = 0;
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+int I2C_start(unsigned int i2cBusSpeed_Hz, unsigned int i2cTransferTimeout) {
+	(void)i2cBusSpeed_Hz;
+	(void)i2cTransferTimeout;
+
+	if (hostI2cStarted)
+		return E_IS_INITIALIZED;
+
+	hostI2cStarted = 1;
+	return E_NO_SS_ERR;
+}
+
+
+void I2C_stop(void) {
+	hostI2cStarted = 0;
+}
+
+
+int I2C_write(unsigned int slaveAddress, const unsigned char* data, unsigned int size) {
+	if (data == 0)
+		return E_INPUT_POINTER_NULL;
+	if (!hostI2cStarted)
+		return E_NOT_INITIALIZED;
+	if (slaveAddress >= HOST_I2C_SLAVE_COUNT || size > HOST_I2C_BUFFER_SIZE)
+		return E_PARAM_OUTOFBOUNDS;
+
+	memcpy(hostI2cSlaves[slaveAddress].data, data, size);
+	hostI2cSlaves[slaveAddress].size = size;
+	return E_NO_SS_ERR;
+}
+
+
+int I2C_read(unsigned int slaveAddress, unsigned char* data, unsigned int size) {
+	if (data == 0)
+		return E_INPUT_POINTER_NULL;
+	if (!hostI2cStarted)
+		return E_NOT_INITIALIZED;
+	if (slaveAddress >= HOST_I2C_SLAVE_COUNT || size > HOST_I2C_BUFFER_SIZE)
+		return E_PARAM_OUTOFBOUNDS;
+
+	// echo the last write, padded with zeros
+	unsigned int echoed = (size < hostI2cSlaves[slaveAddress].size) ? size : hostI2cSlaves[slaveAddress].size;
+	memcpy(data, hostI2cSlaves[slaveAddress].data, echoed);
+	memset(&data[echoed], 0, size - echoed);
+	return E_NO_SS_ERR;
+}
+
+
+int I2C_writeRead(I2Ctransfer* tx) {
+	if (tx == 0)
+		return E_INPUT_POINTER_NULL;
+
+	int error = I2C_write(tx->slaveAddress, tx->writeData, tx->writeSize);
+	if (error != E_NO_SS_ERR)
+		return error;
+
+	return I2C_read(tx->slaveAddress, (unsigned char*)tx->readData, tx->readSize);
+}
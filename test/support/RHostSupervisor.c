@@ -0,0 +1,34 @@
+/**
+ * @file RHostSupervisor.c
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the ISIS HAL Supervisor driver; resets and power cycles end the process.
+ */
+
+#include <hal/supervisor.h>
+#include <hal/errors.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+int Supervisor_reset(supervisor_generic_reply_t* reply, unsigned char index) {
+	(void)reply;
+	(void)index;
+
+	printf("Supervisor: reset requested\n");
+	exit(EXIT_FAILURE);
+}
+
+
+int Supervisor_powerCycleIobc(supervisor_generic_reply_t* reply, unsigned char index) {
+	(void)reply;
+	(void)index;
+
+	printf("Supervisor: power cycle requested\n");
+	exit(EXIT_FAILURE);
+}
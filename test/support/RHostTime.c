@@ -0,0 +1,56 @@
+/**
+ * @file RHostTime.c
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the ISIS HAL Time module. The clock follows the (virtual) FreeRTOS tick count of
+ * the host kernel (see RHostFreeRtos.c), so that time passes exactly as the Tasks see it.
+ */
+
+#include <hal/Timing/Time.h>
+#include <hal/errors.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** Unix epoch at the start of the simulation (s); October 16, 2026. */
+#define HOST_TIME_DEFAULT_EPOCH	((unsigned int)1792108800)
+
+/** Unix epoch at tick 0 (s). */
+static unsigned int hostEpochAtStart = HOST_TIME_DEFAULT_EPOCH;
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+int Time_start(Time* time, const unsigned int syncInterval) {
+	(void)time;
+	(void)syncInterval;
+
+	return E_NO_SS_ERR;
+}
+
+
+int Time_setUnixEpoch(const unsigned int epochTime) {
+	hostEpochAtStart = epochTime - Time_getUptimeSeconds();
+	return E_NO_SS_ERR;
+}
+
+
+int Time_getUnixEpoch(unsigned int* epochTime) {
+	if (epochTime == 0)
+		return E_INPUT_POINTER_NULL;
+
+	*epochTime = hostEpochAtStart + Time_getUptimeSeconds();
+	return E_NO_SS_ERR;
+}
+
+
+unsigned int Time_getUptimeSeconds(void) {
+	return (unsigned int)((xTaskGetTickCount() * portTICK_RATE_MS) / 1000);
+}
@@ -0,0 +1,124 @@
+/**
+ * @file RHostUart.c
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the ISIS HAL UART driver and the debug unit: each UART bus loops its writes back
+ * to its reads, and the debug unit is the host's standard input and output.
+ */
+
+#include <hal/Drivers/UART.h>
+#include <hal/errors.h>
+#include <stdio.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** Size of the loopback buffer of each bus (bytes). */
+#define HOST_UART_BUFFER_SIZE	(4096)
+
+/** Loopback buffer of each bus. */
+static struct {
+	unsigned char data[HOST_UART_BUFFER_SIZE];	///> Circular buffer of written bytes
+	unsigned int head;							///> Index of the next byte to read
+	unsigned int count;							///> Bytes waiting to be read
+	int started;								///> Whether the bus has been started
+} hostUartBuses[UART_BUS_COUNT];
+
+
+/***************************************************************************************************
+                                             PUBLIC API
+***************************************************************************************************/
+
+int UART_start(UARTbus bus, UARTconfig config) {
+	(void)config;
+
+	if (bus >= UART_BUS_COUNT)
+		return E_PARAM_OUTOFBOUNDS;
+
+	hostUartBuses[bus].started = 1;
+	return E_NO_SS_ERR;
+}
+
+
+int UART_stop(UARTbus bus) {
+	if (bus >= UART_BUS_COUNT)
+		return E_PARAM_OUTOFBOUNDS;
+
+	hostUartBuses[bus].started = 0;
+	return E_NO_SS_ERR;
+}
+
+
+int UART_setRxEnabled(UARTbus bus, Boolean enabled) {
+	(void)enabled;
+
+	if (bus >= UART_BUS_COUNT)
+		return E_PARAM_OUTOFBOUNDS;
+
+	return E_NO_SS_ERR;
+}
+
+
+int UART_write(UARTbus bus, const unsigned char* data, unsigned int size) {
+	if (data == 0)
+		return E_INPUT_POINTER_NULL;
+	if (bus >= UART_BUS_COUNT)
+		return E_PARAM_OUTOFBOUNDS;
+	if (!hostUartBuses[bus].started)
+		return E_NOT_INITIALIZED;
+
+	for (unsigned int i = 0; i < size; i++) {
+		// drop the oldest byte when full
+		if (hostUartBuses[bus].count == HOST_UART_BUFFER_SIZE) {
+			hostUartBuses[bus].head = (hostUartBuses[bus].head + 1) % HOST_UART_BUFFER_SIZE;
+			hostUartBuses[bus].count--;
+		}
+		unsigned int tail = (hostUartBuses[bus].head + hostUartBuses[bus].count) % HOST_UART_BUFFER_SIZE;
+		hostUartBuses[bus].data[tail] = data[i];
+		hostUartBuses[bus].count++;
+	}
+
+	return E_NO_SS_ERR;
+}
+
+
+int UART_read(UARTbus bus, unsigned char* data, unsigned int size) {
+	if (data == 0)
+		return E_INPUT_POINTER_NULL;
+	if (bus >= UART_BUS_COUNT)
+		return E_PARAM_OUTOFBOUNDS;
+	if (!hostUartBuses[bus].started)
+		return E_NOT_INITIALIZED;
+
+	// bytes never written read as zero, as a bus that timed out would leave them
+	for (unsigned int i = 0; i < size; i++) {
+		if (hostUartBuses[bus].count == 0) {
+			data[i] = 0;
+			continue;
+		}
+		data[i] = hostUartBuses[bus].data[hostUartBuses[bus].head];
+		hostUartBuses[bus].head = (hostUartBuses[bus].head + 1) % HOST_UART_BUFFER_SIZE;
+		hostUartBuses[bus].count--;
+	}
+
+	return E_NO_SS_ERR;
+}
+
+
+unsigned int DBGU_IsRxReady(void) {
+	return 1;
+}
+
+
+unsigned char DBGU_GetChar(void) {
+	int character = getchar();
+	return (character == EOF) ? '\n' : (unsigned char)character;
+}
+
+
+void DBGU_PutChar(unsigned char character) {
+	putchar(character);
+}
@@ -0,0 +1,37 @@
+/**
+ * @file FreeRTOS.h
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the FreeRTOS kernel (see RHostFreeRtos.c); tasks are POSIX threads that take
+ * turns in virtual time. Only the (old-style) API used by the flight software is provided.
+ */
+
+#ifndef FREERTOS_H_
+#define FREERTOS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t portTickType;
+#define portBASE_TYPE long
+typedef void* xTaskHandle;
+typedef void* xSemaphoreHandle;
+typedef void (*pdTASK_CODE)(void*);
+
+#define configTICK_RATE_HZ			((portTickType)1000)
+#define configMAX_PRIORITIES		(8)
+#define configMINIMAL_STACK_SIZE	(1024)
+
+#define portTICK_RATE_MS			((portTickType)1000 / configTICK_RATE_HZ)
+#define portMAX_DELAY				((portTickType)0xFFFFFFFF)
+
+#define pdFALSE		(0)
+#define pdTRUE		(1)
+#define pdFAIL		(pdFALSE)
+#define pdPASS		(pdTRUE)
+
+void* pvPortMalloc(size_t size);
+void vPortFree(void* pointer);
+
+#endif /* FREERTOS_H_ */
@@ -0,0 +1,18 @@
+/**
+ * @file semphr.h
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the FreeRTOS semaphore API (see RHostFreeRtos.c); only mutexes are provided.
+ */
+
+#ifndef SEMPHR_H_
+#define SEMPHR_H_
+
+#include <freertos/FreeRTOS.h>
+
+xSemaphoreHandle xSemaphoreCreateMutex(void);
+portBASE_TYPE xSemaphoreTake(xSemaphoreHandle semaphore, portTickType blockTime);
+portBASE_TYPE xSemaphoreGive(xSemaphoreHandle semaphore);
+
+#endif /* SEMPHR_H_ */
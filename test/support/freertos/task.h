@@ -0,0 +1,29 @@
+/**
+ * @file task.h
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the FreeRTOS task API (see RHostFreeRtos.c).
+ */
+
+#ifndef TASK_H_
+#define TASK_H_
+
+#include <freertos/FreeRTOS.h>
+
+portBASE_TYPE xTaskCreate(pdTASK_CODE code, const signed char* const name, unsigned short stackDepth,
+						  void* parameters, unsigned portBASE_TYPE priority, xTaskHandle* createdTask);
+void vTaskDelete(xTaskHandle task);
+void vTaskDelay(portTickType ticks);
+void vTaskDelayUntil(portTickType* previousWakeTime, portTickType period);
+portTickType xTaskGetTickCount(void);
+void vTaskSuspendAll(void);
+portBASE_TYPE xTaskResumeAll(void);
+
+void vPortEnterCritical(void);
+void vPortExitCritical(void);
+
+#define taskENTER_CRITICAL()	vPortEnterCritical()
+#define taskEXIT_CRITICAL()		vPortExitCritical()
+
+#endif /* TASK_H_ */
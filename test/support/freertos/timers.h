@@ -0,0 +1,24 @@
+/**
+ * @file timers.h
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the FreeRTOS software timer API (see RHostFreeRtos.c).
+ */
+
+#ifndef TIMERS_H_
+#define TIMERS_H_
+
+#include <freertos/FreeRTOS.h>
+
+typedef void* xTimerHandle;
+typedef void (*tmrTIMER_CALLBACK)(xTimerHandle timer);
+
+xTimerHandle xTimerCreate(const signed char* const name, portTickType period, unsigned portBASE_TYPE autoReload,
+						  void* timerId, tmrTIMER_CALLBACK callback);
+portBASE_TYPE xTimerStart(xTimerHandle timer, portTickType blockTime);
+portBASE_TYPE xTimerStop(xTimerHandle timer, portTickType blockTime);
+portBASE_TYPE xTimerReset(xTimerHandle timer, portTickType blockTime);
+void* pvTimerGetTimerID(xTimerHandle timer);
+
+#endif /* TIMERS_H_ */
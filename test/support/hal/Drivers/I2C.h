@@ -0,0 +1,28 @@
+/**
+ * @file I2C.h
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the ISIS HAL I2C driver (see RHostI2c.c).
+ */
+
+#ifndef HAL_I2C_H_
+#define HAL_I2C_H_
+
+/** A combined write-then-read transfer. */
+typedef struct _I2Ctransfer {
+	unsigned int slaveAddress;			///< Address of the slave
+	unsigned int writeSize;				///< Bytes to write
+	unsigned int readSize;				///< Bytes to read
+	unsigned char* writeData;			///< Data to write
+	volatile unsigned char* readData;	///< Buffer for the data read
+	unsigned int writeReadDelay;		///< Delay (in ticks) between the write and the read
+} I2Ctransfer;
+
+int I2C_start(unsigned int i2cBusSpeed_Hz, unsigned int i2cTransferTimeout);
+void I2C_stop(void);
+int I2C_write(unsigned int slaveAddress, const unsigned char* data, unsigned int size);
+int I2C_read(unsigned int slaveAddress, unsigned char* data, unsigned int size);
+int I2C_writeRead(I2Ctransfer* tx);
+
+#endif /* HAL_I2C_H_ */
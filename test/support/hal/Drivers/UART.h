@@ -0,0 +1,48 @@
+/**
+ * @file UART.h
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the ISIS HAL UART driver (see RHostUart.c).
+ */
+
+#ifndef HAL_UART_H_
+#define HAL_UART_H_
+
+#include <hal/boolean.h>
+
+/** Mode bits of the AT91 USART; accepted (and ignored) by the stand-in. */
+#define AT91C_US_USMODE_NORMAL	(0x0u)
+#define AT91C_US_CLKS_CLOCK		(0x0u)
+#define AT91C_US_CHRL_8_BITS	(0x3u << 6)
+#define AT91C_US_PAR_NONE		(0x4u << 9)
+#define AT91C_US_NBSTOP_1_BIT	(0x0u)
+#define AT91C_US_OVER_16		(0x0u)
+
+typedef enum _UARTbus {
+	bus0_uart = 0,
+	bus2_uart = 1,
+	UART_BUS_COUNT = 2,
+} UARTbus;
+
+typedef enum _UARTbusType {
+	rs232_uart = 0,
+	rs422_noTermination_uart = 1,
+	rs422_withTermination_uart = 2,
+} UARTbusType;
+
+typedef struct _UARTconfig {
+	unsigned int mode;
+	unsigned int baudrate;
+	unsigned char timeGuard;
+	UARTbusType busType;
+	unsigned short rxtimeout;
+} UARTconfig;
+
+int UART_start(UARTbus bus, UARTconfig config);
+int UART_stop(UARTbus bus);
+int UART_setRxEnabled(UARTbus bus, Boolean enabled);
+int UART_write(UARTbus bus, const unsigned char* data, unsigned int size);
+int UART_read(UARTbus bus, unsigned char* data, unsigned int size);
+
+#endif /* HAL_UART_H_ */
@@ -0,0 +1,19 @@
+/**
+ * @file FRAM.h
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the ISIS HAL FRAM driver (see RHostFram.c).
+ */
+
+#ifndef HAL_FRAM_H_
+#define HAL_FRAM_H_
+
+int FRAM_start(void);
+void FRAM_stop(void);
+int FRAM_read(unsigned char* data, unsigned int address, unsigned int size);
+int FRAM_write(const unsigned char* data, unsigned int address, unsigned int size);
+int FRAM_writeAndVerify(const unsigned char* data, unsigned int address, unsigned int size);
+unsigned int FRAM_getMaxAddress(void);
+
+#endif /* HAL_FRAM_H_ */
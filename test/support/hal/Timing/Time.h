@@ -0,0 +1,29 @@
+/**
+ * @file Time.h
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the ISIS HAL Time module (see RHostTime.c).
+ */
+
+#ifndef HAL_TIME_H_
+#define HAL_TIME_H_
+
+/** A calendar time; the stand-in only uses it to start the clock. */
+typedef struct __attribute__((packed)) _Time {
+	unsigned char seconds;
+	unsigned char minutes;
+	unsigned char hours;
+	unsigned char day;
+	unsigned char date;
+	unsigned char month;
+	unsigned char year;
+	unsigned int secondsOfYear;
+} Time;
+
+int Time_start(Time* time, const unsigned int syncInterval);
+int Time_setUnixEpoch(const unsigned int epochTime);
+int Time_getUnixEpoch(unsigned int* epochTime);
+unsigned int Time_getUptimeSeconds(void);
+
+#endif /* HAL_TIME_H_ */
@@ -0,0 +1,17 @@
+/**
+ * @file boolean.h
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the ISIS HAL boolean type.
+ */
+
+#ifndef HAL_BOOLEAN_H_
+#define HAL_BOOLEAN_H_
+
+typedef unsigned char Boolean;
+
+#define TRUE	(1)
+#define FALSE	(0)
+
+#endif /* HAL_BOOLEAN_H_ */
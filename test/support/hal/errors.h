@@ -0,0 +1,18 @@
+/**
+ * @file errors.h
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the ISIS HAL error codes; only those used by the flight software are defined.
+ */
+
+#ifndef HAL_ERRORS_H_
+#define HAL_ERRORS_H_
+
+#define E_NO_SS_ERR				(0)
+#define E_PARAM_OUTOFBOUNDS		(-13)
+#define E_IS_INITIALIZED		(-17)
+#define E_NOT_INITIALIZED		(-18)
+#define E_INPUT_POINTER_NULL	(-19)
+
+#endif /* HAL_ERRORS_H_ */
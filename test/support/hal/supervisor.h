@@ -0,0 +1,24 @@
+/**
+ * @file supervisor.h
+ * @date October 16, 2026
+ * @author
+ *
+ * Host stand-in for the ISIS HAL Supervisor driver (see RHostSupervisor.c).
+ */
+
+#ifndef HAL_SUPERVISOR_H_
+#define HAL_SUPERVISOR_H_
+
+#define SUPERVISOR_SPI_INDEX	(0)
+
+/** Generic reply of the Supervisor; the stand-in never fills it in. */
+typedef struct _supervisor_generic_reply_t {
+	unsigned char dummy;
+	unsigned char spiCommandStatus;
+	unsigned char crc8;
+} supervisor_generic_reply_t;
+
+int Supervisor_reset(supervisor_generic_reply_t* reply, unsigned char index);
+int Supervisor_powerCycleIobc(supervisor_generic_reply_t* reply, unsigned char index);
+
+#endif /* HAL_SUPERVISOR_H_ */
@@ -0,0 +1,1169 @@
+/**
+ * @file test_bench.c
+ * @date October 16, 2026
+ * @author
+ *
+ * Host benchmark of the message and File Transfer paths (and the CubeSense telemetry unescaping, and
+ * the compression of images for downlink); run with "ceedling test:bench".
+ *
+ * Each test times many calls of one function against the host stand-ins (see test/support) and
+ * prints the average cost per call (and per byte, for functions that process a buffer). Host timings do not carry over to the iOBC in absolute terms,
+ * but they are repeatable, so they show whether a change made a path faster or slower.
+ */
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <hal/Timing/Time.h>
+#include <hal/errors.h>
+
+#include <RMessage.h>
+#include <RProtobuf.h>
+#include <pb_common.h>
+#include <pb_encode.h>
+#include <pb_decode.h>
+#include <RRadsat.pb.h>
+#include <RFileTransfer.pb.h>
+#include <RProtocol.pb.h>
+#include <RTelecommands.pb.h>
+#include <crc.h>
+#include <RXorCipher.h>
+#include <RKey.h>
+#include <RFram.h>
+#include <RFileTransferService.h>
+#include <RFileTransferSeries.h>
+#include <pb_direct.h>
+#include <RTransceiverSim.h>
+#include <RTransceiver.h>
+#include <RErrorManager.h>
+#include <RDebug.h>
+#include <RUart.h>
+#include <RCubeSenseSim.h>
+#include <RCameraCommon.h>
+#include <RI2c.h>
+#include <RDosimeter.h>
+#include <RTelecommandService.h>
+#include <RReedSolomon.h>
+#include <RImageCompression.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** Number of calls timed by each of the message benchmarks. */
+#define BENCH_MESSAGE_ITERATIONS	(200000)
+
+/** Number of calls timed by each of the File Transfer (FRAM) benchmarks. */
+#define BENCH_FILE_TRANSFER_ITERATIONS	(20000)
+
+/** Number of frames downlinked per pass of the next frame benchmark (fills the bulk queue). */
+#define BENCH_FRAMES_PER_PASS	(100)
+
+/** Longest a packed frame waits before it is stored (see PACK_MAX_AGE_MS in RFileTransferService.c). */
+#define BENCH_PACK_MAX_AGE_MS	(10*60*1000)
+
+/** Message wrapped and unwrapped by the benchmarks; an image packet fills a frame on its own. */
+static radsat_message benchMessage;
+
+/** A wrapped copy of the benchmark message. */
+static uint8_t benchWrapped[TRANCEIVER_TX_MAX_FRAME_SIZE];
+
+/** Size of the wrapped copy of the benchmark message. */
+static uint8_t benchWrappedSize;
+
+/** Private key stored for the uplink path (see RKey.c). */
+#define BENCH_PRIVATE_KEY	(0x5A)
+
+/** FRAM addresses of the three copies of the private key (see RKey.c). */
+static const uint32_t benchKeyAddresses[] = { 0x1001AA00, 0x1001AA04, 0x1001AA08 };
+
+/** A fixed-layout message, with both its generic (NanoPB) and direct (straight-line) coders. */
+typedef struct _bench_direct_message_t {
+	const char* name;											///> The name of the message
+	const pb_msgdesc_t* fields;									///> The NanoPB layout of the message
+	size_t structSize;											///> The size of the message struct
+	size_t (*encodedSize)(const void* message);					///> Direct encoded size
+	pb_byte_t* (*encode)(pb_byte_t* buffer, const void* message);	///> Direct encoder
+	bool (*decode)(const pb_byte_t* buffer, size_t size, void* message);	///> Direct decoder
+} bench_direct_message_t;
+
+#define BENCH_DIRECT_MESSAGE(message)	{ #message, &message##_msg, sizeof(message), message##_encoded_size_direct, message##_encode_direct, message##_decode_direct }
+
+/** The hot-path messages given direct coders (see generate-proto.sh). */
+static const bench_direct_message_t benchDirectMessages[] = {
+	BENCH_DIRECT_MESSAGE(dosimeter_data),
+	BENCH_DIRECT_MESSAGE(battery_telemetry),
+	BENCH_DIRECT_MESSAGE(eps_telemetry),
+	BENCH_DIRECT_MESSAGE(transceiver_telemetry),
+};
+
+#define BENCH_DIRECT_MESSAGE_COUNT	(sizeof(benchDirectMessages) / sizeof(benchDirectMessages[0]))
+
+/** Room for any of the messages with direct coders. */
+typedef union _bench_direct_struct_t {
+	dosimeter_data dosimeter;
+	battery_telemetry battery;
+	eps_telemetry eps;
+	transceiver_telemetry transceiver;
+} bench_direct_struct_t;
+
+/** Number of dosimeter records grouped into series by the series test. */
+#define BENCH_SERIES_RECORDS	(100)
+
+/** Size of the CubeSense telemetry unescaped by the camera benchmarks (an image frame, TLM 64). */
+#define BENCH_TELEMETRY_SIZE	(CAMERA_TELEMETRY_MAX_LEN)
+
+/** Largest size of that telemetry on the bus (every data byte an escape character). */
+#define BENCH_TELEMETRY_ESCAPED_SIZE	((2 * BENCH_TELEMETRY_SIZE) - BASE_MESSAGE_LEN)
+
+/** Width (and height) of the sample images compressed by the image benchmark (full resolution). */
+#define BENCH_IMAGE_WIDTH		(1024)
+
+/** Number of frames of each sample image. */
+#define BENCH_IMAGE_FRAMES		((BENCH_IMAGE_WIDTH * BENCH_IMAGE_WIDTH) / IMAGE_COMPRESSION_FRAME_SIZE)
+
+/** Number of times each sample image is compressed and decompressed by the image benchmark. */
+#define BENCH_IMAGE_ITERATIONS	(3)
+
+/** The sample images compressed by the image benchmark. */
+typedef enum _bench_image_t {
+	benchImageDarkSky	= 0,	///< Black sky, a few stars, and sensor noise
+	benchImageSun		= 1,	///< The Sun's disk (darkening towards its limb) on the black sky
+	benchImageEarth		= 2,	///< Smooth land and cloud (sums of sines), with sensor noise
+	benchImagePattern	= 3,	///< The frames of the simulated CubeSense
+	benchImageNoise		= 4,	///< Uniform noise; does not compress
+	benchImageCount		= 5,	///< Number of sample images (not a sample image)
+} bench_image_t;
+
+/** The names of the sample images. */
+static const char* benchImageNames[] = { "dark sky", "sun", "earth", "sim pattern", "noise" };
+
+/** The sample image being compressed, and its decompressed copy. */
+static uint8_t benchImage[BENCH_IMAGE_WIDTH * BENCH_IMAGE_WIDTH];
+static uint8_t benchDecoded[BENCH_IMAGE_WIDTH * BENCH_IMAGE_WIDTH];
+
+/** A packet of the compressed sample image. */
+typedef struct _bench_image_packet_t {
+	uint16_t firstFrame;						///> The index of its first frame
+	uint8_t frames;								///> The number of frames it holds
+	uint8_t size;								///> The size of its compressed data
+	uint8_t data[IMAGE_COMPRESSION_MAX_SIZE];	///> Its compressed data
+} bench_image_packet_t;
+
+/** The packets of the compressed sample image (at most a frame each). */
+static bench_image_packet_t benchImagePackets[BENCH_IMAGE_FRAMES];
+
+/** Keeps the compiler from discarding the results of the timed calls. */
+static volatile uint32_t benchSink;
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static uint64_t benchNow(void);
+static void benchReport(const char* name, uint64_t elapsed, uint32_t calls);
+static void benchReportBytes(const char* name, uint64_t elapsed, uint32_t calls, uint32_t bytesPerCall);
+static void benchFillBulkQueue(void);
+static int benchXorDecryptBytewise(uint8_t* buffer, uint8_t size);
+static uint16_t benchEscapeTelemetry(uint8_t* escaped, uint8_t fill);
+static uint16_t benchUnescapeMemmove(uint8_t* buffer, uint8_t size, const uint8_t* escaped);
+static uint16_t benchUnescapeChunked(uint8_t* buffer, uint8_t size, const uint8_t* escaped);
+static void benchFillDirect(bench_direct_struct_t* message);
+static uint16_t benchSeriesDecode(const dosimeter_series* series, dosimeter_counts* records, uint16_t maxRecords);
+static void benchFillImage(bench_image_t sample);
+static uint16_t benchCompressImage(uint8_t maxError);
+static uint32_t benchDecompressImage(uint16_t packets, uint8_t maxError);
+
+
+/***************************************************************************************************
+                                               SETUP
+***************************************************************************************************/
+
+void setUp(void) {
+	Time time = { 0 };
+	Time_start(&time, 0);
+
+	// the FRAM stays started from one test to the next
+	int error = framInit();
+	TEST_ASSERT_TRUE(error == 0 || error == E_IS_INITIALIZED);
+
+	uint8_t key = BENCH_PRIVATE_KEY;
+	for (uint8_t i = 0; i < sizeof(benchKeyAddresses) / sizeof(benchKeyAddresses[0]); i++)
+		TEST_ASSERT_EQUAL_INT(0, framWrite(&key, benchKeyAddresses[i], sizeof(key)));
+
+	TEST_ASSERT_EQUAL_INT(0, fileTransferInit());
+	fileTransferReset();
+
+	memset(&benchMessage, 0, sizeof(benchMessage));
+	benchMessage.which_service = radsat_message_FileTransferMessage_tag;
+	benchMessage.FileTransferMessage.which_message = file_transfer_message_ImagePacket_tag;
+	benchMessage.FileTransferMessage.ImagePacket.id = 1234;
+	benchMessage.FileTransferMessage.ImagePacket.type = image_type_t_Thumbnail;
+	benchMessage.FileTransferMessage.ImagePacket.data.size = sizeof(benchMessage.FileTransferMessage.ImagePacket.data.bytes);
+	for (uint16_t i = 0; i < benchMessage.FileTransferMessage.ImagePacket.data.size; i++)
+		benchMessage.FileTransferMessage.ImagePacket.data.bytes[i] = (uint8_t)i;
+
+	// uplinked messages arrive encrypted; the cipher is its own inverse
+	benchWrappedSize = messageWrap(&benchMessage, benchWrapped);
+	TEST_ASSERT_NOT_EQUAL(0, benchWrappedSize);
+	TEST_ASSERT_EQUAL_INT(0, xorDecrypt(benchWrapped, benchWrappedSize));
+}
+
+
+void tearDown(void) {
+}
+
+
+/***************************************************************************************************
+                                             BENCHMARKS
+***************************************************************************************************/
+
+void test_messageWrap(void) {
+	uint8_t wrapped[TRANCEIVER_TX_MAX_FRAME_SIZE];
+
+	uint64_t start = benchNow();
+	for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++)
+		benchSink += messageWrap(&benchMessage, wrapped);
+	benchReport("messageWrap", benchNow() - start, BENCH_MESSAGE_ITERATIONS);
+
+	TEST_ASSERT_EQUAL_UINT32(BENCH_MESSAGE_ITERATIONS * (uint32_t)benchWrappedSize, benchSink);
+	benchSink = 0;
+}
+
+
+void test_messageWrapInPlace(void) {
+	uint8_t wrapped[TRANCEIVER_TX_MAX_FRAME_SIZE];
+	uint8_t encoded[TRANCEIVER_TX_MAX_FRAME_SIZE];
+	const image_packet* packet = &benchMessage.FileTransferMessage.ImagePacket;
+
+	uint64_t start = benchNow();
+	for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++)
+		benchSink += messageWrapInPlace(radsat_message_FileTransferMessage_tag, file_transfer_message_ImagePacket_tag, packet, wrapped);
+	benchReport("messageWrapInPlace", benchNow() - start, BENCH_MESSAGE_ITERATIONS);
+
+	TEST_ASSERT_EQUAL_UINT32(BENCH_MESSAGE_ITERATIONS * (uint32_t)benchWrappedSize, benchSink);
+	benchSink = 0;
+
+	// encoded exactly as if it had been placed into a radsat_message
+	uint8_t encodedSize = protoEncode(&benchMessage, encoded);
+	TEST_ASSERT_EQUAL_INT(0, memcmp(encoded, &wrapped[RADSAT_SK_HEADER_SIZE], encodedSize));
+}
+
+
+void test_messageUnwrap(void) {
+	uint8_t wrapped[TRANCEIVER_TX_MAX_FRAME_SIZE];
+	radsat_message message;
+
+	// unwrapping decrypts in place, so each call works on a fresh copy
+	uint64_t start = benchNow();
+	for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++) {
+		memcpy(wrapped, benchWrapped, benchWrappedSize);
+		benchSink += messageUnwrap(wrapped, benchWrappedSize, &message);
+	}
+	benchReport("messageUnwrap", benchNow() - start, BENCH_MESSAGE_ITERATIONS);
+
+	TEST_ASSERT_NOT_EQUAL(0, benchSink);
+	TEST_ASSERT_EQUAL_UINT32(benchMessage.FileTransferMessage.ImagePacket.id, message.FileTransferMessage.ImagePacket.id);
+	benchSink = 0;
+}
+
+
+void test_messageUnwrapRejected(void) {
+	uint8_t wrapped[TRANCEIVER_TX_MAX_FRAME_SIZE];
+	radsat_message message;
+
+	// a frame with a damaged payload is only caught by its CRC
+	memcpy(wrapped, benchWrapped, benchWrappedSize);
+	wrapped[benchWrappedSize - 1] ^= 0x01;
+	TEST_ASSERT_EQUAL_INT(0, messageUnwrap(wrapped, benchWrappedSize, &message));
+
+	// a junk frame (e.g. from another transmitter) is caught by its header
+	uint64_t start = benchNow();
+	for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++) {
+		memcpy(wrapped, benchWrapped, benchWrappedSize);
+		wrapped[0] ^= 0x01;
+		benchSink += messageUnwrap(wrapped, benchWrappedSize, &message);
+	}
+	benchReport("messageUnwrap (junk)", benchNow() - start, BENCH_MESSAGE_ITERATIONS);
+
+	TEST_ASSERT_EQUAL_UINT32(0, benchSink);
+}
+
+
+void test_messageCompact(void) {
+	uint8_t wrapped[TRANCEIVER_TX_MAX_FRAME_SIZE];
+	uint8_t plain[TRANCEIVER_TX_MAX_FRAME_SIZE];
+
+	// downlinked messages are not encrypted
+	uint8_t plainSize = messageWrap(&benchMessage, plain);
+	radsat_sk_header_t* header = (radsat_sk_header_t*)plain;
+
+	// disabled (the default), the full header is kept
+	memcpy(wrapped, plain, plainSize);
+	TEST_ASSERT_EQUAL_UINT8(plainSize, messageCompact(wrapped, plainSize));
+	TEST_ASSERT_EQUAL_INT(0, memcmp(wrapped, plain, plainSize));
+
+	// a timestamp shortly after the base time takes a single byte
+	messageCompactHeaders(1, header->timestamp - 10);
+
+	uint64_t start = benchNow();
+	for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++) {
+		memcpy(wrapped, plain, plainSize);
+		benchSink += messageCompact(wrapped, plainSize);
+	}
+	benchReport("messageCompact", benchNow() - start, BENCH_MESSAGE_ITERATIONS);
+
+	messageCompactHeaders(0, 0);
+
+	uint8_t compactSize = (uint8_t)(plainSize - RADSAT_SK_HEADER_SIZE + sizeof(radsat_sk_compact_header_t) + 1);
+	TEST_ASSERT_EQUAL_UINT32(BENCH_MESSAGE_ITERATIONS * (uint32_t)compactSize, benchSink);
+	benchSink = 0;
+
+	radsat_sk_compact_header_t* compact = (radsat_sk_compact_header_t*)wrapped;
+	TEST_ASSERT_EQUAL_UINT8(RADSAT_SK_COMPACT_HEADER_TYPE, compact->type);
+	TEST_ASSERT_EQUAL_UINT8(header->size, compact->size);
+	TEST_ASSERT_EQUAL_UINT16(crcFast(&wrapped[RADSAT_SK_COMPACT_HEADER_CRC_OFFSET], compactSize - RADSAT_SK_COMPACT_HEADER_CRC_OFFSET), compact->crc);
+
+	// the timestamp is a zig-zag varint (+10 -> 20), followed by the untouched message
+	TEST_ASSERT_EQUAL_UINT8(20, wrapped[sizeof(radsat_sk_compact_header_t)]);
+	TEST_ASSERT_EQUAL_INT(0, memcmp(&wrapped[sizeof(radsat_sk_compact_header_t) + 1], &plain[RADSAT_SK_HEADER_SIZE], header->size));
+}
+
+
+void test_rsEncode(void) {
+	uint8_t frame[TRANCEIVER_TX_MAX_FRAME_SIZE];
+	uint8_t damaged[TRANCEIVER_TX_MAX_FRAME_SIZE];
+
+	// a full-size downlink frame, with the most parity bytes
+	uint8_t size = messageWrap(&benchMessage, frame);
+	rsConfigure(RS_MAX_PARITY_SIZE);
+
+	uint64_t start = benchNow();
+	for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++)
+		benchSink += rsEncode(frame, size);
+	benchReportBytes("rsEncode", benchNow() - start, BENCH_MESSAGE_ITERATIONS, size);
+
+	TEST_ASSERT_EQUAL_UINT32(BENCH_MESSAGE_ITERATIONS * (uint32_t)(size + RS_MAX_PARITY_SIZE), benchSink);
+	benchSink = 0;
+
+	// an intact frame needs no repair
+	uint8_t encodedSize = size + RS_MAX_PARITY_SIZE;
+	TEST_ASSERT_EQUAL_INT(0, rsDecode(frame, encodedSize, RS_MAX_PARITY_SIZE));
+
+	// up to half as many damaged bytes as parity bytes are repaired, wherever they are (parity included)
+	memcpy(damaged, frame, encodedSize);
+	damaged[0] ^= 0xFF;
+	damaged[size / 2] ^= 0x01;
+	damaged[size - 1] ^= 0x5A;
+	damaged[encodedSize - 1] ^= 0x80;
+
+	start = benchNow();
+	for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++) {
+		uint8_t copy[TRANCEIVER_TX_MAX_FRAME_SIZE];
+		memcpy(copy, damaged, encodedSize);
+		benchSink += rsDecode(copy, encodedSize, RS_MAX_PARITY_SIZE);
+	}
+	benchReportBytes("rsDecode (4 damaged bytes)", benchNow() - start, BENCH_MESSAGE_ITERATIONS, encodedSize);
+
+	TEST_ASSERT_EQUAL_UINT32(BENCH_MESSAGE_ITERATIONS * 4, benchSink);
+	benchSink = 0;
+
+	TEST_ASSERT_EQUAL_INT(4, rsDecode(damaged, encodedSize, RS_MAX_PARITY_SIZE));
+	TEST_ASSERT_EQUAL_INT(0, memcmp(damaged, frame, encodedSize));
+
+	// any more cannot be repaired, and are left to the CRC
+	damaged[1] ^= 0x11;
+	damaged[2] ^= 0x22;
+	damaged[3] ^= 0x33;
+	damaged[4] ^= 0x44;
+	damaged[5] ^= 0x55;
+	TEST_ASSERT_TRUE(rsDecode(damaged, encodedSize, RS_MAX_PARITY_SIZE) < 0);
+
+	rsConfigure(0);
+	TEST_ASSERT_EQUAL_UINT8(size, rsEncode(frame, size));
+}
+
+
+void test_crcSlow(void) {
+	uint32_t size = benchWrappedSize - RADSAT_SK_HEADER_CRC_OFFSET;
+
+	uint64_t start = benchNow();
+	for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++)
+		benchSink += crcSlow(&benchWrapped[RADSAT_SK_HEADER_CRC_OFFSET], size);
+	benchReportBytes("crcSlow", benchNow() - start, BENCH_MESSAGE_ITERATIONS, size);
+
+	benchSink = 0;
+}
+
+
+void test_crcFast(void) {
+	uint32_t size = benchWrappedSize - RADSAT_SK_HEADER_CRC_OFFSET;
+
+	uint64_t start = benchNow();
+	for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++)
+		benchSink += crcFast(&benchWrapped[RADSAT_SK_HEADER_CRC_OFFSET], size);
+	benchReportBytes("crcFast", benchNow() - start, BENCH_MESSAGE_ITERATIONS, size);
+
+	// the table-driven CRC must match the bit-by-bit one
+	TEST_ASSERT_EQUAL_UINT32(crcSlow(&benchWrapped[RADSAT_SK_HEADER_CRC_OFFSET], size),
+							 crcFast(&benchWrapped[RADSAT_SK_HEADER_CRC_OFFSET], size));
+	benchSink = 0;
+}
+
+
+void test_crcUpdate(void) {
+	uint32_t size = benchWrappedSize - RADSAT_SK_HEADER_CRC_OFFSET;
+	uint32_t half = size / 2;
+
+	// a frame processed in two (unaligned) pieces, as when streaming
+	uint64_t start = benchNow();
+	for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++) {
+		crc_t remainder = crcUpdate(crcBegin(), &benchWrapped[RADSAT_SK_HEADER_CRC_OFFSET], half);
+		benchSink += crcEnd(crcUpdate(remainder, &benchWrapped[RADSAT_SK_HEADER_CRC_OFFSET + half], size - half));
+	}
+	benchReportBytes("crcBegin/Update/End", benchNow() - start, BENCH_MESSAGE_ITERATIONS, size);
+
+	TEST_ASSERT_EQUAL_UINT32(BENCH_MESSAGE_ITERATIONS * (uint32_t)crcSlow(&benchWrapped[RADSAT_SK_HEADER_CRC_OFFSET], size), benchSink);
+	benchSink = 0;
+}
+
+
+void test_xorDecryptBytewise(void) {
+	uint8_t buffer[TRANCEIVER_TX_MAX_FRAME_SIZE];
+	memcpy(buffer, benchWrapped, sizeof(buffer));
+
+	uint64_t start = benchNow();
+	for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++)
+		benchSink += benchXorDecryptBytewise(buffer, sizeof(buffer));
+	benchReportBytes("xorDecrypt (byte-wise)", benchNow() - start, BENCH_MESSAGE_ITERATIONS, sizeof(buffer));
+
+	// an even number of passes leaves the buffer as it was
+	TEST_ASSERT_EQUAL_UINT32(0, benchSink);
+	TEST_ASSERT_EQUAL_INT(0, memcmp(buffer, benchWrapped, sizeof(buffer)));
+}
+
+
+void test_xorDecrypt(void) {
+	uint8_t buffer[TRANCEIVER_TX_MAX_FRAME_SIZE + 4];
+	uint8_t expected[TRANCEIVER_TX_MAX_FRAME_SIZE];
+
+	// the same result as the byte-wise cipher, at every alignment and for every length of tail
+	for (uint8_t offset = 0; offset < 4; offset++) {
+		uint8_t size = (uint8_t)(sizeof(expected) - offset);
+		memcpy(&buffer[offset], benchWrapped, size);
+		memcpy(expected, benchWrapped, size);
+		TEST_ASSERT_EQUAL_INT(0, xorDecrypt(&buffer[offset], size));
+		TEST_ASSERT_EQUAL_INT(0, benchXorDecryptBytewise(expected, size));
+		TEST_ASSERT_EQUAL_INT(0, memcmp(&buffer[offset], expected, size));
+	}
+
+	memcpy(buffer, benchWrapped, sizeof(expected));
+
+	uint64_t start = benchNow();
+	for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++)
+		benchSink += xorDecrypt(buffer, sizeof(expected));
+	benchReportBytes("xorDecrypt", benchNow() - start, BENCH_MESSAGE_ITERATIONS, sizeof(expected));
+
+	TEST_ASSERT_EQUAL_UINT32(0, benchSink);
+	TEST_ASSERT_EQUAL_INT(0, memcmp(buffer, benchWrapped, sizeof(expected)));
+}
+
+
+void test_unescapeMemmove(void) {
+	uint8_t escaped[BENCH_TELEMETRY_ESCAPED_SIZE];
+	uint8_t buffer[BENCH_TELEMETRY_SIZE];
+	const uint8_t fills[] = { 0, ESCAPE_CHARACTER };
+	const char* names[] = { "unescape (memmove, image frame)", "unescape (memmove, all escapes)" };
+
+	for (uint8_t f = 0; f < sizeof(fills); f++) {
+		uint16_t escapedSize = benchEscapeTelemetry(escaped, fills[f]);
+
+		uint64_t start = benchNow();
+		for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++)
+			benchSink += benchUnescapeMemmove(buffer, sizeof(buffer), escaped);
+		benchReportBytes(names[f], benchNow() - start, BENCH_MESSAGE_ITERATIONS, sizeof(buffer));
+
+		TEST_ASSERT_EQUAL_UINT32(BENCH_MESSAGE_ITERATIONS * escapedSize, benchSink);
+		benchSink = 0;
+	}
+}
+
+
+void test_unescapeTelemetry(void) {
+	uint8_t escaped[BENCH_TELEMETRY_ESCAPED_SIZE];
+	uint8_t buffer[BENCH_TELEMETRY_SIZE];
+	uint8_t expected[BENCH_TELEMETRY_SIZE];
+	const uint8_t fills[] = { 0, ESCAPE_CHARACTER };
+	const char* names[] = { "unescapeTelemetry (image frame)", "unescapeTelemetry (all escapes)" };
+
+	for (uint8_t f = 0; f < sizeof(fills); f++) {
+		uint16_t escapedSize = benchEscapeTelemetry(escaped, fills[f]);
+
+		// the same reply as the original unescaping, reading no further than it
+		TEST_ASSERT_EQUAL_UINT16(escapedSize, benchUnescapeMemmove(expected, sizeof(expected), escaped));
+		TEST_ASSERT_EQUAL_UINT16(escapedSize, benchUnescapeChunked(buffer, sizeof(buffer), escaped));
+		TEST_ASSERT_EQUAL_INT(0, memcmp(buffer, expected, sizeof(buffer)));
+
+		uint64_t start = benchNow();
+		for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++)
+			benchSink += benchUnescapeChunked(buffer, sizeof(buffer), escaped);
+		benchReportBytes(names[f], benchNow() - start, BENCH_MESSAGE_ITERATIONS, sizeof(buffer));
+
+		TEST_ASSERT_EQUAL_UINT32(BENCH_MESSAGE_ITERATIONS * escapedSize, benchSink);
+		benchSink = 0;
+	}
+}
+
+
+void test_directCoders(void) {
+	for (uint8_t i = 0; i < BENCH_DIRECT_MESSAGE_COUNT; i++) {
+		const bench_direct_message_t* coder = &benchDirectMessages[i];
+		bench_direct_struct_t message, decoded;
+		uint8_t generic[TRANCEIVER_TX_MAX_FRAME_SIZE];
+		uint8_t direct[TRANCEIVER_TX_MAX_FRAME_SIZE];
+
+		benchFillDirect(&message);
+
+		// the very same bytes as the generic encoder
+		pb_ostream_t stream = pb_ostream_from_buffer(generic, sizeof(generic));
+		TEST_ASSERT_TRUE(pb_encode(&stream, coder->fields, &message));
+		size_t size = coder->encodedSize(&message);
+		TEST_ASSERT_EQUAL_UINT32(stream.bytes_written, size);
+		TEST_ASSERT_EQUAL_UINT32(size, coder->encode(direct, &message) - direct);
+		TEST_ASSERT_EQUAL_INT(0, memcmp(generic, direct, size));
+
+		// decoded back into the same message, by both decoders
+		memset(&decoded, 0xA5, sizeof(decoded));
+		TEST_ASSERT_TRUE(coder->decode(direct, size, &decoded));
+		TEST_ASSERT_EQUAL_INT(0, memcmp(&message, &decoded, coder->structSize));
+
+		memset(&decoded, 0xA5, sizeof(decoded));
+		pb_istream_t input = pb_istream_from_buffer(direct, size);
+		TEST_ASSERT_TRUE(pb_decode(&input, coder->fields, &decoded));
+		TEST_ASSERT_EQUAL_INT(0, memcmp(&message, &decoded, coder->structSize));
+
+		// truncated input is rejected
+		TEST_ASSERT_TRUE(!coder->decode(direct, size - 1, &decoded));
+	}
+}
+
+
+void test_encodeGeneric(void) {
+	uint8_t encoded[TRANCEIVER_TX_MAX_FRAME_SIZE];
+	bench_direct_struct_t message;
+	benchFillDirect(&message);
+
+	for (uint8_t i = 0; i < BENCH_DIRECT_MESSAGE_COUNT; i++) {
+		char name[64];
+		snprintf(name, sizeof(name), "pb_encode %s", benchDirectMessages[i].name);
+
+		uint64_t start = benchNow();
+		for (uint32_t j = 0; j < BENCH_MESSAGE_ITERATIONS; j++) {
+			pb_ostream_t stream = pb_ostream_from_buffer(encoded, sizeof(encoded));
+			pb_encode(&stream, benchDirectMessages[i].fields, &message);
+			benchSink += stream.bytes_written;
+		}
+		benchReport(name, benchNow() - start, BENCH_MESSAGE_ITERATIONS);
+	}
+
+	TEST_ASSERT_NOT_EQUAL(0, benchSink);
+	benchSink = 0;
+}
+
+
+void test_encodeDirect(void) {
+	uint8_t encoded[TRANCEIVER_TX_MAX_FRAME_SIZE];
+	bench_direct_struct_t message;
+	benchFillDirect(&message);
+
+	for (uint8_t i = 0; i < BENCH_DIRECT_MESSAGE_COUNT; i++) {
+		char name[64];
+		snprintf(name, sizeof(name), "direct %s", benchDirectMessages[i].name);
+
+		// sized first, as when encoding into a frame
+		uint64_t start = benchNow();
+		for (uint32_t j = 0; j < BENCH_MESSAGE_ITERATIONS; j++) {
+			if (benchDirectMessages[i].encodedSize(&message) <= sizeof(encoded))
+				benchSink += (uint32_t)(benchDirectMessages[i].encode(encoded, &message) - encoded);
+		}
+		benchReport(name, benchNow() - start, BENCH_MESSAGE_ITERATIONS);
+	}
+
+	TEST_ASSERT_NOT_EQUAL(0, benchSink);
+	benchSink = 0;
+}
+
+
+void test_protoEncode(void) {
+	uint8_t encoded[TRANCEIVER_TX_MAX_FRAME_SIZE];
+
+	uint64_t start = benchNow();
+	for (uint32_t i = 0; i < BENCH_MESSAGE_ITERATIONS; i++)
+		benchSink += protoEncode(&benchMessage, encoded);
+	benchReport("protoEncode", benchNow() - start, BENCH_MESSAGE_ITERATIONS);
+
+	TEST_ASSERT_NOT_EQUAL(0, benchSink);
+	benchSink = 0;
+}
+
+
+void test_dosimeterCounts(void) {
+	TEST_ASSERT_EQUAL_INT(0, i2cInit());
+
+	// (the I2C stand-in echoes each channel's command byte back, as a 12-bit reading)
+	dosimeter_counts counts = { 0 };
+	dosimeter_data data = { 0 };
+	TEST_ASSERT_EQUAL_INT(0, dosimeterCounts(&counts));
+	TEST_ASSERT_EQUAL_INT(0, dosimeterData(&data));
+
+	// the ground recovers the converted readings from the counts
+	float voltage = 3300.0f * counts.boardTwo[0] / 4095.0f;
+	float temperature = 3300.0f * counts.boardTwo[7] / 4095.0f / -13.6f + 192.48f;
+	TEST_ASSERT_TRUE(voltage - data.boardTwo.channelZero < 0.01f && data.boardTwo.channelZero - voltage < 0.01f);
+	TEST_ASSERT_TRUE(temperature - data.boardTwo.channelSeven < 0.01f && data.boardTwo.channelSeven - temperature < 0.01f);
+
+	// and the counts take well under half the downlink bytes
+	uint8_t encoded[TRANCEIVER_TX_MAX_FRAME_SIZE];
+	uint8_t countsSize = protoEncodeMessage(radsat_message_FileTransferMessage_tag, file_transfer_message_DosimeterCounts_tag,
+											&counts, encoded, sizeof(encoded));
+	uint8_t dataSize = protoEncodeMessage(radsat_message_FileTransferMessage_tag, file_transfer_message_DosimeterData_tag,
+										  &data, encoded, sizeof(encoded));
+	printf("BENCH %-24s %10u bytes (as dosimeter_data: %u bytes)\n", "dosimeter_counts", countsSize, dataSize);
+
+	TEST_ASSERT_NOT_EQUAL(0, countsSize);
+	TEST_ASSERT_TRUE(2 * countsSize < dataSize);
+}
+
+
+void test_dosimeterEncoding(void) {
+	TEST_ASSERT_EQUAL_INT(0, i2cInit());
+
+	file_transfer_series_status_t before = { 0 };
+	file_transfer_series_status_t after = { 0 };
+	telecommand_message telecommand = { 0 };
+	telecommand.which_message = telecommand_message_BeginPass_tag;
+
+	// converted readings (asked for at the start of a pass) are sent as they are, not grouped into series
+	telecommand.BeginPass.dosimeterEncoding = begin_pass_dosimeter_encoding_t_Voltage;
+	TEST_ASSERT_EQUAL_UINT8(telecommand_message_BeginPass_tag, telecommandExecute(&telecommand));
+	seriesStatus(&before);
+	TEST_ASSERT_EQUAL_INT(0, dosimeterCollectData());
+	TEST_ASSERT_EQUAL_INT(0, fileTransferFlush());
+	seriesStatus(&after);
+	TEST_ASSERT_EQUAL_UINT32(before.records, after.records);
+
+	// the next pass asking for nothing in particular goes back to raw counts
+	telecommand.BeginPass.dosimeterEncoding = begin_pass_dosimeter_encoding_t_Counts;
+	TEST_ASSERT_EQUAL_UINT8(telecommand_message_BeginPass_tag, telecommandExecute(&telecommand));
+	TEST_ASSERT_EQUAL_INT(0, dosimeterCollectData());
+	TEST_ASSERT_EQUAL_INT(0, fileTransferFlush());
+	seriesStatus(&before);
+	TEST_ASSERT_EQUAL_UINT32(after.records + 1, before.records);
+}
+
+
+void test_fileTransferSeries(void) {
+	static dosimeter_counts records[BENCH_SERIES_RECORDS];
+	static dosimeter_counts decoded[BENCH_SERIES_RECORDS];
+	uint16_t decodedCount = 0;
+
+	// slowly drifting readings, with the odd jump
+	for (uint16_t i = 0; i < BENCH_SERIES_RECORDS; i++) {
+		for (uint8_t channel = 0; channel < 8; channel++) {
+			records[i].boardOne[channel] = (uint16_t)(1000 + channel * 300 + i * 2 - (i % 3));
+			records[i].boardTwo[channel] = (uint16_t)(3000 - channel * 200 - i + ((i % 17 == 0) ? 900 : 0));
+		}
+	}
+
+	file_transfer_series_status_t before = { 0 };
+	file_transfer_series_status_t after = { 0 };
+	seriesReset();
+	seriesStatus(&before);
+
+	// the ground rebuilds every record from the completed series
+	for (uint16_t i = 0; i < BENCH_SERIES_RECORDS; i++) {
+		const dosimeter_series* series = seriesAdd(&records[i]);
+		if (series != NULL)
+			decodedCount += benchSeriesDecode(series, &decoded[decodedCount], BENCH_SERIES_RECORDS - decodedCount);
+	}
+
+	const dosimeter_series* series = seriesFlush();
+	TEST_ASSERT_TRUE(series != NULL);
+	decodedCount += benchSeriesDecode(series, &decoded[decodedCount], BENCH_SERIES_RECORDS - decodedCount);
+
+	TEST_ASSERT_EQUAL_UINT32(BENCH_SERIES_RECORDS, decodedCount);
+	TEST_ASSERT_EQUAL_INT(0, memcmp(records, decoded, sizeof(records)));
+
+	seriesStatus(&after);
+	uint32_t recordBytes = after.recordBytes - before.recordBytes;
+	uint32_t seriesBytes = after.seriesBytes - before.seriesBytes;
+	printf("BENCH %-24s %10lu bytes (as dosimeter_counts: %lu bytes; %.2f : 1 over %lu series)\n", "dosimeter_series",
+		   (unsigned long)seriesBytes, (unsigned long)recordBytes, (double)recordBytes / seriesBytes,
+		   (unsigned long)(after.series - before.series));
+	TEST_ASSERT_TRUE(seriesBytes * 3 < recordBytes * 2);
+	TEST_ASSERT_EQUAL_UINT32(BENCH_SERIES_RECORDS, after.records - before.records);
+
+	// the records of a dropped series are not accounted for
+	TEST_ASSERT_TRUE(seriesAdd(&records[0]) == NULL);
+	seriesReset();
+	seriesStatus(&before);
+	TEST_ASSERT_EQUAL_INT(0, memcmp(&before, &after, sizeof(after)));
+
+	// records added to the File Transfer Service reach the science queue once their series is packed
+	file_transfer_queue_status_t status = { 0 };
+	for (uint16_t i = 0; i < BENCH_SERIES_RECORDS; i++)
+		TEST_ASSERT_EQUAL_INT(0, fileTransferAddMessage(&records[i], sizeof(records[i]), file_transfer_message_DosimeterCounts_tag));
+	TEST_ASSERT_EQUAL_INT(0, fileTransferFlush());
+	TEST_ASSERT_EQUAL_INT(0, fileTransferQueueStatus(fileTransferQueueScience, &status));
+	TEST_ASSERT_TRUE(status.frames > 0);
+}
+
+
+void test_fileTransferAddMessage(void) {
+	obc_telemetry telemetry = { 0 };
+
+	// small messages, so that most calls pack into the open frame and some flush it to FRAM
+	uint64_t start = benchNow();
+	for (uint32_t i = 0; i < BENCH_FILE_TRANSFER_ITERATIONS; i++) {
+		telemetry.uptime = i;
+		benchSink |= (uint32_t)fileTransferAddMessage(&telemetry, sizeof(telemetry), file_transfer_message_ObcTelemetry_tag);
+	}
+	benchReport("fileTransferAddMessage", benchNow() - start, BENCH_FILE_TRANSFER_ITERATIONS);
+
+	TEST_ASSERT_EQUAL_UINT32(0, benchSink);
+}
+
+
+void test_fileTransferPackAge(void) {
+	obc_telemetry telemetry = { .uptime = 1 };
+	module_error_report report = { .module = 1, .error = -1 };
+	file_transfer_queue_status_t status = { 0 };
+
+	// a lone message waits in its open frame for more to pack with it
+	TEST_ASSERT_EQUAL_INT(0, fileTransferAddMessage(&telemetry, sizeof(telemetry), file_transfer_message_ObcTelemetry_tag));
+	TEST_ASSERT_EQUAL_INT(0, fileTransferFlushExpired());
+	TEST_ASSERT_EQUAL_INT(0, fileTransferQueueStatus(fileTransferQueueHealth, &status));
+	TEST_ASSERT_EQUAL_UINT16(0, status.frames);
+
+	// but not for longer than the age limit, even if nothing else is added
+	vTaskDelay(BENCH_PACK_MAX_AGE_MS / portTICK_RATE_MS);
+	TEST_ASSERT_EQUAL_INT(0, fileTransferFlushExpired());
+	TEST_ASSERT_EQUAL_INT(0, fileTransferQueueStatus(fileTransferQueueHealth, &status));
+	TEST_ASSERT_EQUAL_UINT16(1, status.frames);
+
+	// error reports are stored straight away
+	TEST_ASSERT_EQUAL_INT(0, fileTransferAddMessage(&report, sizeof(report), file_transfer_message_ModuleErrorReport_tag));
+	TEST_ASSERT_EQUAL_INT(0, fileTransferQueueStatus(fileTransferQueueHealth, &status));
+	TEST_ASSERT_EQUAL_UINT16(2, status.frames);
+}
+
+
+void test_fileTransferNextFrame(void) {
+	uint8_t frame[TRANCEIVER_TX_MAX_FRAME_SIZE];
+	uint64_t elapsed = 0;
+	uint32_t calls = 0;
+
+	// refill the queue between passes; only the downlinking is timed
+	while (calls < BENCH_FILE_TRANSFER_ITERATIONS) {
+		benchFillBulkQueue();
+
+		uint64_t start = benchNow();
+		for (uint16_t i = 0; i < BENCH_FRAMES_PER_PASS; i++)
+			benchSink += fileTransferNextFrame(frame);
+		elapsed += benchNow() - start;
+		calls += BENCH_FRAMES_PER_PASS;
+	}
+	benchReport("fileTransferNextFrame", elapsed, calls);
+
+	TEST_ASSERT_NOT_EQUAL(0, benchSink);
+	benchSink = 0;
+}
+
+
+void test_fileTransferReset(void) {
+	uint8_t frame[TRANCEIVER_TX_MAX_FRAME_SIZE];
+	file_transfer_queue_status_t status = { 0 };
+	fram_stats_t usage = { 0 };
+
+	benchFillBulkQueue();
+	TEST_ASSERT_EQUAL_INT(0, fileTransferQueueStatus(fileTransferQueueBulk, &status));
+	TEST_ASSERT_EQUAL_UINT16(BENCH_FRAMES_PER_PASS, status.frames);
+
+	// only the reset itself is counted
+	framStats(&usage, 1);
+	fileTransferReset();
+	framStats(&usage, 0);
+	printf("BENCH %-24s %10lu bytes written (%lu writes), %lu bytes read (%u stored frames)\n", "fileTransferReset",
+		   (unsigned long)usage.bytesWritten, (unsigned long)usage.writes, (unsigned long)usage.bytesRead, BENCH_FRAMES_PER_PASS);
+
+	// nothing is left to downlink, and the stored frames are left as they were (not even one is rewritten)
+	TEST_ASSERT_EQUAL_INT(0, fileTransferQueueStatus(fileTransferQueueBulk, &status));
+	TEST_ASSERT_EQUAL_UINT16(0, status.frames);
+	TEST_ASSERT_EQUAL_UINT8(0, fileTransferCurrentFrame(frame));
+	TEST_ASSERT_EQUAL_UINT8(0, fileTransferPeekFrame(1, frame));
+	TEST_ASSERT_TRUE(usage.bytesWritten < FRAM_DATA_FRAME_SIZE);
+}
+
+
+void test_imageCompression(void) {
+	const uint8_t maxErrors[] = { 0, 2, 8 };
+
+	for (uint8_t sample = 0; sample < benchImageCount; sample++) {
+		benchFillImage((bench_image_t)sample);
+
+		for (uint8_t e = 0; e < sizeof(maxErrors); e++) {
+			uint64_t compressTime = 0;
+			uint64_t decompressTime = 0;
+			uint16_t packets = 0;
+			uint32_t size = 0;
+
+			// the whole image, a frame at a time (on board); then every packet on its own (Ground Station)
+			for (uint8_t i = 0; i < BENCH_IMAGE_ITERATIONS; i++) {
+				uint64_t start = benchNow();
+				packets = benchCompressImage(maxErrors[e]);
+				compressTime += benchNow() - start;
+
+				start = benchNow();
+				size = benchDecompressImage(packets, maxErrors[e]);
+				decompressTime += benchNow() - start;
+			}
+
+			// every pixel within the error allowed
+			uint8_t worst = 0;
+			for (uint32_t i = 0; i < sizeof(benchImage); i++) {
+				uint8_t error = (uint8_t)abs((int)benchImage[i] - benchDecoded[i]);
+				if (error > worst)
+					worst = error;
+			}
+			TEST_ASSERT_TRUE(worst <= maxErrors[e]);
+
+			// compressed or not, no more packets than frames
+			TEST_ASSERT_TRUE(packets <= BENCH_IMAGE_FRAMES);
+
+			printf("BENCH image %-12s error %u: ratio %6.2f, %5u packets (of %u frames), %6.2f ms/image (%6.2f decompressing)\n",
+				   benchImageNames[sample], maxErrors[e], (double)sizeof(benchImage) / size, packets, BENCH_IMAGE_FRAMES,
+				   (double)compressTime / (1000000.0 * BENCH_IMAGE_ITERATIONS),
+				   (double)decompressTime / (1000000.0 * BENCH_IMAGE_ITERATIONS));
+		}
+	}
+}
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Provides the host's monotonic time.
+ *
+ * @return The time (ns).
+ */
+static uint64_t benchNow(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+
+/**
+ * Prints the average cost of a benchmarked call.
+ *
+ * @param name The name of the function benchmarked.
+ * @param elapsed The total time spent in the calls (ns).
+ * @param calls The number of calls made.
+ */
+static void benchReport(const char* name, uint64_t elapsed, uint32_t calls) {
+	printf("BENCH %-24s %10.1f ns/call (%lu calls)\n", name, (double)elapsed / calls, (unsigned long)calls);
+}
+
+
+/**
+ * Prints the average cost and throughput of a benchmarked call that processes a buffer.
+ *
+ * @param name The name of the function benchmarked.
+ * @param elapsed The total time spent in the calls (ns).
+ * @param calls The number of calls made.
+ * @param bytesPerCall The size of the buffer processed by each call.
+ */
+static void benchReportBytes(const char* name, uint64_t elapsed, uint32_t calls, uint32_t bytesPerCall) {
+	printf("BENCH %-24s %10.1f ns/call (%lu calls) %8.2f ns/byte\n", name, (double)elapsed / calls,
+		   (unsigned long)calls, (double)elapsed / ((double)calls * bytesPerCall));
+}
+
+
+/**
+ * Replaces the stored File Transfer frames with a full bulk queue of image packets.
+ */
+static void benchFillBulkQueue(void) {
+	fileTransferReset();
+
+	for (uint16_t i = 0; i < BENCH_FRAMES_PER_PASS; i++) {
+		benchMessage.FileTransferMessage.ImagePacket.id = i;
+		TEST_ASSERT_EQUAL_INT(0, fileTransferAddMessage(&benchMessage.FileTransferMessage.ImagePacket,
+														sizeof(image_packet), file_transfer_message_ImagePacket_tag));
+	}
+
+	TEST_ASSERT_EQUAL_INT(0, fileTransferFlush());
+}
+
+
+/**
+ * The original byte-wise XOR cipher, kept as the reference for the word-wise one.
+ *
+ * @param buffer The message to be decrypted. Modified by function.
+ * @param size The size of the message in bytes.
+ * @return 0 on success, otherwise failure.
+ */
+static int benchXorDecryptBytewise(uint8_t* buffer, uint8_t size) {
+
+	uint8_t key = privateKey();
+	if (key == 0) return -1;
+
+	int newValue = 0;
+	for (int i = 0; i < size; i++) {
+		newValue = buffer[i] ^ key;
+		buffer[i] = newValue;
+	}
+
+	return 0;
+}
+
+
+/**
+ * Build an image frame reply (TLM 64) as the CubeSense sends it, escaped and framed.
+ *
+ * @param escaped Buffer for the reply (BENCH_TELEMETRY_ESCAPED_SIZE bytes). Set by function.
+ * @param fill The byte of every data byte; 0 for the image pattern of the simulated CubeSense.
+ * @return The size of the reply on the bus (in bytes).
+ */
+static uint16_t benchEscapeTelemetry(uint8_t* escaped, uint8_t fill) {
+	uint16_t size = 0;
+
+	escaped[size++] = ESCAPE_CHARACTER;
+	escaped[size++] = START_IDENTIFIER;
+	for (uint8_t i = 0; i < BENCH_TELEMETRY_SIZE - BASE_MESSAGE_LEN; i++) {
+		uint8_t byte = (fill != 0) ? fill : cubeSenseSimImageByte(1, i);
+		escaped[size++] = byte;
+		if (byte == ESCAPE_CHARACTER)
+			escaped[size++] = ESCAPE_CHARACTER;
+	}
+	escaped[size++] = ESCAPE_CHARACTER;
+	escaped[size++] = END_IDENTIFIER;
+
+	return size;
+}
+
+
+/**
+ * The original unescaping of telemetry, kept as the reference for the single-pass one: the reply
+ * is shifted down over each duplicated escape character, and one more byte read in its place.
+ * Bytes are read from the escaped reply rather than the bus (and the shift stays within the reply).
+ *
+ * @param buffer Buffer for the unescaped reply. Set by function.
+ * @param size The size of the unescaped reply (in bytes).
+ * @param escaped The reply as sent on the bus.
+ * @return The number of bytes read from the reply.
+ */
+static uint16_t benchUnescapeMemmove(uint8_t* buffer, uint8_t size, const uint8_t* escaped) {
+	uint16_t read = size;
+	memcpy(buffer, escaped, size);
+
+	for (uint8_t i = TELEMETRY_OFFSET_0; i < size - 2; i++) {
+		if (buffer[i] == ESCAPE_CHARACTER) {
+			memmove(&buffer[i + 1], &buffer[i + 2], size - i - 2);
+			buffer[size - 1] = escaped[read++];
+		}
+	}
+
+	return read;
+}
+
+
+/**
+ * Unescape telemetry as receiveAndUnescapeTelemetry() does, reading each chunk from the escaped
+ * reply rather than the bus.
+ *
+ * @param buffer Buffer for the unescaped reply. Set by function.
+ * @param size The size of the unescaped reply (in bytes).
+ * @param escaped The reply as sent on the bus.
+ * @return The number of bytes read from the reply.
+ */
+static uint16_t benchUnescapeChunked(uint8_t* buffer, uint8_t size, const uint8_t* escaped) {
+	uint16_t read = 0;
+	uint8_t received = 0;
+	uint8_t pending = 0;
+
+	while (received < size) {
+		uint8_t chunkSize = size - received;
+		memcpy(&buffer[received], &escaped[read], chunkSize);
+		read += chunkSize;
+		received += unescapeTelemetry(&buffer[received], chunkSize, &pending);
+	}
+
+	return read;
+}
+
+
+/**
+ * Fill a message with plausible telemetry; every fifth field is left at zero (and so is not encoded).
+ *
+ * @param message The message to fill (all of its fields are 4 bytes wide).
+ */
+static void benchFillDirect(bench_direct_struct_t* message) {
+	for (uint32_t i = 0; i < sizeof(*message) / sizeof(uint32_t); i++) {
+		float value = (i % 5 == 4) ? 0.0f : 3.3f + (float)i * 0.25f;
+		memcpy((uint8_t*)message + i * sizeof(uint32_t), &value, sizeof(value));
+	}
+}
+
+
+/**
+ * Rebuild the records of a series, as the ground does (see RFileTransfer.proto).
+ *
+ * @param series The series to decode.
+ * @param records Where to store the records.
+ * @param maxRecords The max number of records to store.
+ * @return The number of records stored; 0 if the series is malformed.
+ */
+static uint16_t benchSeriesDecode(const dosimeter_series* series, dosimeter_counts* records, uint16_t maxRecords) {
+	const pb_byte_t* position = series->records.bytes;
+	const pb_byte_t* end = &series->records.bytes[series->records.size];
+	uint16_t count = 0;
+
+	if (maxRecords == 0)
+		return 0;
+	records[count++] = series->keyframe;
+
+	while (position < end && count < maxRecords) {
+		uint64_t value = 0;
+		if (!pb_direct_read_varint(&position, end, &value))
+			return 0;
+
+		// each count follows on from the previous record's
+		records[count] = records[count - 1];
+		uint16_t* counts[] = { records[count].boardOne, records[count].boardTwo };
+		for (uint8_t i = 0; i < 16; i++) {
+			if (!pb_direct_read_varint(&position, end, &value))
+				return 0;
+			int32_t difference = (int32_t)((uint32_t)value >> 1) ^ -(int32_t)(value & 1);
+			counts[i / 8][i % 8] = (uint16_t)(counts[i / 8][i % 8] + difference);
+		}
+		count++;
+	}
+
+	return (position == end) ? count : 0;
+}
+
+
+/**
+ * Fills the benchmark image with a sample image (deterministic).
+ *
+ * @param sample The sample image.
+ */
+static void benchFillImage(bench_image_t sample) {
+	uint32_t random = 2026;
+
+	for (uint32_t i = 0; i < sizeof(benchImage); i++) {
+		double x = (double)(i % BENCH_IMAGE_WIDTH);
+		double y = (double)(i / BENCH_IMAGE_WIDTH);
+
+		// xorshift; the low bits give the sensor noise
+		random ^= random << 13;
+		random ^= random >> 17;
+		random ^= random << 5;
+		int noise = (int)(random & 3);
+		int value = 0;
+
+		switch (sample) {
+			case benchImageDarkSky:
+				value = ((random >> 8) % 2000 == 0) ? 255 : noise;
+				break;
+
+			case benchImageSun: {
+				double radius = sqrt((x - 400) * (x - 400) + (y - 600) * (y - 600)) / 150.0;
+				value = (radius < 1.0) ? (int)(255 * (0.4 + 0.6 * sqrt(1.0 - radius * radius))) : noise;
+				break;
+			}
+
+			case benchImageEarth:
+				value = (int)(100 + 40 * sin(x / 37.0) * cos(y / 53.0) + 30 * sin((x + 2 * y) / 91.0) +
+							  20 * cos((3 * x - y) / 17.0)) + noise;
+				break;
+
+			case benchImagePattern:
+				value = cubeSenseSimImageByte((uint16_t)(i / IMAGE_COMPRESSION_FRAME_SIZE), (uint8_t)(i % IMAGE_COMPRESSION_FRAME_SIZE));
+				break;
+
+			default:
+				value = (int)(random >> 24);
+				break;
+		}
+
+		benchImage[i] = (uint8_t)((value > 255) ? 255 : value);
+	}
+}
+
+
+/**
+ * Compresses the benchmark image into packets, a frame at a time (as the Camera Service does).
+ *
+ * @param maxError The largest error allowed of any pixel.
+ * @return The number of packets.
+ */
+static uint16_t benchCompressImage(uint8_t maxError) {
+	static image_encoder_t encoder;
+	uint16_t packets = 0;
+	uint16_t frame = 0;
+
+	imageEncoderStart(&encoder, 0, maxError);
+
+	while (frame <= BENCH_IMAGE_FRAMES) {
+		// the packet is sent once it is full, or the image is complete
+		if (frame < BENCH_IMAGE_FRAMES &&
+			imageEncoderAddFrame(&encoder, &benchImage[frame * IMAGE_COMPRESSION_FRAME_SIZE]) == SUCCESS) {
+			frame++;
+			continue;
+		}
+
+		bench_image_packet_t* packet = &benchImagePackets[packets++];
+		packet->firstFrame = encoder.firstFrame;
+		packet->frames = encoder.frames;
+		packet->size = imageEncoderFinish(&encoder);
+		memcpy(packet->data, encoder.data, packet->size);
+
+		if (frame == BENCH_IMAGE_FRAMES)
+			break;
+
+		imageEncoderStart(&encoder, frame, maxError);
+	}
+
+	return packets;
+}
+
+
+/**
+ * Decompresses the packets of the benchmark image into the decompressed copy.
+ *
+ * @param packets The number of packets.
+ * @param maxError The largest error allowed of any pixel.
+ * @return The total size of the compressed data (in bytes).
+ */
+static uint32_t benchDecompressImage(uint16_t packets, uint8_t maxError) {
+	uint32_t size = 0;
+
+	for (uint16_t i = 0; i < packets; i++) {
+		const bench_image_packet_t* packet = &benchImagePackets[i];
+		TEST_ASSERT_EQUAL_INT(0, imageDecode(packet->data, packet->size, packet->frames, maxError,
+											 &benchDecoded[packet->firstFrame * IMAGE_COMPRESSION_FRAME_SIZE]));
+		size += packet->size;
+	}
+
+	return size;
+}
@@ -0,0 +1,500 @@
+/**
+ * @file test_camera.c
+ * @date October 17, 2026
+ * @author
+ *
+ * Host simulation of image downloads; run with "ceedling test:camera".
+ *
+ * The actual camera drivers and Camera Service run against the simulated CubeSense (see
+ * RCubeSenseSim.c), in the virtual time of the host kernel (see test/support). Each scenario
+ * downloads an image from a camera that takes the given time to load each frame, and reports the
+ * frames per second achieved, the frame info requests made while waiting on the camera, and the
+ * frame latencies seen. Runs are deterministic; compare the reports before and after any change to
+ * the download loop. Images streamed into the downlink are decompressed again, and checked against
+ * the frames the camera sent.
+ */
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <hal/Timing/Time.h>
+#include <hal/errors.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <RCubeSenseSim.h>
+#include <RUart.h>
+#include <RCameraService.h>
+#include <RCameraCommon.h>
+#include <RCamera.h>
+#include <RADCS.h>
+#include <RImage.h>
+#include <RFileTransferService.h>
+#include <RFileTransferSeries.h>
+#include <RMessage.h>
+#include <RReedSolomon.h>
+#include <RImageCompression.h>
+#include <RProtobuf.h>
+#include <pb_common.h>
+#include <pb_encode.h>
+#include <pb_decode.h>
+#include <RRadsat.pb.h>
+#include <RFileTransfer.pb.h>
+#include <RProtocol.pb.h>
+#include <RTelecommands.pb.h>
+#include <crc.h>
+#include <RXorCipher.h>
+#include <RKey.h>
+#include <RFram.h>
+#include <RErrorManager.h>
+#include <RDebug.h>
+#include <RTransceiverSim.h>
+#include <RTransceiver.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** CubeSense image size of the download rate scenarios (256x256, 512 frames). */
+#define CAMERA_BENCH_IMAGE_SIZE		((uint8_t)2)
+
+/** CubeSense image size of the streaming scenarios (128x128, 128 frames; more than the bulk queue holds). */
+#define CAMERA_STREAM_IMAGE_SIZE	((uint8_t)3)
+
+/** Frame latency of the correctness scenarios (ms). */
+#define CAMERA_LATENCY_MS			((uint16_t)10)
+
+/** Largest error of any pixel allowed by the lossy compression scenario. */
+#define CAMERA_LOSSY_MAX_ERROR		((uint8_t)4)
+
+/** Most downloads allowed to stream a whole image into the downlink, a bulk queue at a time. */
+#define CAMERA_STREAM_MAX_DOWNLOADS	(10)
+
+/** Frame at which the resumed download scenario is interrupted. */
+#define CAMERA_RESUME_FRAME			((uint16_t)50)
+
+/** Interval at which the Image Download Task is checked on (ms). */
+#define CAMERA_CHECK_INTERVAL_MS	((portTickType)100)
+
+/** Seed of the frame latency jitter of the scenarios. */
+#define CAMERA_SEED					((uint32_t)2026)
+
+/** Bits carried by the camera bus per byte (start bit, 8 data bits, stop bit). */
+#define CAMERA_BITS_PER_BYTE		(10)
+
+/** Most reads of the bus allowed for a reply made only of escape characters (one, then about log2 of its size). */
+#define CAMERA_UNESCAPE_MAX_READS	(10)
+
+/** Private key stored for the downlink path (see RKey.c). */
+#define CAMERA_PRIVATE_KEY			(0x5A)
+
+/** FRAM addresses of the three copies of the private key (see RKey.c). */
+static const uint32_t cameraKeyAddresses[] = { 0x1001AA00, 0x1001AA04, 0x1001AA08 };
+
+
+/** A camera to download an image from. */
+typedef struct _camera_scenario_t {
+	const char* name;					///< Name printed with the report
+	cubesense_sim_config_t camera;		///< Camera and bus settings
+} camera_scenario_t;
+
+
+/** Frames received by the checking sink. */
+typedef struct _camera_sink_t {
+	uint16_t expected;		///< Index of the next frame expected
+	uint16_t received;		///< Frames received, all in order and intact
+	uint16_t stopAfter;		///< Index of the frame after which the download is stopped; 0 to never stop it
+} camera_sink_t;
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static int checkFrame(uint16_t frameIndex, const tlm_image_frame_t *frame, void *context);
+static void awaitImageDownload(void);
+static uint16_t streamImage(uint8_t size, uint16_t* packets);
+static uint16_t drainImagePackets(uint8_t size, uint16_t firstFrame, uint16_t* packets);
+static void printReport(const camera_scenario_t* scenario, const image_download_stats_t* download,
+						const cubesense_sim_stats_t* camera);
+
+
+/***************************************************************************************************
+                                               SETUP
+***************************************************************************************************/
+
+void setUp(void) {
+	Time time = { 0 };
+	Time_start(&time, 0);
+
+	// the FRAM stays started from one test to the next
+	int error = framInit();
+	TEST_ASSERT_TRUE(error == 0 || error == E_IS_INITIALIZED);
+
+	uint8_t key = CAMERA_PRIVATE_KEY;
+	for (uint8_t i = 0; i < sizeof(cameraKeyAddresses) / sizeof(cameraKeyAddresses[0]); i++)
+		TEST_ASSERT_EQUAL_INT(0, framWrite(&key, cameraKeyAddresses[i], sizeof(key)));
+
+	TEST_ASSERT_EQUAL_INT(0, fileTransferInit());
+	fileTransferReset();
+
+	cubesense_sim_config_t camera = { .frameLatencyMs = CAMERA_LATENCY_MS, .seed = CAMERA_SEED };
+	cubeSenseSimConfigure(&camera);
+	TEST_ASSERT_EQUAL_INT(0, uartInit(UART_CAMERA_BUS));
+
+	// images are compressed losslessly, unless a scenario says otherwise
+	setImageCompression(1, 0);
+}
+
+
+void tearDown(void) {
+}
+
+
+/***************************************************************************************************
+                                             SCENARIOS
+***************************************************************************************************/
+
+void test_cameraDownloadImage(void) {
+	camera_sink_t sink = { 0 };
+	uint16_t framesCount = getNumberOfFramesFromSize(CAMERA_STREAM_IMAGE_SIZE);
+
+	TEST_ASSERT_EQUAL_INT(0, downloadImage(SRAM2, BOTTOM_HALVE, CAMERA_STREAM_IMAGE_SIZE, 0, checkFrame, &sink));
+
+	// every frame arrives once, in order, and intact (the pattern includes escape characters)
+	TEST_ASSERT_EQUAL_UINT16(framesCount, sink.received);
+
+	image_download_stats_t download = { 0 };
+	getImageDownloadStats(&download);
+	TEST_ASSERT_EQUAL_UINT16(framesCount, download.frames);
+	// the camera's load time is learned (to within the time its messages spend on the bus)
+	TEST_ASSERT_TRUE(download.latencyEstimateMs + 2 >= CAMERA_LATENCY_MS);
+	TEST_ASSERT_TRUE(download.latencyEstimateMs <= CAMERA_LATENCY_MS + 2);
+}
+
+
+void test_cameraDownloadResume(void) {
+	camera_sink_t sink = { .stopAfter = CAMERA_RESUME_FRAME - 1 };
+	uint16_t framesCount = getNumberOfFramesFromSize(CAMERA_STREAM_IMAGE_SIZE);
+
+	// the sink stops the download part way through
+	TEST_ASSERT_EQUAL_INT(0, downloadImage(SRAM2, BOTTOM_HALVE, CAMERA_STREAM_IMAGE_SIZE, 0, checkFrame, &sink));
+	TEST_ASSERT_EQUAL_UINT16(CAMERA_RESUME_FRAME, sink.received);
+
+	// and the rest of the image follows from where it stopped
+	sink.stopAfter = 0;
+	TEST_ASSERT_EQUAL_INT(0, downloadImage(SRAM2, BOTTOM_HALVE, CAMERA_STREAM_IMAGE_SIZE, CAMERA_RESUME_FRAME, checkFrame, &sink));
+	TEST_ASSERT_EQUAL_UINT16(framesCount, sink.received);
+
+	// frames beyond the image are refused
+	TEST_ASSERT_EQUAL_INT(E_PARAM_OUTOFBOUNDS, downloadImage(SRAM2, BOTTOM_HALVE, CAMERA_STREAM_IMAGE_SIZE, framesCount, checkFrame, &sink));
+}
+
+
+void test_cameraDownloadTimeout(void) {
+	camera_sink_t sink = { 0 };
+
+	// a camera that never loads a frame (in time) fails the download, rather than handing over a stale frame
+	cubesense_sim_config_t camera = { .frameLatencyMs = 5000 };
+	cubeSenseSimConfigure(&camera);
+
+	TEST_ASSERT_NOT_EQUAL(0, downloadImage(SRAM2, BOTTOM_HALVE, CAMERA_STREAM_IMAGE_SIZE, 0, checkFrame, &sink));
+	TEST_ASSERT_EQUAL_UINT16(0, sink.received);
+}
+
+
+void test_cameraStreamImage(void) {
+	uint16_t framesCount = getNumberOfFramesFromSize(CAMERA_STREAM_IMAGE_SIZE);
+	file_transfer_queue_status_t bulk = { 0 };
+
+	// frames sent as captured; the image is larger than the bulk queue, and the download stops once the queue is full
+	setImageCompression(0, 0);
+	TEST_ASSERT_EQUAL_INT(0, requestImageDownload(SRAM2, CAMERA_STREAM_IMAGE_SIZE));
+	awaitImageDownload();
+
+	TEST_ASSERT_EQUAL_INT(0, fileTransferFlush());
+	fileTransferQueueStatus(fileTransferQueueBulk, &bulk);
+	printf("\t Bulk queue:   %u / %u frames after the first download (%lu rejected)\n", bulk.frames, bulk.capacity,
+		   (unsigned long)bulk.rejected);
+	TEST_ASSERT_EQUAL_UINT16(bulk.capacity, bulk.frames);
+	TEST_ASSERT_EQUAL_UINT32(0, bulk.rejected);
+	TEST_ASSERT_FALSE(getImageReadyForDownlinkState());
+
+	// once downlinked, the next download picks up where the last one stopped
+	uint16_t drained = drainImagePackets(CAMERA_STREAM_IMAGE_SIZE, 0, NULL);
+	TEST_ASSERT_EQUAL_UINT16(bulk.capacity, drained);
+
+	TEST_ASSERT_EQUAL_INT(0, requestImageDownload(SRAM2, CAMERA_STREAM_IMAGE_SIZE));
+	awaitImageDownload();
+
+	TEST_ASSERT_TRUE(getImageReadyForDownlinkState());
+	TEST_ASSERT_EQUAL_UINT16(framesCount, getImageFramesCount());
+
+	TEST_ASSERT_EQUAL_INT(0, fileTransferFlush());
+	TEST_ASSERT_EQUAL_UINT16(framesCount - drained, drainImagePackets(CAMERA_STREAM_IMAGE_SIZE, drained, NULL));
+
+	// the Ground Station can have the image sent again from any frame
+	setImageTransferFrameIndex(framesCount - 8);
+	TEST_ASSERT_FALSE(getImageReadyForDownlinkState());
+
+	TEST_ASSERT_EQUAL_INT(0, requestImageDownload(SRAM2, CAMERA_STREAM_IMAGE_SIZE));
+	awaitImageDownload();
+
+	TEST_ASSERT_TRUE(getImageReadyForDownlinkState());
+	TEST_ASSERT_EQUAL_INT(0, fileTransferFlush());
+	TEST_ASSERT_EQUAL_UINT16(8, drainImagePackets(CAMERA_STREAM_IMAGE_SIZE, framesCount - 8, NULL));
+}
+
+
+void test_cameraStreamCompressedImage(void) {
+	uint16_t framesCount = getNumberOfFramesFromSize(CAMERA_BENCH_IMAGE_SIZE);
+	uint16_t lossless = 0;
+	uint16_t lossy = 0;
+
+	// even compressed, the image is larger than the bulk queue; each download resumes from the last packet stored
+	TEST_ASSERT_EQUAL_UINT16(framesCount, streamImage(CAMERA_BENCH_IMAGE_SIZE, &lossless));
+	TEST_ASSERT_TRUE(lossless < framesCount);
+
+	// the Ground Station can have the image sent again, with some error allowed in return for fewer packets
+	setImageCompression(1, CAMERA_LOSSY_MAX_ERROR);
+	setImageTransferFrameIndex(0);
+	TEST_ASSERT_EQUAL_UINT16(framesCount, streamImage(CAMERA_BENCH_IMAGE_SIZE, &lossy));
+	TEST_ASSERT_TRUE(lossy < lossless);
+
+	printf("\t Compression:  %u frames in %u packets (lossless), %u packets (error of %u)\n", framesCount, lossless,
+		   lossy, CAMERA_LOSSY_MAX_ERROR);
+}
+
+
+void test_cameraDownloadRate(void) {
+	const camera_scenario_t scenarios[] = {
+		{ "Instant frames",          { .frameLatencyMs = 0,  .seed = CAMERA_SEED } },
+		{ "10 ms frames",            { .frameLatencyMs = 10, .seed = CAMERA_SEED } },
+		{ "10 ms frames, 10 ms jitter", { .frameLatencyMs = 10, .frameJitterMs = 10, .seed = CAMERA_SEED } },
+		{ "40 ms frames",            { .frameLatencyMs = 40, .seed = CAMERA_SEED } },
+		{ "40 ms frames, 40 ms jitter", { .frameLatencyMs = 40, .frameJitterMs = 40, .seed = CAMERA_SEED } },
+	};
+	uint16_t framesCount = getNumberOfFramesFromSize(CAMERA_BENCH_IMAGE_SIZE);
+
+	for (uint8_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+		camera_sink_t sink = { 0 };
+		cubeSenseSimConfigure(&scenarios[i].camera);
+
+		// a first download teaches the driver the camera's frame latency
+		TEST_ASSERT_EQUAL_INT(0, downloadImage(SRAM2, BOTTOM_HALVE, CAMERA_BENCH_IMAGE_SIZE, 0, checkFrame, &sink));
+		TEST_ASSERT_EQUAL_UINT16(framesCount, sink.received);
+
+		cubeSenseSimConfigure(&scenarios[i].camera);
+		memset(&sink, 0, sizeof(sink));
+		TEST_ASSERT_EQUAL_INT(0, downloadImage(SRAM2, BOTTOM_HALVE, CAMERA_BENCH_IMAGE_SIZE, 0, checkFrame, &sink));
+		TEST_ASSERT_EQUAL_UINT16(framesCount, sink.received);
+
+		image_download_stats_t download = { 0 };
+		cubesense_sim_stats_t camera = { 0 };
+		getImageDownloadStats(&download);
+		cubeSenseSimStats(&camera);
+		printReport(&scenarios[i], &download, &camera);
+
+		// the time spent on the bus and waiting on the camera, with the polling adding little to either
+		// (a few milliseconds per frame, and catching up with a tenth of the time frames took to load)
+		uint32_t busMs = (camera.bytesTransferred * CAMERA_BITS_PER_BYTE * 1000) / 57600;
+		uint32_t loadMs = framesCount * (scenarios[i].camera.frameLatencyMs + scenarios[i].camera.frameJitterMs / 2);
+		TEST_ASSERT_TRUE(download.polls <= 3 * (uint32_t)framesCount);
+		TEST_ASSERT_TRUE(download.durationMs <= busMs + loadMs + (loadMs / 10) + framesCount * 5);
+	}
+}
+
+
+void test_cameraUnescapeTelemetry(void) {
+	uint8_t escapes[FRAME_BYTES];
+	uint8_t pattern[FRAME_BYTES];
+	uint8_t reply[CAMERA_TELEMETRY_MAX_LEN];
+	cubesense_sim_stats_t camera = { 0 };
+
+	// the worst case, a reply of escape characters only (twice its size on the bus), with another reply right behind it
+	memset(escapes, ESCAPE_CHARACTER, sizeof(escapes));
+	for (uint8_t i = 0; i < FRAME_BYTES; i++)
+		pattern[i] = cubeSenseSimImageByte(1, i);
+
+	cubeSenseSimQueueReply(escapes, sizeof(escapes));
+	cubeSenseSimQueueReply(pattern, sizeof(pattern));
+
+	TEST_ASSERT_EQUAL_INT(0, receiveAndUnescapeTelemetry(reply, CAMERA_TELEMETRY_MAX_LEN));
+	TEST_ASSERT_EQUAL_HEX8(ESCAPE_CHARACTER, reply[0]);
+	TEST_ASSERT_EQUAL_HEX8(START_IDENTIFIER, reply[1]);
+	for (uint8_t i = 0; i < FRAME_BYTES; i++)
+		TEST_ASSERT_EQUAL_HEX8(ESCAPE_CHARACTER, reply[TELEMETRY_OFFSET_0 + i]);
+	TEST_ASSERT_EQUAL_HEX8(ESCAPE_CHARACTER, reply[CAMERA_TELEMETRY_MAX_LEN - 2]);
+	TEST_ASSERT_EQUAL_HEX8(END_IDENTIFIER, reply[CAMERA_TELEMETRY_MAX_LEN - 1]);
+
+	// in a few reads, none of which reached into the next reply
+	cubeSenseSimStats(&camera);
+	printf("\nAll-escape reply: %lu bytes read in %lu reads\n", (unsigned long)camera.bytesTransferred,
+		   (unsigned long)camera.receiveCalls);
+	TEST_ASSERT_TRUE(camera.receiveCalls <= CAMERA_UNESCAPE_MAX_READS);
+	TEST_ASSERT_EQUAL_UINT32((2 * FRAME_BYTES) + BASE_MESSAGE_LEN, camera.bytesTransferred);
+
+	TEST_ASSERT_EQUAL_INT(0, receiveAndUnescapeTelemetry(reply, CAMERA_TELEMETRY_MAX_LEN));
+	TEST_ASSERT_EQUAL_MEMORY(pattern, &reply[TELEMETRY_OFFSET_0], FRAME_BYTES);
+	TEST_ASSERT_EQUAL_HEX8(END_IDENTIFIER, reply[CAMERA_TELEMETRY_MAX_LEN - 1]);
+
+	// a reply unescapes alike however it is split between reads (i.e. a pair of escape characters across two)
+	const uint8_t unescaped[] = { ESCAPE_CHARACTER, START_IDENTIFIER, ESCAPE_CHARACTER, 0x01, ESCAPE_CHARACTER,
+								  ESCAPE_CHARACTER, END_IDENTIFIER, ESCAPE_CHARACTER, END_IDENTIFIER };
+	const uint8_t escaped[] = { ESCAPE_CHARACTER, START_IDENTIFIER, ESCAPE_CHARACTER, ESCAPE_CHARACTER, 0x01,
+								ESCAPE_CHARACTER, ESCAPE_CHARACTER, ESCAPE_CHARACTER, ESCAPE_CHARACTER, END_IDENTIFIER,
+								ESCAPE_CHARACTER, END_IDENTIFIER };
+
+	for (uint8_t split = 0; split <= sizeof(escaped); split++) {
+		uint8_t buffer[sizeof(escaped)];
+		uint8_t pending = 0;
+
+		memcpy(buffer, escaped, split);
+		uint8_t kept = unescapeTelemetry(buffer, split, &pending);
+		memcpy(&buffer[kept], &escaped[split], sizeof(escaped) - split);
+		kept += unescapeTelemetry(&buffer[kept], sizeof(escaped) - split, &pending);
+
+		TEST_ASSERT_EQUAL_UINT8(sizeof(unescaped), kept);
+		TEST_ASSERT_EQUAL_MEMORY(unescaped, buffer, sizeof(unescaped));
+		TEST_ASSERT_EQUAL_UINT8(0, pending);
+	}
+}
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Check each downloaded frame against the simulated image (see @sa downloadImage).
+ *
+ * @param frameIndex The index of the frame within the image.
+ * @param frame The downloaded frame.
+ * @param context The frames received so far (camera_sink_t).
+ * @return 0 to carry on with the download; non-zero to stop it.
+ */
+static int checkFrame(uint16_t frameIndex, const tlm_image_frame_t *frame, void *context) {
+	camera_sink_t* sink = (camera_sink_t*)context;
+
+	TEST_ASSERT_EQUAL_UINT16(sink->expected, frameIndex);
+	for (uint8_t i = 0; i < FRAME_BYTES; i++)
+		TEST_ASSERT_EQUAL_HEX8(cubeSenseSimImageByte(frameIndex, i), frame->image_bytes[i]);
+
+	sink->expected = frameIndex + 1;
+	sink->received++;
+
+	return (sink->stopAfter != 0 && frameIndex == sink->stopAfter);
+}
+
+
+/**
+ * Wait for the Image Download Task to be done with the CubeSense.
+ */
+static void awaitImageDownload(void) {
+	vTaskDelay(1);
+
+	while (getCubeSenseUsageState())
+		vTaskDelay(CAMERA_CHECK_INTERVAL_MS);
+}
+
+
+/**
+ * Stream an image into the downlink, a bulk queue at a time, until it is complete.
+ *
+ * @param size The CubeSense image size.
+ * @param packets The number of image packets downlinked. Set by function.
+ * @return The number of image frames downlinked.
+ */
+static uint16_t streamImage(uint8_t size, uint16_t* packets) {
+	uint16_t frames = 0;
+	*packets = 0;
+
+	for (uint8_t i = 0; i < CAMERA_STREAM_MAX_DOWNLOADS; i++) {
+		// begins with the frame after the last one stored; a packet left unsent is built again
+		uint16_t firstFrame = frames;
+		TEST_ASSERT_EQUAL_INT(0, requestImageDownload(SRAM2, size));
+		awaitImageDownload();
+
+		TEST_ASSERT_EQUAL_INT(0, fileTransferFlush());
+		frames += drainImagePackets(size, firstFrame, packets);
+
+		if (getImageReadyForDownlinkState())
+			break;
+	}
+
+	TEST_ASSERT_TRUE(getImageReadyForDownlinkState());
+	return frames;
+}
+
+
+/**
+ * Downlink every stored frame, checking that each holds the next image packet, in order, and that
+ * its frames decompress to those the camera sent (to within the error allowed).
+ *
+ * @param size The CubeSense image size.
+ * @param firstFrame The index of the image frame expected in the first packet.
+ * @param packets The number of image packets downlinked; added to by function. May be NULL.
+ * @return The number of image frames downlinked.
+ */
+static uint16_t drainImagePackets(uint8_t size, uint16_t firstFrame, uint16_t* packets) {
+	static uint8_t pixels[IMAGE_COMPRESSION_MAX_FRAMES * IMAGE_COMPRESSION_FRAME_SIZE];
+	const image_type_t types[] = { image_type_t_FullResolution, image_type_t_HalfResolution, image_type_t_QuarterResolution,
+								   image_type_t_EighthResolution, image_type_t_Thumbnail };
+	uint8_t frame[TRANCEIVER_TX_MAX_FRAME_SIZE];
+	uint16_t count = 0;
+	uint8_t frameSize;
+
+	while ((frameSize = fileTransferNextFrame(frame)) > 0) {
+		// downlinked frames are not encrypted; the message follows the header
+		radsat_message message = { 0 };
+		TEST_ASSERT_TRUE(frameSize > RADSAT_SK_HEADER_SIZE);
+		TEST_ASSERT_EQUAL_INT(0, protoDecode(&frame[RADSAT_SK_HEADER_SIZE], frameSize - RADSAT_SK_HEADER_SIZE, &message));
+		TEST_ASSERT_EQUAL_INT(file_transfer_message_ImagePacket_tag, message.FileTransferMessage.which_message);
+
+		const image_packet* packet = &message.FileTransferMessage.ImagePacket;
+		TEST_ASSERT_EQUAL_INT(types[size], packet->type);
+		TEST_ASSERT_EQUAL_UINT16(firstFrame + count, packet->frame);
+		TEST_ASSERT_TRUE(packet->frames > 0);
+
+		if (packet->encoding == image_encoding_t_Raw) {
+			TEST_ASSERT_EQUAL_UINT8(1, packet->frames);
+			TEST_ASSERT_EQUAL_UINT16(FRAME_BYTES, packet->data.size);
+			memcpy(pixels, packet->data.bytes, FRAME_BYTES);
+		}
+		else {
+			TEST_ASSERT_EQUAL_INT(image_encoding_t_Compressed, packet->encoding);
+			TEST_ASSERT_EQUAL_INT(0, imageDecode(packet->data.bytes, (uint8_t)packet->data.size, packet->frames,
+												 packet->maxError, pixels));
+		}
+
+		for (uint8_t f = 0; f < packet->frames; f++) {
+			for (uint8_t i = 0; i < FRAME_BYTES; i++) {
+				int expected = cubeSenseSimImageByte(packet->frame + f, i);
+				TEST_ASSERT_INT_WITHIN(packet->maxError, expected, pixels[f * FRAME_BYTES + i]);
+			}
+		}
+
+		count += packet->frames;
+		if (packets != NULL)
+			(*packets)++;
+	}
+
+	return count;
+}
+
+
+/**
+ * Print the outcome of a download rate scenario.
+ */
+static void printReport(const camera_scenario_t* scenario, const image_download_stats_t* download,
+						const cubesense_sim_stats_t* camera) {
+	printf("\n--- %s (%u frames) ---\n", scenario->name, download->frames);
+	printf("\t Rate:         %.1f frames/s (%lu ms)\n", 1000.0 * download->frames / download->durationMs,
+		   (unsigned long)download->durationMs);
+	printf("\t Polls:        %.2f per frame\n", (double)download->polls / download->frames);
+	printf("\t Latency:      %u min, %.1f average, %u max, %u learned (ms)\n", download->latencyMinMs,
+		   (double)download->latencyTotalMs / download->frames, download->latencyMaxMs, download->latencyEstimateMs);
+	printf("\t Bus:          %lu bytes, %lu frames loaded\n", (unsigned long)camera->bytesTransferred,
+		   (unsigned long)camera->framesLoaded);
+}
@@ -0,0 +1,501 @@
+/**
+ * @file test_pass.c
+ * @date October 16, 2026
+ * @author
+ *
+ * Host simulation of complete passes; run with "ceedling test:pass".
+ *
+ * The actual Communication Receive and Transmit Tasks run against the simulated Transceiver and
+ * Ground Station (see RTransceiverSim.c), in the virtual time of the host kernel (see test/support).
+ * Each scenario fills the File Transfer FIFO, runs a pass of the given duration over a link of the
+ * given quality, and reports what reached the Ground Station and what it cost to get it there.
+ * Runs are deterministic; compare the reports before and after any change to the protocol.
+ */
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <hal/Timing/Time.h>
+#include <hal/errors.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <RCommunicationTasks.h>
+#include <RTransceiverSim.h>
+#include <RTransceiver.h>
+#include <RProtocolService.h>
+#include <RTelecommandService.h>
+#include <RFileTransferService.h>
+#include <RFileTransferSeries.h>
+#include <RMessage.h>
+#include <RReedSolomon.h>
+#include <RProtobuf.h>
+#include <pb_common.h>
+#include <pb_encode.h>
+#include <pb_decode.h>
+#include <RRadsat.pb.h>
+#include <RFileTransfer.pb.h>
+#include <RProtocol.pb.h>
+#include <RTelecommands.pb.h>
+#include <crc.h>
+#include <RXorCipher.h>
+#include <RKey.h>
+#include <RFram.h>
+#include <RErrorManager.h>
+#include <RDebug.h>
+#include <RUart.h>
+#include <RCubeSenseSim.h>
+#include <RCameraService.h>
+#include <RCameraCommon.h>
+#include <RCamera.h>
+#include <RADCS.h>
+#include <RImage.h>
+#include <RImageCompression.h>
+#include <RDosimeter.h>
+#include <RI2c.h>
+
+
+/***************************************************************************************************
+                                   DEFINITIONS & PRIVATE GLOBALS
+***************************************************************************************************/
+
+/** Link latency of the scenarios (ms); roughly a satellite near the horizon plus processing. */
+#define PASS_LATENCY_MS			((uint16_t)250)
+
+/** Seed of the link impairments of the scenarios. */
+#define PASS_SEED				((uint32_t)2026)
+
+/** Time allowed for each telecommand to be received and answered before the File Transfer (ms). */
+#define PASS_TELECOMMAND_DELAY_MS	((portTickType)(2 * PASS_LATENCY_MS + 1000))
+
+/** Interval at which the pass is checked on (ms). */
+#define PASS_CHECK_INTERVAL_MS	((portTickType)100)
+
+/** Interval at which the Ground Station is checked for telecommand responses (ms). */
+#define PASS_RESPONSE_CHECK_INTERVAL_MS	((portTickType)10)
+
+/** Bit error rates (per million bits) of the error correction scenarios; a full frame is roughly 2000 bits. */
+static const uint16_t passBitErrorPpm[] = { 0, 100, 400 };
+
+/** Private key stored for the uplink path (see RKey.c). */
+#define PASS_PRIVATE_KEY		(0x5A)
+
+/** FRAM addresses of the three copies of the private key (see RKey.c). */
+static const uint32_t passKeyAddresses[] = { 0x1001AA00, 0x1001AA04, 0x1001AA08 };
+
+
+/** A pass to simulate. */
+typedef struct _pass_scenario_t {
+	const char* name;					///< Name printed with the report
+	transceiver_sim_config_t link;		///< Link and Ground Station settings
+	portTickType durationMs;			///< Duration of the File Transfer phase (ms)
+	uint16_t frameCount;				///< Number of (image packet) frames in the FIFO before the pass
+} pass_scenario_t;
+
+
+/** Outcome of a simulated pass. */
+typedef struct _pass_report_t {
+	transceiver_sim_stats_t link;		///< What the link and Ground Station saw
+	communication_tx_stats_t tx;		///< What the Transmit Task did
+	portTickType drainedMs;				///< Time until the last frame was delivered (ms); 0 if never
+} pass_report_t;
+
+
+/** Handles of the communication Tasks; created once, for all scenarios. */
+static xTaskHandle rxTaskHandle = NULL;
+static xTaskHandle txTaskHandle = NULL;
+
+
+/***************************************************************************************************
+                                       PRIVATE FUNCTION STUBS
+***************************************************************************************************/
+
+static void runPass(const pass_scenario_t* scenario, pass_report_t* report);
+static void fillFifo(uint16_t frameCount);
+static void startTelecommands(const transceiver_sim_config_t* link);
+static portTickType awaitTelecommandResponses(uint32_t responses);
+static void printReport(const pass_scenario_t* scenario, const pass_report_t* report);
+
+
+/***************************************************************************************************
+                                               SETUP
+***************************************************************************************************/
+
+void setUp(void) {
+	Time time = { 0 };
+	Time_start(&time, 0);
+
+	// the FRAM stays started from one test to the next
+	int error = framInit();
+	TEST_ASSERT_TRUE(error == 0 || error == E_IS_INITIALIZED);
+
+	uint8_t key = PASS_PRIVATE_KEY;
+	for (uint8_t i = 0; i < sizeof(passKeyAddresses) / sizeof(passKeyAddresses[0]); i++)
+		TEST_ASSERT_EQUAL_INT(0, framWrite(&key, passKeyAddresses[i], sizeof(key)));
+
+	TEST_ASSERT_EQUAL_INT(0, fileTransferInit());
+
+	if (rxTaskHandle == NULL)
+		TEST_ASSERT_EQUAL_INT(pdPASS, xTaskCreate(CommunicationRxTask, (const signed char*)"Communication Receive Task",
+												  configMINIMAL_STACK_SIZE, NULL, configMAX_PRIORITIES - 2, &rxTaskHandle));
+
+	if (txTaskHandle == NULL)
+		TEST_ASSERT_EQUAL_INT(pdPASS, xTaskCreate(CommunicationTxTask, (const signed char*)"Communication Transmit Task",
+												  configMINIMAL_STACK_SIZE, NULL, configMAX_PRIORITIES - 1, &txTaskHandle));
+}
+
+
+void tearDown(void) {
+}
+
+
+/***************************************************************************************************
+                                             SCENARIOS
+***************************************************************************************************/
+
+void test_passStopAndWaitClean(void) {
+	pass_scenario_t scenario = {
+		.name = "Stop-and-wait, clean link",
+		.link = { .latencyMs = PASS_LATENCY_MS, .seed = PASS_SEED },
+		.durationMs = 2 * 60 * 1000,
+		.frameCount = 100,
+	};
+	pass_report_t report = { 0 };
+
+	runPass(&scenario, &report);
+
+	TEST_ASSERT_EQUAL_UINT32(scenario.frameCount, report.link.framesDelivered);
+	TEST_ASSERT_EQUAL_UINT32(0, report.tx.framesResent);
+	TEST_ASSERT_EQUAL_UINT32(0, report.tx.passesAborted);
+}
+
+
+void test_passStopAndWaitLossy(void) {
+	pass_scenario_t scenario = {
+		.name = "Stop-and-wait, 5% loss, 2% corruption",
+		.link = { .latencyMs = PASS_LATENCY_MS, .lossPercent = 5, .corruptPercent = 2, .seed = PASS_SEED },
+		.durationMs = 2 * 60 * 1000,
+		.frameCount = 100,
+	};
+	pass_report_t report = { 0 };
+
+	runPass(&scenario, &report);
+
+	TEST_ASSERT_EQUAL_UINT32(scenario.frameCount, report.link.framesDelivered);
+	TEST_ASSERT_TRUE(report.tx.framesResent > 0);
+	TEST_ASSERT_EQUAL_UINT32(0, report.tx.passesAborted);
+}
+
+
+void test_passWindowedClean(void) {
+	pass_scenario_t scenario = {
+		.name = "Windowed, clean link",
+		.link = { .latencyMs = PASS_LATENCY_MS, .windowSize = TRANCEIVER_TX_MAX_FRAME_COUNT, .seed = PASS_SEED },
+		.durationMs = 2 * 60 * 1000,
+		.frameCount = 100,
+	};
+	pass_report_t report = { 0 };
+
+	runPass(&scenario, &report);
+
+	TEST_ASSERT_EQUAL_UINT32(scenario.frameCount, report.link.framesDelivered);
+	TEST_ASSERT_EQUAL_UINT32(0, report.tx.framesResent);
+	TEST_ASSERT_EQUAL_UINT32(0, report.tx.passesAborted);
+}
+
+
+void test_passWindowedLossy(void) {
+	pass_scenario_t scenario = {
+		.name = "Windowed, 5% loss, 2% corruption",
+		.link = { .latencyMs = PASS_LATENCY_MS, .lossPercent = 5, .corruptPercent = 2,
+				  .windowSize = TRANCEIVER_TX_MAX_FRAME_COUNT, .seed = PASS_SEED },
+		.durationMs = 2 * 60 * 1000,
+		.frameCount = 100,
+	};
+	pass_report_t report = { 0 };
+
+	runPass(&scenario, &report);
+
+	TEST_ASSERT_EQUAL_UINT32(scenario.frameCount, report.link.framesDelivered);
+	TEST_ASSERT_TRUE(report.tx.framesResent > 0);
+	TEST_ASSERT_EQUAL_UINT32(0, report.tx.passesAborted);
+}
+
+
+void test_passWindowedCompactHeaders(void) {
+	pass_scenario_t scenario = {
+		.name = "Windowed, clean link, compact headers",
+		.link = { .latencyMs = PASS_LATENCY_MS, .windowSize = TRANCEIVER_TX_MAX_FRAME_COUNT, .compactHeaders = 1,
+				  .seed = PASS_SEED },
+		.durationMs = 2 * 60 * 1000,
+		.frameCount = 100,
+	};
+	pass_report_t report = { 0 };
+
+	runPass(&scenario, &report);
+
+	TEST_ASSERT_EQUAL_UINT32(scenario.frameCount, report.link.framesDelivered);
+	TEST_ASSERT_EQUAL_UINT32(0, report.tx.passesAborted);
+
+	// every frame arrived with a header smaller than the full one
+	uint32_t headerBytes = report.link.bytesDelivered - report.link.payloadDelivered;
+	TEST_ASSERT_TRUE(headerBytes < scenario.frameCount * RADSAT_SK_HEADER_SIZE);
+}
+
+
+void test_passErrorCorrection(void) {
+	uint32_t payload[2] = { 0 };
+
+	// the same passes with and without parity bytes, over increasingly noisy links
+	for (uint8_t windowed = 0; windowed < 2; windowed++) {
+		for (uint8_t i = 0; i < sizeof(passBitErrorPpm) / sizeof(passBitErrorPpm[0]); i++) {
+			for (uint8_t fec = 0; fec < 2; fec++) {
+				char name[80];
+				snprintf(name, sizeof(name), "%s, %u bit errors per million, %s", windowed ? "Windowed" : "Stop-and-wait",
+						 passBitErrorPpm[i], fec ? "error correction" : "no error correction");
+
+				pass_scenario_t scenario = {
+					.name = name,
+					.link = { .latencyMs = PASS_LATENCY_MS, .windowSize = windowed ? TRANCEIVER_TX_MAX_FRAME_COUNT : 0,
+							  .bitErrorPpm = passBitErrorPpm[i], .fecParity = fec ? RS_MAX_PARITY_SIZE : 0,
+							  .seed = PASS_SEED },
+					.durationMs = 15 * 1000,
+					.frameCount = 100,
+				};
+				pass_report_t report = { 0 };
+
+				runPass(&scenario, &report);
+				payload[fec] = report.link.payloadDelivered;
+
+				if (!fec)
+					TEST_ASSERT_EQUAL_UINT32(0, report.link.framesRepaired);
+			}
+
+			// parity bytes cost a little air time on a clean link, and pay for themselves once frames are damaged
+			if (passBitErrorPpm[i] >= 100)
+				TEST_ASSERT_TRUE(payload[1] > payload[0]);
+		}
+	}
+}
+
+
+void test_passTelecommandBatch(void) {
+	transceiver_sim_config_t link = { .latencyMs = PASS_LATENCY_MS, .seed = PASS_SEED };
+	transceiver_sim_stats_t stats = { 0 };
+	const uint16_t telecommands[] = {
+		telecommand_message_BeginPass_tag,
+		telecommand_message_UpdateTime_tag,
+		0,	// unknown to the Satellite; not executed
+		telecommand_message_BeginFileTransfer_tag,
+	};
+	const uint8_t count = sizeof(telecommands) / sizeof(telecommands[0]);
+
+	// one telecommand at a time; each waits for the ACK of the previous one
+	startTelecommands(&link);
+
+	portTickType singleMs = 0;
+	for (uint8_t i = 0; i < count; i++) {
+		TEST_ASSERT_EQUAL_INT(0, transceiverSimUplinkTelecommand(telecommands[i]));
+		singleMs += awaitTelecommandResponses(i + 1);
+	}
+
+	transceiverSimStats(&stats);
+	TEST_ASSERT_EQUAL_UINT32(count, stats.telecommandResponses);
+	TEST_ASSERT_EQUAL_UINT32(count - 1, stats.telecommandsExecuted);
+
+	// all of them in a single frame, answered by a single ACK
+	startTelecommands(&link);
+
+	TEST_ASSERT_EQUAL_INT(0, transceiverSimUplinkTelecommands(telecommands, count));
+	portTickType batchMs = awaitTelecommandResponses(1);
+
+	transceiverSimStats(&stats);
+	TEST_ASSERT_EQUAL_UINT32(1, stats.telecommandResponses);
+	TEST_ASSERT_EQUAL_UINT32(count - 1, stats.telecommandsExecuted);
+
+	printf("\nPASS Telecommands (%u ms latency, %u telecommands)\n", PASS_LATENCY_MS, count);
+	printf("\t Single:      %lu ms until the last ACK\n", (unsigned long)singleMs);
+	printf("\t Batched:     %lu ms until the ACK\n", (unsigned long)batchMs);
+
+	TEST_ASSERT_TRUE(batchMs < singleMs);
+
+	// the batch left the Satellite in its File Transfer mode
+	TEST_ASSERT_EQUAL_INT(0, transceiverSimStartFileTransfer());
+	vTaskDelay(PASS_TELECOMMAND_DELAY_MS / portTICK_RATE_MS);
+	transceiverSimStats(&stats);
+	TEST_ASSERT_TRUE(stats.framesDelivered > 0);
+
+	if (communicationPassModeActive())
+		communicationEndPass();
+}
+
+
+void test_passErrorLimit(void) {
+	pass_scenario_t scenario = {
+		.name = "Stop-and-wait, every frame corrupted",
+		.link = { .latencyMs = PASS_LATENCY_MS, .corruptPercent = 100, .seed = PASS_SEED },
+		.durationMs = 60 * 1000,
+		.frameCount = 10,
+	};
+	pass_report_t report = { 0 };
+
+	runPass(&scenario, &report);
+
+	// the Transmit Task gives up once the NACKs exceed the limit
+	TEST_ASSERT_EQUAL_UINT32(0, report.link.framesDelivered);
+	TEST_ASSERT_EQUAL_UINT32(1, report.tx.passesAborted);
+	TEST_ASSERT_EQUAL_UINT32(NACK_ERROR_LIMIT + 1, report.tx.errorStreakMax);
+}
+
+
+/***************************************************************************************************
+                                         PRIVATE FUNCTIONS
+***************************************************************************************************/
+
+/**
+ * Simulate a pass: telecommands first, then the File Transfer for the scenario's duration.
+ *
+ * @param scenario The pass to simulate.
+ * @param report The outcome of the pass. Set by function.
+ */
+static void runPass(const pass_scenario_t* scenario, pass_report_t* report) {
+
+	transceiverSimConfigure(&scenario->link);
+	fillFifo(scenario->frameCount);
+
+	// start a fresh pass, and move on to the File Transfer phase
+	if (communicationPassModeActive())
+		communicationEndPass();
+
+	TEST_ASSERT_EQUAL_INT(0, transceiverSimUplinkTelecommand(telecommand_message_ResumeTransmission_tag));
+	vTaskDelay(PASS_TELECOMMAND_DELAY_MS / portTICK_RATE_MS);
+	TEST_ASSERT_EQUAL_INT(0, transceiverSimUplinkTelecommand(telecommand_message_BeginPass_tag));
+	vTaskDelay(PASS_TELECOMMAND_DELAY_MS / portTICK_RATE_MS);
+	TEST_ASSERT_EQUAL_INT(0, transceiverSimUplinkTelecommand(telecommand_message_BeginFileTransfer_tag));
+	vTaskDelay(PASS_TELECOMMAND_DELAY_MS / portTICK_RATE_MS);
+
+	// only the File Transfer counts
+	communication_tx_stats_t txStats = { 0 };
+	communicationTxStats(&txStats, 1);
+	transceiverSimConfigure(&scenario->link);
+
+	// have the Ground Station start receiving; the pass lasts its full duration regardless
+	TEST_ASSERT_EQUAL_INT(0, transceiverSimStartFileTransfer());
+	portTickType start = xTaskGetTickCount();
+	portTickType elapsed = 0;
+
+	while (elapsed < scenario->durationMs) {
+		vTaskDelay(PASS_CHECK_INTERVAL_MS / portTICK_RATE_MS);
+		elapsed = (xTaskGetTickCount() - start) * portTICK_RATE_MS;
+
+		transceiverSimStats(&report->link);
+		if (report->drainedMs == 0 && report->link.framesDelivered >= scenario->frameCount)
+			report->drainedMs = elapsed;
+	}
+
+	communicationTxStats(&report->tx, 1);
+	if (communicationPassModeActive())
+		communicationEndPass();
+
+	printReport(scenario, report);
+}
+
+
+/**
+ * Replace all stored File Transfer frames with the given number of (image packet) frames.
+ *
+ * @param frameCount The number of frames to store; at most the capacity of the bulk queue.
+ */
+static void fillFifo(uint16_t frameCount) {
+	fileTransferReset();
+
+	for (uint16_t i = 0; i < frameCount; i++) {
+		image_packet packet = { 0 };
+		packet.id = i;
+		packet.type = image_type_t_Thumbnail;
+		packet.data.size = sizeof(packet.data.bytes);
+		for (uint16_t j = 0; j < packet.data.size; j++)
+			packet.data.bytes[j] = (uint8_t)(i + j);
+
+		TEST_ASSERT_EQUAL_INT(0, fileTransferAddMessage(&packet, sizeof(packet), file_transfer_message_ImagePacket_tag));
+	}
+
+	TEST_ASSERT_EQUAL_INT(0, fileTransferFlush());
+}
+
+
+/**
+ * Start a fresh pass, ready for telecommands; the Satellite leaves the quiet mode that follows a pass.
+ *
+ * @param link Link and Ground Station settings.
+ */
+static void startTelecommands(const transceiver_sim_config_t* link) {
+	transceiverSimConfigure(link);
+	fillFifo(10);
+
+	if (communicationPassModeActive())
+		communicationEndPass();
+
+	// not answered; the communication state is reset by it
+	TEST_ASSERT_EQUAL_INT(0, transceiverSimUplinkTelecommand(telecommand_message_ResumeTransmission_tag));
+	vTaskDelay(PASS_TELECOMMAND_DELAY_MS / portTICK_RATE_MS);
+
+	transceiverSimConfigure(link);
+}
+
+
+/**
+ * Wait until the Ground Station has received the given number of telecommand responses.
+ *
+ * @param responses The number of responses (since the link was last configured) to wait for.
+ * @return The time waited (ms).
+ */
+static portTickType awaitTelecommandResponses(uint32_t responses) {
+	transceiver_sim_stats_t stats = { 0 };
+	portTickType start = xTaskGetTickCount();
+	portTickType elapsed = 0;
+
+	do {
+		vTaskDelay(PASS_RESPONSE_CHECK_INTERVAL_MS / portTICK_RATE_MS);
+		elapsed = (xTaskGetTickCount() - start) * portTICK_RATE_MS;
+		transceiverSimStats(&stats);
+	} while (stats.telecommandResponses < responses && elapsed < PASS_TELECOMMAND_DELAY_MS);
+
+	TEST_ASSERT_EQUAL_UINT32(responses, stats.telecommandResponses);
+	return elapsed;
+}
+
+
+/**
+ * Print the outcome of a simulated pass.
+ *
+ * @param scenario The simulated pass.
+ * @param report The outcome of the pass.
+ */
+static void printReport(const pass_scenario_t* scenario, const pass_report_t* report) {
+	const transceiver_sim_stats_t* link = &report->link;
+	const communication_tx_stats_t* tx = &report->tx;
+	uint32_t seconds = scenario->durationMs / 1000;
+
+	printf("\nPASS %s (%u bps, %u ms latency, %u frames, %lu s)\n", scenario->name,
+		   (scenario->link.bitrate != 0) ? scenario->link.bitrate : TRANCEIVER_TX_BITRATE,
+		   scenario->link.latencyMs, scenario->frameCount, (unsigned long)seconds);
+	printf("\t Goodput:     %lu payload bytes/pass (%lu bytes/s), %lu / %u frames delivered",
+		   (unsigned long)link->payloadDelivered, (unsigned long)(link->payloadDelivered / seconds),
+		   (unsigned long)link->framesDelivered, scenario->frameCount);
+	if (report->drainedMs > 0)
+		printf(" in %lu ms", (unsigned long)report->drainedMs);
+	printf("\n");
+	printf("\t Frames:      %lu sent, %lu resent, %lu rejected by the transmitter, %lu duplicates received\n",
+		   (unsigned long)tx->framesSent, (unsigned long)tx->framesResent,
+		   (unsigned long)tx->framesRejected, (unsigned long)link->framesDuplicate);
+	printf("\t Link:        %lu frames lost, %lu corrupted; %lu responses lost, %lu corrupted\n",
+		   (unsigned long)link->framesLost, (unsigned long)link->framesCorrupted,
+		   (unsigned long)link->responsesLost, (unsigned long)link->responsesCorrupted);
+	printf("\t NACKs:       %lu sent, %lu received; longest error streak %lu (limit %u), %lu passes aborted\n",
+		   (unsigned long)link->nacksSent, (unsigned long)tx->nacksReceived, (unsigned long)tx->errorStreakMax,
+		   NACK_ERROR_LIMIT, (unsigned long)tx->passesAborted);
+	printf("\t Repaired:    %lu frames (%u parity bytes per frame)\n",
+		   (unsigned long)link->framesRepaired, scenario->link.fecParity);
+	printf("\t Air:         %lu ms busy, %lu ms idle\n", (unsigned long)tx->airBusyMs, (unsigned long)tx->airIdleMs);
+}